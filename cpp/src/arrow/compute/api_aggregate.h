@@ -20,6 +20,10 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -185,5 +189,99 @@ Result<Datum> Variance(const Datum& value,
                        const VarianceOptions& options = VarianceOptions::Defaults(),
                        ExecContext* ctx = NULLPTR);
 
+// ----------------------------------------------------------------------
+// Grouped aggregation
+
+namespace internal {
+
+/// \brief Configure a grouped aggregation
+struct ARROW_EXPORT Aggregate {
+  /// the name of the aggregation function, e.g. "hash_sum"
+  std::string function;
+
+  /// options for the aggregation function, or null for the function's defaults
+  const FunctionOptions* options;
+};
+
+/// \brief Assign a dense group id to each distinct combination of key values
+///
+/// Group ids are assigned in order of first appearance and are stable across
+/// calls to Consume(), so a Grouper can be fed a stream of batches.
+class ARROW_EXPORT Grouper {
+ public:
+  virtual ~Grouper() = default;
+
+  /// \brief Construct a Grouper which receives the specified key types
+  static Result<std::unique_ptr<Grouper>> Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx = NULLPTR);
+
+  /// \brief Consume a batch of keys, producing the corresponding group ids as
+  /// a uint32 array of the same length.
+  virtual Result<Datum> Consume(const ExecBatch& batch) = 0;
+
+  /// \brief Look up the group ids of a batch of keys without creating new
+  /// groups. Rows whose keys were never consumed get a null group id.
+  ///
+  /// Unlike Consume(), Find() may be called concurrently from several threads.
+  virtual Result<Datum> Find(const ExecBatch& batch) const = 0;
+
+  /// \brief Get the current number of groups
+  virtual uint32_t num_groups() const = 0;
+
+  /// \brief Get the key values of every group, ordered by group id
+  virtual Result<ExecBatch> GetUniques() = 0;
+};
+
+/// \brief Incrementally compute grouped aggregations over a stream of batches
+///
+/// Each consumed ExecBatch holds the aggregation arguments (one per
+/// Aggregate) followed by the key columns. Independent instances may consume
+/// disjoint batches on separate threads, then be combined with Merge().
+class ARROW_EXPORT GroupByAggregator {
+ public:
+  ~GroupByAggregator();
+
+  static Result<std::unique_ptr<GroupByAggregator>> Make(
+      const std::vector<ValueDescr>& argument_descrs,
+      const std::vector<ValueDescr>& key_descrs,
+      const std::vector<Aggregate>& aggregates, ExecContext* ctx = NULLPTR);
+
+  /// \brief Update the aggregation states with a batch of arguments and keys
+  Status Consume(const ExecBatch& batch);
+
+  /// \brief Fold the states of another aggregator (constructed with the same
+  /// arguments) into this one
+  Status Merge(GroupByAggregator&& other);
+
+  /// \brief Produce a StructArray with one field per aggregate followed by
+  /// one field per key ("key_0", "key_1", ...), with one row per group
+  Result<Datum> Finalize();
+
+ private:
+  struct Impl;
+
+  explicit GroupByAggregator(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Compute grouped aggregations of arguments by keys
+///
+/// Each argument is aggregated by the corresponding Aggregate. Arguments and
+/// keys must be Arrays or ChunkedArrays of equal length. When the context
+/// allows threading, batches are aggregated on the CPU thread pool and the
+/// partial states merged.
+///
+/// \return a StructArray, see GroupByAggregator::Finalize
+///
+/// \since 2.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates,
+                      ExecContext* ctx = NULLPTR);
+
+}  // namespace internal
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,7 +18,11 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -66,6 +70,45 @@ struct PartitionNthOptions : public FunctionOptions {
   int64_t pivot;
 };
 
+enum class SortOrder {
+  Ascending,
+  Descending,
+};
+
+/// \brief One sort key for SortIndices
+struct ARROW_EXPORT SortKey {
+  explicit SortKey(std::string name, SortOrder order = SortOrder::Ascending)
+      : name(std::move(name)), order(order) {}
+
+  /// The name of the column to sort by
+  std::string name;
+  /// How to order the values of the column
+  SortOrder order;
+};
+
+/// \brief Options for sorting a single Array
+struct ARROW_EXPORT ArraySortOptions : public FunctionOptions {
+  explicit ArraySortOptions(SortOrder order = SortOrder::Ascending) : order(order) {}
+
+  static ArraySortOptions Defaults() { return ArraySortOptions(); }
+
+  SortOrder order;
+};
+
+/// \brief Options for sorting a ChunkedArray, RecordBatch or Table
+///
+/// The sort keys are applied in order: rows comparing equal on the first key
+/// are ordered by the second key, and so on. When sorting a single (chunked)
+/// array, at most one key may be given and its name is ignored.
+struct ARROW_EXPORT SortOptions : public FunctionOptions {
+  explicit SortOptions(std::vector<SortKey> sort_keys = {})
+      : sort_keys(std::move(sort_keys)) {}
+
+  static SortOptions Defaults() { return SortOptions(); }
+
+  std::vector<SortKey> sort_keys;
+};
+
 /// @}
 
 /// \brief Filter with a boolean selection filter
@@ -118,6 +161,10 @@ Result<std::shared_ptr<ArrayData>> GetTakeIndices(
 /// = [values[2], values[1], null, values[3]]
 /// = ["c", "b", null, null]
 ///
+/// Chunked values are not concatenated. Sorted, non-null indices produce
+/// one output chunk per values chunk they hit; other indices are gathered
+/// into a single output chunk (per indices chunk, if chunked).
+///
 /// \param[in] values datum from which to take
 /// \param[in] indices which values to take
 /// \param[in] options options
@@ -168,6 +215,55 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> SortToIndices(const Array& values,
                                              ExecContext* ctx = NULLPTR);
 
+/// \brief Returns the indices that would sort an array in the given order.
+///
+/// Like SortToIndices, but allows sorting in descending order. Nulls are
+/// always stably partitioned to the end of the output.
+///
+/// \param[in] values array to sort
+/// \param[in] order ascending or descending
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort an array
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const Array& values,
+                                           SortOrder order = SortOrder::Ascending,
+                                           ExecContext* ctx = NULLPTR);
+
+/// \brief Returns the indices that would sort a chunked array.
+///
+/// The chunks are compared directly, without being concatenated first. The
+/// returned indices are logical row numbers into the whole chunked array.
+///
+/// \param[in] chunked_array chunked array to sort
+/// \param[in] order ascending or descending
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort the chunked array
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const ChunkedArray& chunked_array,
+                                           SortOrder order = SortOrder::Ascending,
+                                           ExecContext* ctx = NULLPTR);
+
+/// \brief Returns the indices that would sort an input by several keys.
+///
+/// The input can be an Array, ChunkedArray, RecordBatch or Table. For
+/// RecordBatch and Table inputs, each SortKey names a column; rows are
+/// ordered by the first key, ties are broken by the following keys, and the
+/// sort is stable. Nulls sort after all non-null values regardless of the
+/// order. Chunked columns are compared in place without concatenation, and
+/// narrow integer leading keys are sorted with a counting sort.
+///
+/// For example given a table with columns a = [1, 0, 1, 0] and
+/// b = ["x", "y", "w", null], sorting by {a ascending, b descending} will
+/// output [1, 3, 0, 2]
+///
+/// \param[in] datum input to sort
+/// \param[in] options the sort keys
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort the input
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
+                                           ExecContext* ctx = NULLPTR);
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
@@ -215,6 +311,102 @@ Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
 ARROW_EXPORT
 Result<Datum> DictionaryEncode(const Datum& data, ExecContext* ctx = NULLPTR);
 
+// ----------------------------------------------------------------------
+// Joins
+
+/// \brief The kind of join computed by HashJoin
+enum class JoinType {
+  /// One output row per pair of matching left and right rows
+  INNER,
+  /// Like INNER, plus one row per unmatched left row with null right columns
+  LEFT_OUTER,
+  /// The left rows having at least one match, with the left columns only
+  LEFT_SEMI,
+  /// The left rows having no match, with the left columns only
+  LEFT_ANTI,
+};
+
+/// \brief Configure an equi-join of a left (probe) and a right (build) side
+///
+/// Rows match when all left key columns equal the corresponding right key
+/// columns. As in SQL, a null key never matches anything.
+struct ARROW_EXPORT JoinOptions {
+  JoinOptions(JoinType join_type, std::vector<std::string> left_keys,
+              std::vector<std::string> right_keys)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)) {}
+
+  JoinType join_type;
+  /// Names of the key columns of the left side
+  std::vector<std::string> left_keys;
+  /// Names of the key columns of the right side, in the same order
+  std::vector<std::string> right_keys;
+};
+
+/// \brief The hashed right side of a hash join
+///
+/// The right table is materialized and hashed once on construction. After
+/// that the hash table is immutable, so batches of the left side may be
+/// probed against it concurrently from any number of threads.
+///
+/// The output has all the left columns followed, for INNER and LEFT_OUTER
+/// joins, by all the right columns.
+class ARROW_EXPORT JoinHashTable {
+ public:
+  ~JoinHashTable();
+
+  /// \brief Build the hash table of a join
+  ///
+  /// \param[in] left_schema schema of the batches which will be probed
+  /// \param[in] right the build side of the join
+  /// \param[in] options join type and key columns
+  /// \param[in] ctx the function execution context, optional. If given, it
+  /// must outlive the hash table.
+  static Result<std::shared_ptr<JoinHashTable>> Make(
+      const std::shared_ptr<Schema>& left_schema, const Table& right,
+      const JoinOptions& options, ExecContext* ctx = NULLPTR);
+
+  /// \brief The schema of the probe output
+  const std::shared_ptr<Schema>& output_schema() const;
+
+  /// \brief Probe a batch of the left side, returning its joined rows
+  ///
+  /// The values of the batch are the columns of the left schema in order.
+  /// Output rows follow the order of the probed rows.
+  Result<ExecBatch> Probe(const ExecBatch& left_batch) const;
+
+  /// \brief Probe a record batch of the left side
+  Result<std::shared_ptr<RecordBatch>> Probe(const RecordBatch& left_batch) const;
+
+ private:
+  struct Impl;
+
+  explicit JoinHashTable(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Join two tables by hashing the right one and probing the left one
+///
+/// The left table is streamed through the hash table in batches of at most
+/// ExecContext::exec_chunksize() rows; when the context allows threading the
+/// batches are probed in parallel on the CPU thread pool. The output rows
+/// follow the order of the left table.
+///
+/// \param[in] left the probe side
+/// \param[in] right the build side
+/// \param[in] options join type and key columns
+/// \param[in] ctx the function execution context, optional
+/// \return the joined table, see JoinHashTable::output_schema()
+///
+/// \since 2.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<Table>> HashJoin(const Table& left, const Table& right,
+                                        const JoinOptions& options,
+                                        ExecContext* ctx = NULLPTR);
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
@@ -910,6 +910,9 @@ Result<std::unique_ptr<FunctionExecutor>> FunctionExecutor::Make(
       return MakeExecutor<detail::VectorExecutor>(ctx, func, options);
     case Function::SCALAR_AGGREGATE:
       return MakeExecutor<detail::ScalarAggExecutor>(ctx, func, options);
+    case Function::HASH_AGGREGATE:
+      return Status::NotImplemented(
+          "Direct execution of HASH_AGGREGATE functions, use internal::GroupBy");
     default:
       DCHECK(false);
       return nullptr;
@@ -188,6 +188,20 @@ Result<const ScalarAggregateKernel*> ScalarAggregateFunction::DispatchExact(
   return DispatchExactImpl(*this, kernels_, values);
 }
 
+Status HashAggregateFunction::AddKernel(HashAggregateKernel kernel) {
+  RETURN_NOT_OK(CheckArity(static_cast<int>(kernel.signature->in_types().size())));
+  if (arity_.is_varargs && !kernel.signature->is_varargs()) {
+    return Status::Invalid("Function accepts varargs but kernel signature does not");
+  }
+  kernels_.emplace_back(std::move(kernel));
+  return Status::OK();
+}
+
+Result<const HashAggregateKernel*> HashAggregateFunction::DispatchExact(
+    const std::vector<ValueDescr>& values) const {
+  return DispatchExactImpl(*this, kernels_, values);
+}
+
 Result<Datum> MetaFunction::Execute(const std::vector<Datum>& args,
                                     const FunctionOptions* options,
                                     ExecContext* ctx) const {
@@ -701,5 +701,58 @@ struct ScalarAggregateKernel : public Kernel {
   ScalarAggregateFinalize finalize;
 };
 
+// ----------------------------------------------------------------------
+// HashAggregateKernel (for HashAggregateFunction)
+
+using HashAggregateResize = std::function<void(KernelContext*, int64_t)>;
+
+using HashAggregateConsume = std::function<void(KernelContext*, const ExecBatch&)>;
+
+using HashAggregateMerge =
+    std::function<void(KernelContext*, KernelState&&, const ArrayData&)>;
+
+// Finalize returns Datum to permit multiple return values
+using HashAggregateFinalize = std::function<void(KernelContext*, Datum*)>;
+
+/// \brief Kernel data structure for implementations of
+/// HashAggregateFunction. The five necessary components of a grouped
+/// aggregation kernel are the init, resize, consume, merge, and finalize
+/// functions.
+///
+/// * init: creates a new KernelState for a kernel.
+/// * resize: ensures that the KernelState has room for at least the given
+///   number of groups.
+/// * consume: processes an ExecBatch (the values to aggregate followed by a
+///   uint32 array of group ids) and updates the KernelState found in the
+///   KernelContext.
+/// * merge: combines one KernelState with another. The uint32 array of group
+///   ids maps each group of the source state to a group of the destination.
+/// * finalize: produces the end result of the aggregation, one value per
+///   group, using the KernelState in the KernelContext.
+struct HashAggregateKernel : public Kernel {
+  HashAggregateKernel() {}
+
+  HashAggregateKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
+                      HashAggregateResize resize, HashAggregateConsume consume,
+                      HashAggregateMerge merge, HashAggregateFinalize finalize)
+      : Kernel(std::move(sig), init),
+        resize(std::move(resize)),
+        consume(std::move(consume)),
+        merge(std::move(merge)),
+        finalize(std::move(finalize)) {}
+
+  HashAggregateKernel(std::vector<InputType> in_types, OutputType out_type,
+                      KernelInit init, HashAggregateResize resize,
+                      HashAggregateConsume consume, HashAggregateMerge merge,
+                      HashAggregateFinalize finalize)
+      : HashAggregateKernel(KernelSignature::Make(std::move(in_types), out_type), init,
+                            resize, consume, merge, finalize) {}
+
+  HashAggregateResize resize;
+  HashAggregateConsume consume;
+  HashAggregateMerge merge;
+  HashAggregateFinalize finalize;
+};
+
 }  // namespace compute
 }  // namespace arrow
@@ -410,5 +410,59 @@ static void CountKernelBenchInt64(benchmark::State& state) {
 }
 BENCHMARK(CountKernelBenchInt64)->Args({1 * 1024 * 1024, 2});  // 1M with 50% null.
 
+//
+// GroupBy
+//
+
+static void BenchmarkGroupBy(benchmark::State& state, const std::vector<Datum>& arguments,
+                             const std::vector<Datum>& keys,
+                             const std::vector<internal::Aggregate>& aggregates) {
+  for (auto _ : state) {
+    ABORT_NOT_OK(internal::GroupBy(arguments, keys, aggregates).status());
+  }
+}
+
+static void GroupByKernelBenchArgs(benchmark::internal::Benchmark* bench) {
+  BenchmarkSetArgsWithSizes(bench, {1 * 1024 * 1024});  // 1M
+}
+
+template <int64_t NumKeys>
+static void SumDoublesGroupedByIntegerKey(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto summand = rand.Float64(args.size, -100.0, 100.0, args.null_proportion);
+  auto key = rand.Int64(args.size, 0, NumKeys - 1);
+
+  BenchmarkGroupBy(state, {summand}, {key}, {{"hash_sum", NULLPTR}});
+}
+
+template <int64_t NumKeys>
+static void SumDoublesGroupedByStringKey(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto summand = rand.Float64(args.size, -100.0, 100.0, args.null_proportion);
+  auto key = rand.StringWithRepeats(args.size, NumKeys, /*min_length=*/3,
+                                    /*max_length=*/32);
+
+  BenchmarkGroupBy(state, {summand}, {key}, {{"hash_sum", NULLPTR}});
+}
+
+static void MinMaxDoublesGroupedByIntegerAndStringKeys(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto argument = rand.Float64(args.size, -100.0, 100.0, args.null_proportion);
+  auto int_key = rand.Int64(args.size, 0, 63);
+  auto str_key = rand.StringWithRepeats(args.size, /*unique=*/16, /*min_length=*/3,
+                                        /*max_length=*/32);
+
+  BenchmarkGroupBy(state, {argument}, {int_key, str_key}, {{"hash_min_max", NULLPTR}});
+}
+
+BENCHMARK_TEMPLATE(SumDoublesGroupedByIntegerKey, 16)->Apply(GroupByKernelBenchArgs);
+BENCHMARK_TEMPLATE(SumDoublesGroupedByIntegerKey, 4096)->Apply(GroupByKernelBenchArgs);
+BENCHMARK_TEMPLATE(SumDoublesGroupedByStringKey, 16)->Apply(GroupByKernelBenchArgs);
+BENCHMARK_TEMPLATE(SumDoublesGroupedByStringKey, 4096)->Apply(GroupByKernelBenchArgs);
+BENCHMARK(MinMaxDoublesGroupedByIntegerAndStringKeys)->Apply(GroupByKernelBenchArgs);
+
 }  // namespace compute
 }  // namespace arrow
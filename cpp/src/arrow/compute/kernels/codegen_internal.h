@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -57,6 +59,8 @@ using internal::BitmapReader;
 using internal::checked_cast;
 using internal::FirstTimeBitmapWriter;
 using internal::GenerateBitsUnrolled;
+using internal::OptionalBinaryBitBlockCounter;
+using internal::OptionalBitBlockCounter;
 using internal::VisitBitBlocksVoid;
 using internal::VisitTwoBitBlocksVoid;
 
@@ -236,6 +240,26 @@ struct ArrayIterator<Type, enable_if_base_binary<Type>> {
   }
 };
 
+// Load `length` (at most 64) bits of `bitmap` starting at bit `offset` into the
+// low bits of a word. A null bitmap yields all valid bits.
+static inline uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t offset,
+                                      int64_t length) {
+  const uint64_t mask = length == 64 ? ~uint64_t(0) : (uint64_t(1) << length) - 1;
+  if (bitmap == NULLPTR) {
+    return mask;
+  }
+  const uint8_t* bytes = bitmap + offset / 8;
+  const int64_t shift = offset % 8;
+  const int64_t num_bytes = BitUtil::BytesForBits(length + shift);
+  uint64_t word = 0;
+  std::memcpy(&word, bytes, std::min<int64_t>(num_bytes, 8));
+  word = BitUtil::FromLittleEndian(word) >> shift;
+  if (num_bytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+  return word & mask;
+}
+
 // Iterator over various output array types, taking a GetOutputType<Type>
 
 template <typename Type, typename Enable = void>
@@ -748,10 +772,20 @@ struct ScalarBinaryNotNullStateful {
   Op op;
   explicit ScalarBinaryNotNullStateful(Op op) : op(std::move(op)) {}
 
-  // NOTE: In ArrayExec<Type>, Type is really OutputType
+  // Inputs whose values can be read straight from a C array
+  using PrimitiveInputs =
+      std::integral_constant<bool, has_c_type<Arg0Type>::value &&
+                                       !is_boolean_type<Arg0Type>::value &&
+                                       has_c_type<Arg1Type>::value &&
+                                       !is_boolean_type<Arg1Type>::value>;
 
   void ArrayArray(KernelContext* ctx, const ArrayData& arg0, const ArrayData& arg1,
                   Datum* out) {
+    ArrayArray(ctx, arg0, arg1, out, PrimitiveInputs{});
+  }
+
+  void ArrayArray(KernelContext* ctx, const ArrayData& arg0, const ArrayData& arg1,
+                  Datum* out, std::false_type) {
     OutputArrayWriter<OutType> writer(out->mutable_array());
     VisitTwoArrayValuesInline<Arg0Type, Arg1Type>(
         arg0, arg1,
@@ -761,33 +795,113 @@ struct ScalarBinaryNotNullStateful {
         [&]() { writer.WriteNull(); });
   }
 
+  // Blocks of values that are all valid are computed by a loop without any
+  // validity test, which the compiler can vectorize for branch-free operators;
+  // blocks that are all null are zero-filled without calling the operator.
+  void ArrayArray(KernelContext* ctx, const ArrayData& arg0, const ArrayData& arg1,
+                  Datum* out, std::true_type) {
+    OutValue* out_values = out->mutable_array()->GetMutableValues<OutValue>(1);
+    const Arg0Value* arg0_values = arg0.GetValues<Arg0Value>(1);
+    const Arg1Value* arg1_values = arg1.GetValues<Arg1Value>(1);
+    const uint8_t* arg0_bitmap = arg0.GetValues<uint8_t>(0, 0);
+    const uint8_t* arg1_bitmap = arg1.GetValues<uint8_t>(0, 0);
+
+    OptionalBinaryBitBlockCounter bit_counter(arg0_bitmap, arg0.offset, arg1_bitmap,
+                                              arg1.offset, arg0.length);
+    int64_t position = 0;
+    while (position < arg0.length) {
+      const BitBlockCount block = bit_counter.NextAndBlock();
+      const int64_t block_end = position + block.length;
+      if (block.AllSet()) {
+        for (int64_t i = position; i < block_end; ++i) {
+          out_values[i] = op.template Call<OutValue, Arg0Value, Arg1Value>(
+              ctx, arg0_values[i], arg1_values[i]);
+        }
+      } else if (block.NoneSet()) {
+        std::fill(out_values + position, out_values + block_end, OutValue{});
+      } else {
+        // Mixed blocks are at most one word long: zero-fill the block, then
+        // visit the valid positions by iterating over the set bits
+        uint64_t valid_bits =
+            LoadBitmapWord(arg0_bitmap, arg0.offset + position, block.length) &
+            LoadBitmapWord(arg1_bitmap, arg1.offset + position, block.length);
+        std::fill(out_values + position, out_values + block_end, OutValue{});
+        for (; valid_bits != 0; valid_bits &= valid_bits - 1) {
+          const int64_t i = position + BitUtil::CountTrailingZeros(valid_bits);
+          out_values[i] = op.template Call<OutValue, Arg0Value, Arg1Value>(
+              ctx, arg0_values[i], arg1_values[i]);
+        }
+      }
+      position = block_end;
+    }
+  }
+
   void ArrayScalar(KernelContext* ctx, const ArrayData& arg0, const Scalar& arg1,
                    Datum* out) {
-    OutputArrayWriter<OutType> writer(out->mutable_array());
     if (arg1.is_valid) {
       const auto arg1_val = UnboxScalar<Arg1Type>::Unbox(arg1);
-      VisitArrayValuesInline<Arg0Type>(
-          arg0,
+      VisitArrayWithScalar<Arg0Type>(
+          arg0, out,
           [&](Arg0Value u) {
-            writer.Write(
-                op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, u, arg1_val));
+            return op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, u, arg1_val);
           },
-          [&]() { writer.WriteNull(); });
+          PrimitiveInputs{});
     }
   }
 
   void ScalarArray(KernelContext* ctx, const Scalar& arg0, const ArrayData& arg1,
                    Datum* out) {
-    OutputArrayWriter<OutType> writer(out->mutable_array());
     if (arg0.is_valid) {
       const auto arg0_val = UnboxScalar<Arg0Type>::Unbox(arg0);
-      VisitArrayValuesInline<Arg1Type>(
-          arg1,
+      VisitArrayWithScalar<Arg1Type>(
+          arg1, out,
           [&](Arg1Value v) {
-            writer.Write(
-                op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, arg0_val, v));
+            return op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, arg0_val, v);
           },
-          [&]() { writer.WriteNull(); });
+          PrimitiveInputs{});
+    }
+  }
+
+  // Write func(value) for the valid values of `arg` and zero for the nulls
+  template <typename ArgType, typename Func>
+  static void VisitArrayWithScalar(const ArrayData& arg, Datum* out, Func&& func,
+                                   std::false_type) {
+    using ArgValue = typename GetViewType<ArgType>::T;
+    OutputArrayWriter<OutType> writer(out->mutable_array());
+    VisitArrayValuesInline<ArgType>(
+        arg, [&](ArgValue v) { writer.Write(func(v)); }, [&]() { writer.WriteNull(); });
+  }
+
+  // Blockwise variant of the above, see the primitive ArrayArray
+  template <typename ArgType, typename Func>
+  static void VisitArrayWithScalar(const ArrayData& arg, Datum* out, Func&& func,
+                                   std::true_type) {
+    using ArgValue = typename GetViewType<ArgType>::T;
+    OutValue* out_values = out->mutable_array()->GetMutableValues<OutValue>(1);
+    const ArgValue* arg_values = arg.GetValues<ArgValue>(1);
+    const uint8_t* arg_bitmap = arg.GetValues<uint8_t>(0, 0);
+
+    OptionalBitBlockCounter bit_counter(arg_bitmap, arg.offset, arg.length);
+    int64_t position = 0;
+    while (position < arg.length) {
+      const BitBlockCount block = bit_counter.NextBlock();
+      const int64_t block_end = position + block.length;
+      if (block.AllSet()) {
+        for (int64_t i = position; i < block_end; ++i) {
+          out_values[i] = func(arg_values[i]);
+        }
+      } else if (block.NoneSet()) {
+        std::fill(out_values + position, out_values + block_end, OutValue{});
+      } else {
+        uint64_t valid_bits =
+            LoadBitmapWord(arg_bitmap, arg.offset + position, block.length);
+        std::fill(out_values + position, out_values + block_end, OutValue{});
+        for (; valid_bits != 0; valid_bits &= valid_bits - 1) {
+          const int64_t i = position + BitUtil::CountTrailingZeros(valid_bits);
+          out_values[i] = func(arg_values[i]);
+        }
+      }
+      position = block_end;
     }
   }
 
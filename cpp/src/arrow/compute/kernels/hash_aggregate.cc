@@ -0,0 +1,1212 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding
+//
+// Keys which cannot be hashed directly by a ScalarMemoTable are encoded
+// row-wise into a byte string: each column contributes a validity byte
+// followed by its value (fixed-width) or its length and bytes (binary).
+// Distinct encoded rows are then memoized in a BinaryMemoTable.
+
+struct KeyEncoder {
+  virtual ~KeyEncoder() = default;
+
+  // Add the encoded length of each row of `data` to `lengths`
+  virtual void AddLength(const ArrayData& data, int64_t* lengths) = 0;
+
+  // Write the encoding of each row of `data`, advancing the row pointers
+  virtual void Encode(const ArrayData& data, uint8_t** encoded_bytes) = 0;
+
+  // Decode `length` rows, advancing the row pointers
+  virtual Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                                    int64_t length,
+                                                    MemoryPool* pool) = 0;
+
+ protected:
+  static bool IsValid(const ArrayData& data, int64_t i) {
+    return data.GetNullCount() == 0 ||
+           (data.buffers[0] != NULLPTR &&
+            BitUtil::GetBit(data.buffers[0]->data(), data.offset + i));
+  }
+
+  static Result<std::shared_ptr<Buffer>> DecodeValidity(const uint8_t** encoded_bytes,
+                                                        int64_t length, MemoryPool* pool,
+                                                        int64_t* null_count) {
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, AllocateBitmap(length, pool));
+    uint8_t* bitmap = null_bitmap->mutable_data();
+    *null_count = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const bool valid = *encoded_bytes[i] != 0;
+      BitUtil::SetBitTo(bitmap, i, valid);
+      *null_count += !valid;
+    }
+    if (*null_count == 0) {
+      return NULLPTR;
+    }
+    return null_bitmap;
+  }
+};
+
+struct BooleanKeyEncoder : KeyEncoder {
+  static constexpr int kByteWidth = 1 + 1;
+
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += kByteWidth;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* values = data.buffers[1]->data();
+    for (int64_t i = 0; i < data.length; ++i) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      const bool valid = IsValid(data, i);
+      *encoded_ptr++ = valid;
+      *encoded_ptr++ = valid && BitUtil::GetBit(values, data.offset + i);
+    }
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int64_t length, MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          DecodeValidity(encoded_bytes, length, pool, &null_count));
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBitmap(length, pool));
+    uint8_t* values = key_buf->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t*& encoded_ptr = encoded_bytes[i];
+      BitUtil::SetBitTo(values, i, encoded_ptr[1] != 0);
+      encoded_ptr += kByteWidth;
+    }
+    return ArrayData::Make(boolean(), length,
+                           {std::move(null_bitmap), std::move(key_buf)}, null_count);
+  }
+};
+
+struct FixedWidthKeyEncoder : KeyEncoder {
+  explicit FixedWidthKeyEncoder(std::shared_ptr<DataType> type)
+      : type_(std::move(type)),
+        byte_width_(checked_cast<const FixedWidthType&>(*type_).bit_width() / 8) {}
+
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += 1 + byte_width_;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width_;
+    for (int64_t i = 0; i < data.length; ++i) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      if (IsValid(data, i)) {
+        *encoded_ptr++ = 1;
+        std::memcpy(encoded_ptr, values + i * byte_width_, byte_width_);
+      } else {
+        *encoded_ptr++ = 0;
+        std::memset(encoded_ptr, 0, byte_width_);
+      }
+      encoded_ptr += byte_width_;
+    }
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int64_t length, MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          DecodeValidity(encoded_bytes, length, pool, &null_count));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> key_buf,
+                          AllocateBuffer(length * byte_width_, pool));
+    uint8_t* values = key_buf->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t*& encoded_ptr = encoded_bytes[i];
+      std::memcpy(values + i * byte_width_, encoded_ptr + 1, byte_width_);
+      encoded_ptr += 1 + byte_width_;
+    }
+    return ArrayData::Make(type_, length, {std::move(null_bitmap), std::move(key_buf)},
+                           null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+  int byte_width_;
+};
+
+template <typename T>
+struct VarLengthKeyEncoder : KeyEncoder {
+  using Offset = typename T::offset_type;
+
+  explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    const Offset* offsets = data.GetValues<Offset>(1);
+    for (int64_t i = 0; i < data.length; ++i) {
+      const Offset value_length = IsValid(data, i) ? offsets[i + 1] - offsets[i] : 0;
+      lengths[i] += 1 + sizeof(Offset) + value_length;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const Offset* offsets = data.GetValues<Offset>(1);
+    const uint8_t* bytes = data.buffers[2] ? data.buffers[2]->data() : NULLPTR;
+    for (int64_t i = 0; i < data.length; ++i) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      const bool valid = IsValid(data, i);
+      const Offset value_length = valid ? offsets[i + 1] - offsets[i] : 0;
+      *encoded_ptr++ = valid;
+      std::memcpy(encoded_ptr, &value_length, sizeof(Offset));
+      encoded_ptr += sizeof(Offset);
+      if (value_length > 0) {
+        std::memcpy(encoded_ptr, bytes + offsets[i], value_length);
+        encoded_ptr += value_length;
+      }
+    }
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int64_t length, MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          DecodeValidity(encoded_bytes, length, pool, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> offset_buf,
+                          AllocateBuffer((length + 1) * sizeof(Offset), pool));
+    auto raw_offsets = reinterpret_cast<Offset*>(offset_buf->mutable_data());
+    Offset current_offset = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      raw_offsets[i] = current_offset;
+      Offset value_length;
+      std::memcpy(&value_length, encoded_bytes[i] + 1, sizeof(Offset));
+      current_offset += value_length;
+    }
+    raw_offsets[length] = current_offset;
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> key_buf,
+                          AllocateBuffer(current_offset, pool));
+    uint8_t* raw_keys = key_buf->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t*& encoded_ptr = encoded_bytes[i];
+      const Offset value_length = raw_offsets[i + 1] - raw_offsets[i];
+      encoded_ptr += 1 + sizeof(Offset);
+      std::memcpy(raw_keys + raw_offsets[i], encoded_ptr, value_length);
+      encoded_ptr += value_length;
+    }
+
+    return ArrayData::Make(
+        type_, length,
+        {std::move(null_bitmap), std::move(offset_buf), std::move(key_buf)}, null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+};
+
+Result<std::shared_ptr<ArrayData>> MakeUInt32Array(TypedBufferBuilder<uint32_t>* builder,
+                                                   int64_t length) {
+  std::shared_ptr<Buffer> buf;
+  RETURN_NOT_OK(builder->Finish(&buf));
+  return ArrayData::Make(uint32(), length, {NULLPTR, std::move(buf)}, /*null_count=*/0);
+}
+
+// Accumulate the result of Grouper::Find(): uint32 group ids, null where the
+// key was not found
+class FoundGroupsBuilder {
+ public:
+  FoundGroupsBuilder(int64_t length, MemoryPool* pool)
+      : length_(length), group_ids_(pool), validity_(pool) {}
+
+  Status Init() {
+    RETURN_NOT_OK(group_ids_.Resize(length_));
+    return validity_.Resize(length_);
+  }
+
+  void Append(int32_t group_id) {
+    const bool found = group_id != ::arrow::internal::kKeyNotFound;
+    group_ids_.UnsafeAppend(found ? static_cast<uint32_t>(group_id) : 0);
+    validity_.UnsafeAppend(found);
+  }
+
+  Result<Datum> Finish() {
+    const int64_t null_count = validity_.false_count();
+    std::shared_ptr<Buffer> ids_buf, null_bitmap;
+    RETURN_NOT_OK(group_ids_.Finish(&ids_buf));
+    RETURN_NOT_OK(validity_.Finish(&null_bitmap));
+    if (null_count == 0) {
+      null_bitmap = NULLPTR;
+    }
+    return ArrayData::Make(uint32(), length_,
+                           {std::move(null_bitmap), std::move(ids_buf)}, null_count);
+  }
+
+ private:
+  int64_t length_;
+  TypedBufferBuilder<uint32_t> group_ids_;
+  TypedBufferBuilder<bool> validity_;
+};
+
+Status CheckKeyBatch(const ExecBatch& batch, size_t num_keys) {
+  if (batch.num_values() != static_cast<int>(num_keys)) {
+    return Status::Invalid("Grouper expected ", num_keys, " keys but got ",
+                           batch.num_values());
+  }
+  for (const auto& value : batch.values) {
+    if (!value.is_array()) {
+      return Status::NotImplemented("Grouping by non-array keys");
+    }
+  }
+  return Status::OK();
+}
+
+// Grouper for arbitrary combinations of keys, using the row-wise encoding above
+class GrouperImpl : public Grouper {
+ public:
+  static Result<std::unique_ptr<GrouperImpl>> Make(const std::vector<ValueDescr>& keys,
+                                                   ExecContext* ctx) {
+    auto impl = std::unique_ptr<GrouperImpl>(new GrouperImpl(ctx));
+    for (const auto& key : keys) {
+      const auto& type = key.type;
+      if (type->id() == Type::BOOL) {
+        impl->encoders_.push_back(::arrow::internal::make_unique<BooleanKeyEncoder>());
+      } else if (is_fixed_width(type->id()) && !is_nested(type->id()) &&
+                 type->id() != Type::DICTIONARY && type->id() != Type::NA) {
+        impl->encoders_.push_back(
+            ::arrow::internal::make_unique<FixedWidthKeyEncoder>(type));
+      } else if (type->id() == Type::BINARY || type->id() == Type::STRING) {
+        impl->encoders_.push_back(
+            ::arrow::internal::make_unique<VarLengthKeyEncoder<BinaryType>>(type));
+      } else if (type->id() == Type::LARGE_BINARY || type->id() == Type::LARGE_STRING) {
+        impl->encoders_.push_back(
+            ::arrow::internal::make_unique<VarLengthKeyEncoder<LargeBinaryType>>(type));
+      } else {
+        return Status::NotImplemented("Keys of type ", *type);
+      }
+    }
+    return std::move(impl);
+  }
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(CheckKeyBatch(batch, encoders_.size()));
+    const int64_t length = batch.length;
+    EncodeRows(batch, &offsets_, &key_bytes_, &key_buf_ptrs_);
+
+    TypedBufferBuilder<uint32_t> group_ids(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids.Resize(length));
+    for (int64_t i = 0; i < length; ++i) {
+      int32_t group_id;
+      RETURN_NOT_OK(map_.GetOrInsert(key_bytes_.data() + offsets_[i],
+                                     offsets_[i + 1] - offsets_[i], &group_id));
+      group_ids.UnsafeAppend(static_cast<uint32_t>(group_id));
+    }
+    return MakeUInt32Array(&group_ids, length);
+  }
+
+  Result<Datum> Find(const ExecBatch& batch) const override {
+    RETURN_NOT_OK(CheckKeyBatch(batch, encoders_.size()));
+    std::vector<int64_t> offsets;
+    std::vector<uint8_t> key_bytes;
+    std::vector<uint8_t*> key_buf_ptrs;
+    EncodeRows(batch, &offsets, &key_bytes, &key_buf_ptrs);
+
+    FoundGroupsBuilder group_ids(batch.length, ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids.Init());
+    for (int64_t i = 0; i < batch.length; ++i) {
+      group_ids.Append(
+          map_.Get(key_bytes.data() + offsets[i], offsets[i + 1] - offsets[i]));
+    }
+    return group_ids.Finish();
+  }
+
+  uint32_t num_groups() const override { return static_cast<uint32_t>(map_.size()); }
+
+  Result<ExecBatch> GetUniques() override {
+    const int64_t length = num_groups();
+    std::vector<const uint8_t*> key_buf_ptrs;
+    key_buf_ptrs.reserve(length);
+    map_.VisitValues(0, [&](const util::string_view& encoded) {
+      key_buf_ptrs.push_back(reinterpret_cast<const uint8_t*>(encoded.data()));
+    });
+
+    ExecBatch out({}, length);
+    for (const auto& encoder : encoders_) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto key, encoder->Decode(key_buf_ptrs.data(), length, ctx_->memory_pool()));
+      out.values.emplace_back(std::move(key));
+    }
+    return out;
+  }
+
+ private:
+  explicit GrouperImpl(ExecContext* ctx) : ctx_(ctx), map_(ctx->memory_pool()) {}
+
+  // Encode all key columns row-wise; row i occupies
+  // [(*offsets)[i], (*offsets)[i + 1]) in `key_bytes`
+  void EncodeRows(const ExecBatch& batch, std::vector<int64_t>* offsets,
+                  std::vector<uint8_t>* key_bytes,
+                  std::vector<uint8_t*>* key_buf_ptrs) const {
+    const int64_t length = batch.length;
+
+    // Compute the offset of each encoded row
+    offsets->assign(length + 1, 0);
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      encoders_[i]->AddLength(*batch[i].array(), offsets->data());
+    }
+    int64_t total_length = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t row_length = (*offsets)[i];
+      (*offsets)[i] = total_length;
+      total_length += row_length;
+    }
+    (*offsets)[length] = total_length;
+
+    key_bytes->resize(total_length);
+    key_buf_ptrs->resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      (*key_buf_ptrs)[i] = key_bytes->data() + (*offsets)[i];
+    }
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      encoders_[i]->Encode(*batch[i].array(), key_buf_ptrs->data());
+    }
+  }
+
+  ExecContext* ctx_;
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+  std::vector<int64_t> offsets_;
+  std::vector<uint8_t> key_bytes_;
+  std::vector<uint8_t*> key_buf_ptrs_;
+  ::arrow::internal::BinaryMemoTable<LargeBinaryBuilder> map_;
+};
+
+// Grouper for a single key of primitive type, hashing the values directly
+template <typename PhysicalType>
+class ScalarGrouper : public Grouper {
+ public:
+  using CType = typename PhysicalType::c_type;
+  using MemoTable = typename ::arrow::internal::HashTraits<PhysicalType>::MemoTableType;
+
+  ScalarGrouper(std::shared_ptr<DataType> type, ExecContext* ctx)
+      : type_(std::move(type)), ctx_(ctx), memo_table_(ctx->memory_pool()) {}
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(CheckKeyBatch(batch, 1));
+    const ArrayData& keys = *batch[0].array();
+
+    TypedBufferBuilder<uint32_t> group_ids(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids.Resize(batch.length));
+    RETURN_NOT_OK(VisitArrayDataInline<PhysicalType>(
+        keys,
+        [&](CType value) {
+          int32_t group_id;
+          RETURN_NOT_OK(memo_table_.GetOrInsert(value, &group_id));
+          group_ids.UnsafeAppend(static_cast<uint32_t>(group_id));
+          return Status::OK();
+        },
+        [&]() {
+          group_ids.UnsafeAppend(static_cast<uint32_t>(memo_table_.GetOrInsertNull()));
+          return Status::OK();
+        }));
+    return MakeUInt32Array(&group_ids, batch.length);
+  }
+
+  Result<Datum> Find(const ExecBatch& batch) const override {
+    RETURN_NOT_OK(CheckKeyBatch(batch, 1));
+    const ArrayData& keys = *batch[0].array();
+
+    FoundGroupsBuilder group_ids(batch.length, ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids.Init());
+    VisitArrayDataInline<PhysicalType>(
+        keys, [&](CType value) { group_ids.Append(memo_table_.Get(value)); },
+        [&]() { group_ids.Append(memo_table_.GetNull()); });
+    return group_ids.Finish();
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(memo_table_.size());
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    const int64_t length = num_groups();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> key_buf,
+                          AllocateBuffer(length * sizeof(CType), ctx_->memory_pool()));
+    auto raw_keys = reinterpret_cast<CType*>(key_buf->mutable_data());
+    std::fill(raw_keys, raw_keys + length, CType{});
+    memo_table_.CopyValues(raw_keys);
+
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
+    const int32_t null_index = memo_table_.GetNull();
+    if (null_index != ::arrow::internal::kKeyNotFound) {
+      ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(length, ctx_->memory_pool()));
+      BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, length, true);
+      BitUtil::ClearBit(null_bitmap->mutable_data(), null_index);
+      null_count = 1;
+    }
+
+    return ExecBatch({ArrayData::Make(type_, length,
+                                      {std::move(null_bitmap), std::move(key_buf)},
+                                      null_count)},
+                     length);
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  ExecContext* ctx_;
+  MemoTable memo_table_;
+};
+
+template <typename PhysicalType>
+Result<std::unique_ptr<Grouper>> MakeScalarGrouper(std::shared_ptr<DataType> type,
+                                                   ExecContext* ctx) {
+  return std::unique_ptr<Grouper>(new ScalarGrouper<PhysicalType>(std::move(type), ctx));
+}
+
+}  // namespace
+
+Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx) {
+  if (ctx == nullptr) {
+    // Groupers outlive this call, so the context must be long-lived
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  if (descrs.size() == 1 && descrs[0].type->id() != Type::BOOL &&
+      is_primitive(descrs[0].type->id())) {
+    const auto& type = descrs[0].type;
+    if (type->id() == Type::FLOAT) {
+      return MakeScalarGrouper<FloatType>(type, ctx);
+    }
+    if (type->id() == Type::DOUBLE) {
+      return MakeScalarGrouper<DoubleType>(type, ctx);
+    }
+    switch (checked_cast<const FixedWidthType&>(*type).bit_width()) {
+      case 8:
+        return MakeScalarGrouper<Int8Type>(type, ctx);
+      case 16:
+        return MakeScalarGrouper<Int16Type>(type, ctx);
+      case 32:
+        return MakeScalarGrouper<Int32Type>(type, ctx);
+      case 64:
+        return MakeScalarGrouper<Int64Type>(type, ctx);
+      default:
+        break;
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto impl, GrouperImpl::Make(descrs, ctx));
+  return std::unique_ptr<Grouper>(std::move(impl));
+}
+
+}  // namespace internal
+
+namespace aggregate {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Grouped aggregation states
+
+struct GroupedAggregator : public KernelState {
+  virtual Status Init(ExecContext* ctx, const FunctionOptions* options) = 0;
+
+  virtual Status Resize(int64_t new_num_groups) = 0;
+
+  // batch[0] holds the values, batch[1] the uint32 group ids
+  virtual Status Consume(const ExecBatch& batch) = 0;
+
+  virtual Status Merge(GroupedAggregator&& other, const ArrayData& group_id_mapping) = 0;
+
+  virtual Result<Datum> Finalize() = 0;
+
+  template <typename T>
+  static Status ResizeBuffer(TypedBufferBuilder<T>* builder, int64_t new_num_groups,
+                             T fill_value) {
+    const int64_t added_groups = new_num_groups - builder->length();
+    if (added_groups <= 0) return Status::OK();
+    return builder->Append(added_groups, fill_value);
+  }
+};
+
+// Build a validity bitmap from per-group counts, null where the count is zero
+Result<std::shared_ptr<Buffer>> CountsToValidity(const int64_t* counts,
+                                                 int64_t num_groups, MemoryPool* pool,
+                                                 int64_t* null_count) {
+  ARROW_ASSIGN_OR_RAISE(auto null_bitmap, AllocateBitmap(num_groups, pool));
+  *null_count = 0;
+  for (int64_t i = 0; i < num_groups; ++i) {
+    BitUtil::SetBitTo(null_bitmap->mutable_data(), i, counts[i] > 0);
+    *null_count += counts[i] == 0;
+  }
+  if (*null_count == 0) return NULLPTR;
+  return null_bitmap;
+}
+
+// ----------------------------------------------------------------------
+// Count implementation
+
+struct GroupedCountImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const FunctionOptions* options) override {
+    options_ = static_cast<const CountOptions&>(*options);
+    counts_ = TypedBufferBuilder<int64_t>(ctx->memory_pool());
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    return ResizeBuffer<int64_t>(&counts_, new_num_groups, 0);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    int64_t* counts = counts_.mutable_data();
+    const ArrayData& input = *batch[0].array();
+    const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+
+    const int64_t null_count = input.GetNullCount();
+    const bool count_valid = options_.count_mode == CountOptions::COUNT_NON_NULL;
+    if (null_count == 0 || null_count == input.length) {
+      // All values have the same validity
+      if (count_valid == (null_count == 0)) {
+        for (int64_t i = 0; i < input.length; ++i) {
+          ++counts[g[i]];
+        }
+      }
+      return Status::OK();
+    }
+
+    ::arrow::internal::BitmapReader reader(input.buffers[0]->data(), input.offset,
+                                           input.length);
+    for (int64_t i = 0; i < input.length; ++i) {
+      counts[g[i]] += reader.IsSet() == count_valid;
+      reader.Next();
+    }
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedCountImpl*>(&raw_other);
+    int64_t* counts = counts_.mutable_data();
+    const int64_t* other_counts = other->counts_.data();
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t length = counts_.length();
+    std::shared_ptr<Buffer> counts;
+    RETURN_NOT_OK(counts_.Finish(&counts));
+    return ArrayData::Make(int64(), length, {NULLPTR, std::move(counts)},
+                           /*null_count=*/0);
+  }
+
+  CountOptions options_ = CountOptions::Defaults();
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+// ----------------------------------------------------------------------
+// Sum / Mean implementation
+
+template <typename ArrowType>
+struct GroupedSumImpl : public GroupedAggregator {
+  using AccType = typename FindAccumulatorType<ArrowType>::Type;
+  using CType = typename ArrowType::c_type;
+  using AccCType = typename AccType::c_type;
+
+  Status Init(ExecContext* ctx, const FunctionOptions*) override {
+    pool_ = ctx->memory_pool();
+    sums_ = TypedBufferBuilder<AccCType>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    RETURN_NOT_OK(ResizeBuffer<AccCType>(&sums_, new_num_groups, 0));
+    return ResizeBuffer<int64_t>(&counts_, new_num_groups, 0);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    AccCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+
+    VisitArrayDataInline<ArrowType>(
+        *batch[0].array(),
+        [&](CType value) {
+          sums[*g] += value;
+          ++counts[*g++];
+        },
+        [&] { ++g; });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedSumImpl*>(&raw_other);
+    AccCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    const AccCType* other_sums = other->sums_.data();
+    const int64_t* other_counts = other->counts_.data();
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      sums[g[other_g]] += other_sums[other_g];
+      counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t length = sums_.length();
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          CountsToValidity(counts_.data(), length, pool_, &null_count));
+    std::shared_ptr<Buffer> sums;
+    RETURN_NOT_OK(sums_.Finish(&sums));
+    return ArrayData::Make(TypeTraits<AccType>::type_singleton(), length,
+                           {std::move(null_bitmap), std::move(sums)}, null_count);
+  }
+
+  MemoryPool* pool_;
+  TypedBufferBuilder<AccCType> sums_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+template <typename ArrowType>
+struct GroupedMeanImpl : public GroupedSumImpl<ArrowType> {
+  Result<Datum> Finalize() override {
+    const int64_t length = this->sums_.length();
+    const int64_t* counts = this->counts_.data();
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          CountsToValidity(counts, length, this->pool_, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> means,
+                          AllocateBuffer(length * sizeof(double), this->pool_));
+    auto raw_means = reinterpret_cast<double*>(means->mutable_data());
+    const auto* sums = this->sums_.data();
+    for (int64_t i = 0; i < length; ++i) {
+      raw_means[i] = counts[i] > 0 ? static_cast<double>(sums[i]) / counts[i] : 0;
+    }
+    return ArrayData::Make(float64(), length, {std::move(null_bitmap), std::move(means)},
+                           null_count);
+  }
+};
+
+// ----------------------------------------------------------------------
+// MinMax implementation
+
+template <typename CType>
+struct AntiExtrema {
+  static constexpr CType anti_min() { return std::numeric_limits<CType>::max(); }
+  static constexpr CType anti_max() { return std::numeric_limits<CType>::min(); }
+};
+
+template <>
+struct AntiExtrema<float> {
+  static constexpr float anti_min() { return std::numeric_limits<float>::infinity(); }
+  static constexpr float anti_max() { return -std::numeric_limits<float>::infinity(); }
+};
+
+template <>
+struct AntiExtrema<double> {
+  static constexpr double anti_min() { return std::numeric_limits<double>::infinity(); }
+  static constexpr double anti_max() { return -std::numeric_limits<double>::infinity(); }
+};
+
+// Like std::fmin / std::fmax, NaNs are ignored for floating point types
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> MinOf(T a, T b) {
+  return std::fmin(a, b);
+}
+
+template <typename T>
+enable_if_t<!std::is_floating_point<T>::value, T> MinOf(T a, T b) {
+  return std::min(a, b);
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> MaxOf(T a, T b) {
+  return std::fmax(a, b);
+}
+
+template <typename T>
+enable_if_t<!std::is_floating_point<T>::value, T> MaxOf(T a, T b) {
+  return std::max(a, b);
+}
+
+template <typename ArrowType>
+struct GroupedMinMaxImpl : public GroupedAggregator {
+  using CType = typename ArrowType::c_type;
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options) override {
+    options_ = static_cast<const MinMaxOptions&>(*options);
+    pool_ = ctx->memory_pool();
+    mins_ = TypedBufferBuilder<CType>(pool_);
+    maxes_ = TypedBufferBuilder<CType>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    null_counts_ = TypedBufferBuilder<int64_t>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    RETURN_NOT_OK(
+        ResizeBuffer<CType>(&mins_, new_num_groups, AntiExtrema<CType>::anti_min()));
+    RETURN_NOT_OK(
+        ResizeBuffer<CType>(&maxes_, new_num_groups, AntiExtrema<CType>::anti_max()));
+    RETURN_NOT_OK(ResizeBuffer<int64_t>(&counts_, new_num_groups, 0));
+    return ResizeBuffer<int64_t>(&null_counts_, new_num_groups, 0);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    CType* mins = mins_.mutable_data();
+    CType* maxes = maxes_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    int64_t* null_counts = null_counts_.mutable_data();
+    const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+
+    VisitArrayDataInline<ArrowType>(
+        *batch[0].array(),
+        [&](CType value) {
+          mins[*g] = MinOf(mins[*g], value);
+          maxes[*g] = MaxOf(maxes[*g], value);
+          ++counts[*g++];
+        },
+        [&] { ++null_counts[*g++]; });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedMinMaxImpl*>(&raw_other);
+    CType* mins = mins_.mutable_data();
+    CType* maxes = maxes_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    int64_t* null_counts = null_counts_.mutable_data();
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      mins[g[other_g]] = MinOf(mins[g[other_g]], other->mins_.data()[other_g]);
+      maxes[g[other_g]] = MaxOf(maxes[g[other_g]], other->maxes_.data()[other_g]);
+      counts[g[other_g]] += other->counts_.data()[other_g];
+      null_counts[g[other_g]] += other->null_counts_.data()[other_g];
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t length = mins_.length();
+    int64_t* counts = counts_.mutable_data();
+    if (options_.null_handling == MinMaxOptions::EMIT_NULL) {
+      // Any nulls in a group make its min and max null
+      const int64_t* null_counts = null_counts_.data();
+      for (int64_t i = 0; i < length; ++i) {
+        if (null_counts[i] > 0) counts[i] = 0;
+      }
+    }
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          CountsToValidity(counts, length, pool_, &null_count));
+
+    std::shared_ptr<Buffer> mins, maxes;
+    RETURN_NOT_OK(mins_.Finish(&mins));
+    RETURN_NOT_OK(maxes_.Finish(&maxes));
+    auto type = TypeTraits<ArrowType>::type_singleton();
+    auto min_data = ArrayData::Make(type, length, {null_bitmap, std::move(mins)},
+                                    null_count);
+    auto max_data = ArrayData::Make(type, length, {null_bitmap, std::move(maxes)},
+                                    null_count);
+    ARROW_ASSIGN_OR_RAISE(auto out,
+                          StructArray::Make({MakeArray(min_data), MakeArray(max_data)},
+                                            std::vector<std::string>{"min", "max"}));
+    return Datum(std::move(out));
+  }
+
+  MinMaxOptions options_;
+  MemoryPool* pool_;
+  TypedBufferBuilder<CType> mins_, maxes_;
+  TypedBufferBuilder<int64_t> counts_, null_counts_;
+};
+
+// ----------------------------------------------------------------------
+// Kernel plumbing
+
+void HashAggregateResize(KernelContext* ctx, int64_t num_groups) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Resize(num_groups));
+}
+
+void HashAggregateConsume(KernelContext* ctx, const ExecBatch& batch) {
+  KERNEL_RETURN_IF_ERROR(ctx,
+                         checked_cast<GroupedAggregator*>(ctx->state())->Consume(batch));
+}
+
+void HashAggregateMerge(KernelContext* ctx, KernelState&& other,
+                        const ArrayData& group_id_mapping) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())
+               ->Merge(std::move(checked_cast<GroupedAggregator&>(other)),
+                       group_id_mapping));
+}
+
+void HashAggregateFinalize(KernelContext* ctx, Datum* out) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Finalize().Value(out));
+}
+
+template <typename Impl>
+std::unique_ptr<KernelState> HashAggregateInit(KernelContext* ctx,
+                                               const KernelInitArgs& args) {
+  auto impl = ::arrow::internal::make_unique<Impl>();
+  ctx->SetStatus(impl->Init(ctx->exec_context(), args.options));
+  if (ctx->HasError()) return nullptr;
+  return std::move(impl);
+}
+
+// Resolve the KernelInit of a grouped aggregator templated on the value type
+template <template <typename> class Impl>
+struct HashAggregateInitFactory {
+  KernelInit init;
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Grouped aggregation of values of type ", type);
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Grouped aggregation of values of type ", type);
+  }
+
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    init = HashAggregateInit<Impl<Type>>;
+    return Status::OK();
+  }
+
+  static Result<KernelInit> Make(const DataType& type) {
+    HashAggregateInitFactory factory;
+    RETURN_NOT_OK(VisitTypeInline(type, &factory));
+    return std::move(factory.init);
+  }
+};
+
+HashAggregateKernel MakeHashAggKernel(std::shared_ptr<DataType> in_type,
+                                      std::shared_ptr<DataType> out_type,
+                                      KernelInit init) {
+  InputType in = in_type ? InputType::Array(std::move(in_type))
+                         : InputType(ValueDescr::ARRAY);
+  return HashAggregateKernel(
+      KernelSignature::Make({in, InputType::Array(uint32())},
+                            ValueDescr::Array(std::move(out_type))),
+      std::move(init), HashAggregateResize, HashAggregateConsume, HashAggregateMerge,
+      HashAggregateFinalize);
+}
+
+template <template <typename> class Impl>
+Status AddHashAggKernels(const std::vector<std::shared_ptr<DataType>>& types,
+                         std::function<std::shared_ptr<DataType>(
+                             const std::shared_ptr<DataType>&)> out_type,
+                         HashAggregateFunction* func) {
+  for (const auto& ty : types) {
+    ARROW_ASSIGN_OR_RAISE(auto init, HashAggregateInitFactory<Impl>::Make(*ty));
+    RETURN_NOT_OK(func->AddKernel(MakeHashAggKernel(ty, out_type(ty), std::move(init))));
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<DataType> SumOutType(const std::shared_ptr<DataType>& type) {
+  if (is_signed_integer(type->id())) return int64();
+  if (is_unsigned_integer(type->id())) return uint64();
+  return float64();
+}
+
+}  // namespace
+
+}  // namespace aggregate
+
+namespace internal {
+
+// ----------------------------------------------------------------------
+// GroupByAggregator
+
+struct GroupByAggregator::Impl {
+  ExecContext* ctx;
+  std::vector<Aggregate> aggregates;
+  std::vector<const HashAggregateKernel*> kernels;
+  std::vector<std::unique_ptr<KernelState>> states;
+  std::vector<KernelContext> kernel_ctxs;
+  std::unique_ptr<Grouper> grouper;
+
+  Status ResizeStates() {
+    for (size_t i = 0; i < kernels.size(); ++i) {
+      kernels[i]->resize(&kernel_ctxs[i], grouper->num_groups());
+      ARROW_CTX_RETURN_IF_ERROR(&kernel_ctxs[i]);
+    }
+    return Status::OK();
+  }
+};
+
+GroupByAggregator::GroupByAggregator(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+GroupByAggregator::~GroupByAggregator() = default;
+
+Result<std::unique_ptr<GroupByAggregator>> GroupByAggregator::Make(
+    const std::vector<ValueDescr>& argument_descrs,
+    const std::vector<ValueDescr>& key_descrs, const std::vector<Aggregate>& aggregates,
+    ExecContext* ctx) {
+  if (ctx == nullptr) {
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  if (argument_descrs.size() != aggregates.size()) {
+    return Status::Invalid("Got ", argument_descrs.size(), " arguments for ",
+                           aggregates.size(), " aggregates");
+  }
+
+  auto impl = ::arrow::internal::make_unique<Impl>();
+  impl->ctx = ctx;
+  impl->aggregates = aggregates;
+  ARROW_ASSIGN_OR_RAISE(impl->grouper, Grouper::Make(key_descrs, ctx));
+
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto func,
+                          ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (func->kind() != Function::HASH_AGGREGATE) {
+      return Status::Invalid("The provided function (", aggregates[i].function,
+                             ") is not a grouped aggregate function");
+    }
+    std::vector<ValueDescr> in_descrs = {argument_descrs[i],
+                                         ValueDescr::Array(uint32())};
+    ARROW_ASSIGN_OR_RAISE(
+        const HashAggregateKernel* kernel,
+        checked_cast<const HashAggregateFunction&>(*func).DispatchExact(in_descrs));
+
+    const FunctionOptions* options =
+        aggregates[i].options ? aggregates[i].options : func->default_options();
+    impl->kernel_ctxs.emplace_back(ctx);
+    KernelContext* kernel_ctx = &impl->kernel_ctxs.back();
+    auto state = kernel->init(kernel_ctx, KernelInitArgs{kernel, in_descrs, options});
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+
+    impl->kernels.push_back(kernel);
+    impl->states.push_back(std::move(state));
+  }
+  for (size_t i = 0; i < impl->states.size(); ++i) {
+    impl->kernel_ctxs[i].SetState(impl->states[i].get());
+  }
+  return std::unique_ptr<GroupByAggregator>(new GroupByAggregator(std::move(impl)));
+}
+
+Status GroupByAggregator::Consume(const ExecBatch& batch) {
+  const size_t num_arguments = impl_->kernels.size();
+  if (batch.num_values() < static_cast<int>(num_arguments)) {
+    return Status::Invalid("Expected at least ", num_arguments, " arguments but got ",
+                           batch.num_values());
+  }
+  ExecBatch keys(std::vector<Datum>(batch.values.begin() + num_arguments,
+                                    batch.values.end()),
+                 batch.length);
+  ARROW_ASSIGN_OR_RAISE(Datum group_ids, impl_->grouper->Consume(keys));
+  RETURN_NOT_OK(impl_->ResizeStates());
+
+  for (size_t i = 0; i < num_arguments; ++i) {
+    if (!batch[i].is_array()) {
+      return Status::NotImplemented("Grouped aggregation of non-array arguments");
+    }
+    impl_->kernels[i]->consume(&impl_->kernel_ctxs[i],
+                               ExecBatch({batch[i], group_ids}, batch.length));
+    ARROW_CTX_RETURN_IF_ERROR(&impl_->kernel_ctxs[i]);
+  }
+  return Status::OK();
+}
+
+Status GroupByAggregator::Merge(GroupByAggregator&& other) {
+  ARROW_ASSIGN_OR_RAISE(ExecBatch other_keys, other.impl_->grouper->GetUniques());
+  ARROW_ASSIGN_OR_RAISE(Datum group_id_mapping, impl_->grouper->Consume(other_keys));
+  RETURN_NOT_OK(impl_->ResizeStates());
+  RETURN_NOT_OK(other.impl_->ResizeStates());
+
+  for (size_t i = 0; i < impl_->kernels.size(); ++i) {
+    impl_->kernels[i]->merge(&impl_->kernel_ctxs[i], std::move(*other.impl_->states[i]),
+                             *group_id_mapping.array());
+    ARROW_CTX_RETURN_IF_ERROR(&impl_->kernel_ctxs[i]);
+  }
+  return Status::OK();
+}
+
+Result<Datum> GroupByAggregator::Finalize() {
+  RETURN_NOT_OK(impl_->ResizeStates());
+
+  ArrayVector fields;
+  std::vector<std::string> field_names;
+  for (size_t i = 0; i < impl_->kernels.size(); ++i) {
+    Datum out;
+    impl_->kernels[i]->finalize(&impl_->kernel_ctxs[i], &out);
+    ARROW_CTX_RETURN_IF_ERROR(&impl_->kernel_ctxs[i]);
+    fields.push_back(out.make_array());
+    field_names.push_back(impl_->aggregates[i].function);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, impl_->grouper->GetUniques());
+  for (int i = 0; i < uniques.num_values(); ++i) {
+    fields.push_back(uniques[i].make_array());
+    field_names.push_back("key_" + std::to_string(i));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto out, StructArray::Make(fields, field_names));
+  return Datum(std::move(out));
+}
+
+// ----------------------------------------------------------------------
+// GroupBy
+
+// When aggregating on multiple threads, inputs are split into batches of at
+// most this many rows so that large single-chunk inputs are parallelized too
+static constexpr int64_t kGroupByParallelChunksize = 1 << 16;
+
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return GroupBy(arguments, keys, aggregates, &default_ctx);
+  }
+
+  std::vector<Datum> args = arguments;
+  args.insert(args.end(), keys.begin(), keys.end());
+  for (const auto& arg : args) {
+    if (!arg.is_arraylike()) {
+      return Status::Invalid("GroupBy arguments and keys must be array-like");
+    }
+  }
+
+  std::vector<ValueDescr> argument_descrs, key_descrs;
+  for (const auto& argument : arguments) {
+    argument_descrs.push_back(argument.descr());
+  }
+  for (const auto& key : keys) {
+    key_descrs.push_back(key.descr());
+  }
+
+  int64_t chunksize = ctx->exec_chunksize();
+  if (ctx->use_threads()) {
+    chunksize = std::min(chunksize, kGroupByParallelChunksize);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto batch_iterator,
+                        compute::detail::ExecBatchIterator::Make(args, chunksize));
+  std::vector<ExecBatch> batches;
+  ExecBatch batch;
+  while (batch_iterator->Next(&batch)) {
+    if (batch.length > 0) {
+      batches.push_back(std::move(batch));
+    }
+  }
+
+  // Each thread consumes a strided subset of the batches into its own state,
+  // then the partial states are merged
+  int num_states = 1;
+  if (ctx->use_threads()) {
+    num_states = std::max(
+        1, std::min(static_cast<int>(batches.size()),
+                    GetCpuThreadPoolCapacity()));
+  }
+  std::vector<std::unique_ptr<GroupByAggregator>> states(num_states);
+  for (auto& state : states) {
+    ARROW_ASSIGN_OR_RAISE(
+        state, GroupByAggregator::Make(argument_descrs, key_descrs, aggregates, ctx));
+  }
+
+  auto task_group =
+      num_states > 1
+          ? ::arrow::internal::TaskGroup::MakeThreaded(
+                ::arrow::internal::GetCpuThreadPool())
+          : ::arrow::internal::TaskGroup::MakeSerial();
+  for (int i = 0; i < num_states; ++i) {
+    task_group->Append([&, i] {
+      for (size_t j = i; j < batches.size(); j += num_states) {
+        RETURN_NOT_OK(states[i]->Consume(batches[j]));
+      }
+      return Status::OK();
+    });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  for (int i = 1; i < num_states; ++i) {
+    RETURN_NOT_OK(states[0]->Merge(std::move(*states[i])));
+  }
+  return states[0]->Finalize();
+}
+
+// ----------------------------------------------------------------------
+// Registration
+
+void RegisterHashAggregateBasic(FunctionRegistry* registry) {
+  static auto default_count_options = CountOptions::Defaults();
+  auto func = std::make_shared<HashAggregateFunction>("hash_count", Arity::Binary(),
+                                                      &default_count_options);
+  DCHECK_OK(func->AddKernel(aggregate::MakeHashAggKernel(
+      NULLPTR, int64(), aggregate::HashAggregateInit<aggregate::GroupedCountImpl>)));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<HashAggregateFunction>("hash_sum", Arity::Binary());
+  DCHECK_OK(aggregate::AddHashAggKernels<aggregate::GroupedSumImpl>(
+      NumericTypes(), aggregate::SumOutType, func.get()));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<HashAggregateFunction>("hash_mean", Arity::Binary());
+  DCHECK_OK(aggregate::AddHashAggKernels<aggregate::GroupedMeanImpl>(
+      NumericTypes(), [](const std::shared_ptr<DataType>&) { return float64(); },
+      func.get()));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  static auto default_minmax_options = MinMaxOptions::Defaults();
+  func = std::make_shared<HashAggregateFunction>("hash_min_max", Arity::Binary(),
+                                                 &default_minmax_options);
+  DCHECK_OK(aggregate::AddHashAggKernels<aggregate::GroupedMinMaxImpl>(
+      NumericTypes(),
+      [](const std::shared_ptr<DataType>& ty) {
+        return struct_({field("min", ty), field("max", ty)});
+      },
+      func.get()));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,267 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+using internal::Aggregate;
+using internal::GroupBy;
+using internal::Grouper;
+using internal::GroupByAggregator;
+
+// Sort the rows of a GroupBy result by its first key so results can be
+// compared independently of group discovery order
+std::shared_ptr<Array> SortByFirstKey(const std::shared_ptr<Array>& result,
+                                      int key_field) {
+  const auto& struct_array = checked_cast<const StructArray&>(*result);
+  EXPECT_OK_AND_ASSIGN(auto indices, SortToIndices(*struct_array.field(key_field)));
+  EXPECT_OK_AND_ASSIGN(Datum sorted, Take(result, indices));
+  return sorted.make_array();
+}
+
+void AssertGroupByEquals(const std::shared_ptr<Array>& expected, const Datum& actual,
+                         int key_field) {
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertArraysEqual(*expected, *SortByFirstKey(actual.make_array(), key_field),
+                    /*verbose=*/true);
+}
+
+TEST(Grouper, SingleIntegerKey) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(int32())}));
+
+  ExecBatch batch({ArrayFromJSON(int32(), "[3, 1, null, 3, 1, 7]")}, 6);
+  ASSERT_OK_AND_ASSIGN(Datum group_ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 2, 0, 1, 3]"),
+                    *group_ids.make_array());
+
+  // Group ids are stable across batches
+  batch = ExecBatch({ArrayFromJSON(int32(), "[7, 8, null]")}, 3);
+  ASSERT_OK_AND_ASSIGN(group_ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[3, 4, 2]"), *group_ids.make_array());
+
+  ASSERT_EQ(5, grouper->num_groups());
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  ASSERT_EQ(1, uniques.num_values());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 1, null, 7, 8]"),
+                    *uniques[0].make_array());
+}
+
+TEST(Grouper, MultipleKeys) {
+  ASSERT_OK_AND_ASSIGN(auto grouper,
+                       Grouper::Make({ValueDescr::Array(utf8()),
+                                      ValueDescr::Array(boolean()),
+                                      ValueDescr::Array(int64())}));
+
+  ExecBatch batch({ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "a", "b"])"),
+                   ArrayFromJSON(boolean(), "[true, true, true, false, false, true]"),
+                   ArrayFromJSON(int64(), "[1, 1, 1, null, 1, 2]")},
+                  6);
+  ASSERT_OK_AND_ASSIGN(Datum group_ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 0, 2, 3, 4]"),
+                    *group_ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  ASSERT_EQ(3, uniques.num_values());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", null, "a", "b"])"),
+                    *uniques[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true, false, false, true]"),
+                    *uniques[1].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 1, null, 1, 2]"),
+                    *uniques[2].make_array());
+}
+
+TEST(Grouper, Find) {
+  struct {
+    std::shared_ptr<DataType> type;
+    std::string consumed;
+    std::string found;
+  } cases[] = {{int16(), "[3, 1, null, 3]", "[1, 5, null, 3, 5]"},
+               {utf8(), R"(["c", "a", null, "c"])", R"(["a", "e", null, "c", "e"])"}};
+
+  for (const auto& c : cases) {
+    ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(c.type)}));
+    ASSERT_OK(grouper->Consume(ExecBatch({ArrayFromJSON(c.type, c.consumed)}, 4)));
+
+    // Unknown keys are not inserted but found as null
+    ASSERT_OK_AND_ASSIGN(Datum group_ids,
+                         grouper->Find(ExecBatch({ArrayFromJSON(c.type, c.found)}, 5)));
+    AssertArraysEqual(*ArrayFromJSON(uint32(), "[1, null, 2, 0, null]"),
+                      *group_ids.make_array());
+    ASSERT_EQ(3, grouper->num_groups());
+  }
+}
+
+TEST(Grouper, UnsupportedKeyType) {
+  ASSERT_RAISES(NotImplemented,
+                Grouper::Make({ValueDescr::Array(list(int32())),
+                               ValueDescr::Array(int32())}));
+}
+
+TEST(GroupBy, SumOnly) {
+  auto argument = ArrayFromJSON(float64(), "[1.0, 0.0, null, 4.0, 3.25, 0.125, -0.25]");
+  auto key = ArrayFromJSON(int64(), "[1, 2, 3, null, 1, 2, 2]");
+
+  ASSERT_OK_AND_ASSIGN(Datum aggregated,
+                       GroupBy({argument}, {key}, {Aggregate{"hash_sum", NULLPTR}}));
+
+  AssertGroupByEquals(ArrayFromJSON(struct_({field("hash_sum", float64()),
+                                             field("key_0", int64())}),
+                                    R"([
+    [4.25,   1],
+    [-0.125, 2],
+    [null,   3],
+    [4.0,    null]
+  ])"),
+                      aggregated, /*key_field=*/1);
+}
+
+TEST(GroupBy, CountMeanMinMax) {
+  auto argument = ArrayFromJSON(int32(), "[1, 0, null, 4, 3, 5, -2, null]");
+  auto key = ArrayFromJSON(utf8(), R"(["x", "y", "z", "x", "x", "y", "y", "x"])");
+
+  CountOptions count_nulls(CountOptions::COUNT_NULL);
+  MinMaxOptions emit_null(MinMaxOptions::EMIT_NULL);
+  ASSERT_OK_AND_ASSIGN(Datum aggregated,
+                       GroupBy({argument, argument, argument, argument, argument},
+                               {key},
+                               {
+                                   {"hash_count", NULLPTR},
+                                   {"hash_count", &count_nulls},
+                                   {"hash_mean", NULLPTR},
+                                   {"hash_min_max", NULLPTR},
+                                   {"hash_min_max", &emit_null},
+                               }));
+
+  auto min_max_type = struct_({field("min", int32()), field("max", int32())});
+  AssertGroupByEquals(
+      ArrayFromJSON(struct_({field("hash_count", int64()), field("hash_count", int64()),
+                             field("hash_mean", float64()),
+                             field("hash_min_max", min_max_type),
+                             field("hash_min_max", min_max_type),
+                             field("key_0", utf8())}),
+                    R"([
+    [3, 1, 2.6666666666666665, {"min": 1, "max": 4}, {"min": null, "max": null}, "x"],
+    [3, 0, 1.0, {"min": -2, "max": 5}, {"min": -2, "max": 5}, "y"],
+    [0, 1, null, {"min": null, "max": null}, {"min": null, "max": null}, "z"]
+  ])"),
+      aggregated, /*key_field=*/5);
+}
+
+TEST(GroupBy, ChunkedInputs) {
+  auto argument = ChunkedArrayFromJSON(int64(), {"[1, 2, 3]", "[4, 5]", "[6]"});
+  auto key = ChunkedArrayFromJSON(int8(), {"[0, 1]", "[0, 1, 0]", "[2]"});
+
+  for (bool use_threads : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_threads(use_threads);
+    ctx.set_exec_chunksize(1);
+    ASSERT_OK_AND_ASSIGN(Datum aggregated,
+                         GroupBy({argument}, {key}, {Aggregate{"hash_sum", NULLPTR}},
+                                 &ctx));
+    AssertGroupByEquals(ArrayFromJSON(struct_({field("hash_sum", int64()),
+                                               field("key_0", int8())}),
+                                      "[[9, 0], [6, 1], [6, 2]]"),
+                        aggregated, /*key_field=*/1);
+  }
+}
+
+TEST(GroupBy, MergePartialStates) {
+  std::vector<ValueDescr> argument_descrs = {ValueDescr::Array(uint16())};
+  std::vector<ValueDescr> key_descrs = {ValueDescr::Array(utf8())};
+  std::vector<Aggregate> aggregates = {{"hash_sum", NULLPTR}};
+
+  ASSERT_OK_AND_ASSIGN(auto left, GroupByAggregator::Make(argument_descrs, key_descrs,
+                                                          aggregates));
+  ASSERT_OK_AND_ASSIGN(auto right, GroupByAggregator::Make(argument_descrs, key_descrs,
+                                                           aggregates));
+
+  ASSERT_OK(left->Consume(ExecBatch({ArrayFromJSON(uint16(), "[1, 2, 3]"),
+                                     ArrayFromJSON(utf8(), R"(["a", "b", "a"])")},
+                                    3)));
+  ASSERT_OK(right->Consume(ExecBatch({ArrayFromJSON(uint16(), "[10, 20, 30]"),
+                                      ArrayFromJSON(utf8(), R"(["c", "a", "c"])")},
+                                     3)));
+  ASSERT_OK(left->Merge(std::move(*right)));
+
+  ASSERT_OK_AND_ASSIGN(Datum aggregated, left->Finalize());
+  AssertGroupByEquals(ArrayFromJSON(struct_({field("hash_sum", uint64()),
+                                             field("key_0", utf8())}),
+                                    R"([[24, "a"], [2, "b"], [40, "c"]])"),
+                      aggregated, /*key_field=*/1);
+}
+
+TEST(GroupBy, RandomMatchesScalarAggregates) {
+  random::RandomArrayGenerator rng(42);
+  const int64_t length = 10000;
+  auto argument = rng.Float64(length, -100, 100, /*null_probability=*/0.1);
+  auto key = rng.Int32(length, 0, 15, /*null_probability=*/0);
+
+  ASSERT_OK_AND_ASSIGN(Datum aggregated,
+                       GroupBy({argument}, {key}, {Aggregate{"hash_sum", NULLPTR}}));
+  const auto& result = checked_cast<const StructArray&>(*aggregated.make_array());
+  const auto& sums = checked_cast<const DoubleArray&>(*result.field(0));
+  const auto& keys = checked_cast<const Int32Array&>(*result.field(1));
+
+  for (int64_t i = 0; i < result.length(); ++i) {
+    ASSERT_OK_AND_ASSIGN(
+        Datum mask, CallFunction("equal", {key, Datum(std::make_shared<Int32Scalar>(
+                                                    keys.Value(i)))}));
+    ASSERT_OK_AND_ASSIGN(Datum filtered, Filter(argument, mask));
+    ASSERT_OK_AND_ASSIGN(Datum expected, Sum(filtered));
+    ASSERT_NEAR(checked_cast<const DoubleScalar&>(*expected.scalar()).value,
+                sums.Value(i), 1e-6);
+  }
+}
+
+TEST(GroupBy, Errors) {
+  auto argument = ArrayFromJSON(int32(), "[1, 2]");
+  auto key = ArrayFromJSON(int32(), "[1, 2]");
+
+  ASSERT_RAISES(Invalid, GroupBy({argument}, {key}, {}));
+  ASSERT_RAISES(Invalid, GroupBy({argument}, {key}, {Aggregate{"sum", NULLPTR}}));
+  ASSERT_RAISES(NotImplemented,
+                GroupBy({ArrayFromJSON(utf8(), R"(["a", "b"])")}, {key},
+                        {Aggregate{"hash_sum", NULLPTR}}));
+  ASSERT_RAISES(NotImplemented, CallFunction("hash_sum", {argument, key}));
+}
+
+}  // namespace compute
+}  // namespace arrow
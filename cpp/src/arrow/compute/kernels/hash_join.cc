@@ -0,0 +1,362 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Hash join
+//
+// The right side is hashed with a Grouper (built on the memo tables of
+// arrow/util/hashing.h), which assigns a dense id to each distinct key. The
+// right rows are then bucketed by key id, so that the matches of a key are
+// a contiguous range of right row indices. Probing a left batch looks up the
+// key ids of its rows with the read-only Grouper::Find(), gathers the
+// matching (left, right) row pairs as two index arrays, and assembles the
+// output with the Take kernels.
+
+Result<std::vector<int>> GetKeyColumnIndices(const Schema& schema,
+                                             const std::vector<std::string>& names,
+                                             const char* side) {
+  std::vector<int> indices;
+  for (const auto& name : names) {
+    const int index = schema.GetFieldIndex(name);
+    if (index == -1) {
+      return Status::Invalid("No unique ", side, " join key column named '", name,
+                             "'");
+    }
+    indices.push_back(index);
+  }
+  return indices;
+}
+
+bool IsValid(const ArrayData& data, int64_t i) {
+  return data.GetNullCount() == 0 || data.buffers[0] == NULLPTR ||
+         BitUtil::GetBit(data.buffers[0]->data(), data.offset + i);
+}
+
+// Whether no key column is null at the given row
+bool AllKeysValid(const std::vector<const ArrayData*>& keys, int64_t row) {
+  for (const ArrayData* key : keys) {
+    if (!IsValid(*key, row)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+struct JoinHashTable::Impl {
+  JoinType join_type;
+  ExecContext* ctx;
+  int num_left_columns;
+  std::vector<int> left_key_indices;
+  std::shared_ptr<Schema> output_schema;
+
+  // The right columns, each as a single array
+  std::vector<std::shared_ptr<Array>> right_columns;
+
+  std::unique_ptr<internal::Grouper> grouper;
+  // The right rows having key id `k` are
+  // right_rows[key_offsets[k]] ... right_rows[key_offsets[k + 1] - 1]
+  std::vector<int64_t> key_offsets;
+  std::vector<int64_t> right_rows;
+
+  bool outputs_right_columns() const {
+    return join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER;
+  }
+
+  Status Build(const Table& right, const std::vector<int>& right_key_indices) {
+    ARROW_ASSIGN_OR_RAISE(auto combined, right.CombineChunks(ctx->memory_pool()));
+    for (const auto& column : combined->columns()) {
+      if (column->num_chunks() == 1) {
+        right_columns.push_back(column->chunk(0));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto empty,
+                              MakeArrayOfNull(column->type(), 0, ctx->memory_pool()));
+        right_columns.push_back(std::move(empty));
+      }
+    }
+
+    const int64_t num_rows = combined->num_rows();
+    ExecBatch right_keys({}, num_rows);
+    for (int index : right_key_indices) {
+      right_keys.values.emplace_back(right_columns[index]);
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum key_ids, grouper->Consume(right_keys));
+    const uint32_t* raw_key_ids = key_ids.array()->GetValues<uint32_t>(1);
+
+    // Bucket the right rows by key id with a counting sort, leaving out rows
+    // with a null key since these never match
+    std::vector<const ArrayData*> keys;
+    for (const auto& key : right_keys.values) {
+      keys.push_back(key.array().get());
+    }
+    key_offsets.assign(grouper->num_groups() + 1, 0);
+    for (int64_t row = 0; row < num_rows; ++row) {
+      if (AllKeysValid(keys, row)) {
+        ++key_offsets[raw_key_ids[row] + 1];
+      }
+    }
+    for (size_t i = 1; i < key_offsets.size(); ++i) {
+      key_offsets[i] += key_offsets[i - 1];
+    }
+    right_rows.resize(key_offsets.back());
+    std::vector<int64_t> positions(key_offsets.begin(), key_offsets.end() - 1);
+    for (int64_t row = 0; row < num_rows; ++row) {
+      if (AllKeysValid(keys, row)) {
+        right_rows[positions[raw_key_ids[row]]++] = row;
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<ExecBatch> Probe(const ExecBatch& left_batch) const {
+    if (left_batch.num_values() != num_left_columns) {
+      return Status::Invalid("Probed batch has ", left_batch.num_values(),
+                             " columns but the left side of the join has ",
+                             num_left_columns);
+    }
+    ExecBatch left_keys({}, left_batch.length);
+    for (int index : left_key_indices) {
+      left_keys.values.push_back(left_batch[index]);
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum key_ids, grouper->Find(left_keys));
+    const ArrayData& key_id_data = *key_ids.array();
+    const uint32_t* raw_key_ids = key_id_data.GetValues<uint32_t>(1);
+
+    TypedBufferBuilder<int64_t> left_indices(ctx->memory_pool());
+    TypedBufferBuilder<int64_t> right_indices(ctx->memory_pool());
+    // Only used for LEFT_OUTER, where unmatched rows take a null right index
+    TypedBufferBuilder<bool> right_validity(ctx->memory_pool());
+    RETURN_NOT_OK(left_indices.Reserve(left_batch.length));
+
+    for (int64_t row = 0; row < left_batch.length; ++row) {
+      int64_t match_begin = 0, match_end = 0;
+      if (IsValid(key_id_data, row)) {
+        match_begin = key_offsets[raw_key_ids[row]];
+        match_end = key_offsets[raw_key_ids[row] + 1];
+      }
+      const int64_t num_matches = match_end - match_begin;
+      switch (join_type) {
+        case JoinType::INNER:
+        case JoinType::LEFT_OUTER:
+          if (num_matches > 0) {
+            RETURN_NOT_OK(left_indices.Append(num_matches, row));
+            RETURN_NOT_OK(
+                right_indices.Append(right_rows.data() + match_begin, num_matches));
+            if (join_type == JoinType::LEFT_OUTER) {
+              RETURN_NOT_OK(right_validity.Append(num_matches, true));
+            }
+          } else if (join_type == JoinType::LEFT_OUTER) {
+            RETURN_NOT_OK(left_indices.Append(row));
+            RETURN_NOT_OK(right_indices.Append(0));
+            RETURN_NOT_OK(right_validity.Append(false));
+          }
+          break;
+        case JoinType::LEFT_SEMI:
+          if (num_matches > 0) {
+            RETURN_NOT_OK(left_indices.Append(row));
+          }
+          break;
+        case JoinType::LEFT_ANTI:
+          if (num_matches == 0) {
+            RETURN_NOT_OK(left_indices.Append(row));
+          }
+          break;
+      }
+    }
+
+    const int64_t out_length = left_indices.length();
+    std::shared_ptr<Buffer> left_indices_buf;
+    RETURN_NOT_OK(left_indices.Finish(&left_indices_buf));
+    auto left_take = std::make_shared<Int64Array>(out_length, left_indices_buf);
+
+    ExecBatch out({}, out_length);
+    const auto take_options = TakeOptions::NoBoundsCheck();
+    for (const auto& value : left_batch.values) {
+      ARROW_ASSIGN_OR_RAISE(Datum taken, Take(value, left_take, take_options, ctx));
+      out.values.push_back(std::move(taken));
+    }
+    if (!outputs_right_columns()) {
+      return out;
+    }
+
+    std::shared_ptr<Buffer> right_indices_buf, right_validity_buf;
+    int64_t right_null_count = 0;
+    RETURN_NOT_OK(right_indices.Finish(&right_indices_buf));
+    if (join_type == JoinType::LEFT_OUTER && right_validity.false_count() > 0) {
+      right_null_count = right_validity.false_count();
+      RETURN_NOT_OK(right_validity.Finish(&right_validity_buf));
+    }
+    auto right_take = std::make_shared<Int64Array>(out_length, right_indices_buf,
+                                                   right_validity_buf, right_null_count);
+    for (const auto& column : right_columns) {
+      ARROW_ASSIGN_OR_RAISE(Datum taken, Take(column, right_take, take_options, ctx));
+      out.values.push_back(std::move(taken));
+    }
+    return out;
+  }
+};
+
+JoinHashTable::JoinHashTable(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+JoinHashTable::~JoinHashTable() = default;
+
+Result<std::shared_ptr<JoinHashTable>> JoinHashTable::Make(
+    const std::shared_ptr<Schema>& left_schema, const Table& right,
+    const JoinOptions& options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    // The hash table outlives this call, so the context must be long-lived
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  if (options.left_keys.empty() ||
+      options.left_keys.size() != options.right_keys.size()) {
+    return Status::Invalid("A join needs the same non-zero number of left and right "
+                           "keys, got ",
+                           options.left_keys.size(), " and ", options.right_keys.size());
+  }
+
+  auto impl = ::arrow::internal::make_unique<Impl>();
+  impl->join_type = options.join_type;
+  impl->ctx = ctx;
+  impl->num_left_columns = left_schema->num_fields();
+  ARROW_ASSIGN_OR_RAISE(impl->left_key_indices,
+                        GetKeyColumnIndices(*left_schema, options.left_keys, "left"));
+  ARROW_ASSIGN_OR_RAISE(
+      auto right_key_indices,
+      GetKeyColumnIndices(*right.schema(), options.right_keys, "right"));
+
+  std::vector<ValueDescr> key_descrs;
+  for (size_t i = 0; i < right_key_indices.size(); ++i) {
+    const auto& left_type = left_schema->field(impl->left_key_indices[i])->type();
+    const auto& right_type = right.schema()->field(right_key_indices[i])->type();
+    if (!left_type->Equals(*right_type)) {
+      return Status::TypeError("Join keys '", options.left_keys[i], "' and '",
+                               options.right_keys[i], "' have different types ",
+                               *left_type, " and ", *right_type);
+    }
+    key_descrs.push_back(ValueDescr::Array(right_type));
+  }
+  ARROW_ASSIGN_OR_RAISE(impl->grouper, internal::Grouper::Make(key_descrs, ctx));
+
+  auto output_fields = left_schema->fields();
+  if (impl->outputs_right_columns()) {
+    for (const auto& field : right.schema()->fields()) {
+      output_fields.push_back(options.join_type == JoinType::LEFT_OUTER
+                                  ? field->WithNullable(true)
+                                  : field);
+    }
+  }
+  impl->output_schema = schema(std::move(output_fields));
+
+  RETURN_NOT_OK(impl->Build(right, right_key_indices));
+  return std::shared_ptr<JoinHashTable>(new JoinHashTable(std::move(impl)));
+}
+
+const std::shared_ptr<Schema>& JoinHashTable::output_schema() const {
+  return impl_->output_schema;
+}
+
+Result<ExecBatch> JoinHashTable::Probe(const ExecBatch& left_batch) const {
+  return impl_->Probe(left_batch);
+}
+
+Result<std::shared_ptr<RecordBatch>> JoinHashTable::Probe(
+    const RecordBatch& left_batch) const {
+  ExecBatch batch({}, left_batch.num_rows());
+  for (const auto& column : left_batch.columns()) {
+    batch.values.emplace_back(column);
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch out, Probe(batch));
+  std::vector<std::shared_ptr<Array>> columns;
+  for (const auto& value : out.values) {
+    columns.push_back(value.make_array());
+  }
+  return RecordBatch::Make(output_schema(), out.length, std::move(columns));
+}
+
+Result<std::shared_ptr<Table>> HashJoin(const Table& left, const Table& right,
+                                        const JoinOptions& options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return HashJoin(left, right, options, &default_ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto hash_table,
+                        JoinHashTable::Make(left.schema(), right, options, ctx));
+
+  std::vector<Datum> left_columns;
+  for (const auto& column : left.columns()) {
+    left_columns.emplace_back(column);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto batch_iterator, detail::ExecBatchIterator::Make(
+                                                 left_columns, ctx->exec_chunksize()));
+  std::vector<ExecBatch> left_batches;
+  ExecBatch batch;
+  while (batch_iterator->Next(&batch)) {
+    if (batch.length > 0) {
+      left_batches.push_back(std::move(batch));
+    }
+  }
+
+  // The hash table is shared read-only by all the probing tasks
+  std::vector<std::shared_ptr<RecordBatch>> out_batches(left_batches.size());
+  auto task_group = ctx->use_threads() && left_batches.size() > 1
+                        ? ::arrow::internal::TaskGroup::MakeThreaded(
+                              ::arrow::internal::GetCpuThreadPool())
+                        : ::arrow::internal::TaskGroup::MakeSerial();
+  for (size_t i = 0; i < left_batches.size(); ++i) {
+    task_group->Append([&, i] {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch joined, hash_table->Probe(left_batches[i]));
+      std::vector<std::shared_ptr<Array>> columns;
+      for (const auto& value : joined.values) {
+        columns.push_back(value.make_array());
+      }
+      out_batches[i] = RecordBatch::Make(hash_table->output_schema(), joined.length,
+                                         std::move(columns));
+      return Status::OK();
+    });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+  return Table::FromRecordBatches(hash_table->output_schema(), out_batches);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    left_schema_ = schema({field("id", int32()), field("name", utf8())});
+    right_schema_ = schema({field("key", int32()), field("value", float64())});
+    // Left rows 1 and 3 have no match, left row 2 has a null key
+    left_ = TableFromJSON(left_schema_, {R"([
+      [1, "a"],
+      [4, "b"]
+    ])",
+                                         R"([
+      [null, "c"],
+      [2, "d"],
+      [1, "e"]
+    ])"});
+    right_ = TableFromJSON(right_schema_, {R"([
+      [1, 0.5],
+      [3, 1.5],
+      [null, 2.5]
+    ])",
+                                           R"([
+      [1, 3.5],
+      [2, 4.5]
+    ])"});
+  }
+
+  void AssertJoin(JoinType join_type, const std::shared_ptr<Schema>& expected_schema,
+                  const std::string& expected_json) {
+    JoinOptions options(join_type, {"id"}, {"key"});
+    for (bool use_threads : {false, true}) {
+      ExecContext ctx;
+      ctx.set_use_threads(use_threads);
+      ctx.set_exec_chunksize(2);
+      ASSERT_OK_AND_ASSIGN(auto joined, HashJoin(*left_, *right_, options, &ctx));
+      ASSERT_OK(joined->ValidateFull());
+      AssertTablesEqual(*TableFromJSON(expected_schema, {expected_json}), *joined,
+                        /*same_chunk_layout=*/false);
+    }
+  }
+
+  std::shared_ptr<Schema> left_schema_, right_schema_;
+  std::shared_ptr<Table> left_, right_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  AssertJoin(JoinType::INNER,
+             schema({field("id", int32()), field("name", utf8()), field("key", int32()),
+                     field("value", float64())}),
+             R"([
+    [1, "a", 1, 0.5],
+    [1, "a", 1, 3.5],
+    [2, "d", 2, 4.5],
+    [1, "e", 1, 0.5],
+    [1, "e", 1, 3.5]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  AssertJoin(JoinType::LEFT_OUTER,
+             schema({field("id", int32()), field("name", utf8()), field("key", int32()),
+                     field("value", float64())}),
+             R"([
+    [1, "a", 1, 0.5],
+    [1, "a", 1, 3.5],
+    [4, "b", null, null],
+    [null, "c", null, null],
+    [2, "d", 2, 4.5],
+    [1, "e", 1, 0.5],
+    [1, "e", 1, 3.5]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  AssertJoin(JoinType::LEFT_SEMI, left_schema_, R"([
+    [1, "a"],
+    [2, "d"],
+    [1, "e"]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftAnti) {
+  AssertJoin(JoinType::LEFT_ANTI, left_schema_, R"([
+    [4, "b"],
+    [null, "c"]
+  ])");
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  auto left = TableFromJSON(schema({field("a", utf8()), field("b", int64())}), {R"([
+    ["x", 1],
+    ["x", 2],
+    ["y", 1],
+    [null, 1]
+  ])"});
+  auto right = TableFromJSON(schema({field("b", int64()), field("a", utf8())}), {R"([
+    [1, "y"],
+    [2, "x"],
+    [1, null]
+  ])"});
+  JoinOptions options(JoinType::LEFT_SEMI, {"a", "b"}, {"a", "b"});
+  ASSERT_OK_AND_ASSIGN(auto joined, HashJoin(*left, *right, options));
+  AssertTablesEqual(*TableFromJSON(left->schema(), {R"([["x", 2], ["y", 1]])"}),
+                    *joined, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestHashJoin, ProbeRecordBatches) {
+  ASSERT_OK_AND_ASSIGN(
+      auto hash_table,
+      JoinHashTable::Make(left_schema_, *right_,
+                          JoinOptions(JoinType::INNER, {"id"}, {"key"})));
+  auto batch = RecordBatchFromJSON(left_schema_, R"([[2, "x"], [5, "y"], [1, "z"]])");
+  ASSERT_OK_AND_ASSIGN(auto joined, hash_table->Probe(*batch));
+  ASSERT_OK(joined->ValidateFull());
+  AssertBatchesEqual(*RecordBatchFromJSON(hash_table->output_schema(), R"([
+    [2, "x", 2, 4.5],
+    [1, "z", 1, 0.5],
+    [1, "z", 1, 3.5]
+  ])"),
+                     *joined);
+
+  // An empty build side matches nothing
+  ASSERT_OK_AND_ASSIGN(
+      hash_table, JoinHashTable::Make(left_schema_, *TableFromJSON(right_schema_, {}),
+                                      JoinOptions(JoinType::LEFT_ANTI, {"id"}, {"key"})));
+  ASSERT_OK_AND_ASSIGN(joined, hash_table->Probe(*batch));
+  AssertBatchesEqual(*batch, *joined);
+}
+
+TEST_F(TestHashJoin, Errors) {
+  ASSERT_RAISES(Invalid,
+                HashJoin(*left_, *right_, JoinOptions(JoinType::INNER, {}, {})));
+  ASSERT_RAISES(Invalid,
+                HashJoin(*left_, *right_,
+                         JoinOptions(JoinType::INNER, {"id"}, {"key", "value"})));
+  ASSERT_RAISES(Invalid,
+                HashJoin(*left_, *right_, JoinOptions(JoinType::INNER, {"x"}, {"key"})));
+  ASSERT_RAISES(TypeError, HashJoin(*left_, *right_,
+                                    JoinOptions(JoinType::INNER, {"name"}, {"key"})));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -108,7 +108,8 @@ static void ArrayArrayKernel(benchmark::State& state) {
 
 void SetArgs(benchmark::internal::Benchmark* bench) {
   for (const auto size : {kL1Size, kL2Size}) {
-    for (const auto inverse_null_proportion : std::vector<ArgsType>({100, 0})) {
+    // 1%, 10% and 50% nulls, then no nulls
+    for (const auto inverse_null_proportion : std::vector<ArgsType>({100, 10, 2, 0})) {
       bench->Args({static_cast<ArgsType>(size), inverse_null_proportion});
     }
   }
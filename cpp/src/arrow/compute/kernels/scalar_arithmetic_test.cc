@@ -565,6 +565,63 @@ TYPED_TEST(TestBinaryArithmeticIntegral, DivideByZero) {
   }
 }
 
+TYPED_TEST(TestBinaryArithmeticIntegral, NullBlocks) {
+  // Long, sliced inputs so that the checked kernels see runs of 64 values that
+  // are all valid, all null or mixed.  Divisors are zero behind nulls, which
+  // must not be evaluated.
+  using ArrowType = typename TestFixture::ArrowType;
+  using CType = typename TestFixture::CType;
+  using BuilderType = typename TypeTraits<ArrowType>::BuilderType;
+  const int64_t length = 1000;
+  auto rand = random::RandomArrayGenerator(0x5416447);
+
+  for (double null_probability : {0.0, 0.01, 0.1, 0.5, 0.99, 1.0}) {
+    auto lhs = rand.Numeric<ArrowType>(length, 10, 20, null_probability)->Slice(3);
+    auto rhs_values = rand.Numeric<ArrowType>(length, 1, 5, 0)->Slice(5);
+    auto rhs_validity = rand.Boolean(length, 0.5, 0)->Slice(5);
+    BuilderType rhs_builder, expected_builder;
+    for (int64_t i = 0; i < lhs->length() - 2; ++i) {
+      auto divisor = checked_cast<const NumericArray<ArrowType>&>(*rhs_values).Value(i);
+      bool rhs_valid = null_probability == 0 ||
+                       checked_cast<const BooleanArray&>(*rhs_validity).Value(i);
+      if (rhs_valid) {
+        ASSERT_OK(rhs_builder.Append(divisor));
+      } else {
+        ASSERT_OK(rhs_builder.AppendNull());
+      }
+      if (rhs_valid && lhs->IsValid(i)) {
+        auto dividend = checked_cast<const NumericArray<ArrowType>&>(*lhs).Value(i);
+        ASSERT_OK(expected_builder.Append(static_cast<CType>(dividend / divisor)));
+      } else {
+        ASSERT_OK(expected_builder.AppendNull());
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto rhs, rhs_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto expected, expected_builder.Finish());
+    lhs = lhs->Slice(0, rhs->length());
+
+    for (auto check_overflow : {false, true}) {
+      this->SetOverflowCheck(check_overflow);
+      ASSERT_OK_AND_ASSIGN(Datum actual, Divide(lhs, rhs, this->options_));
+      this->ValidateAndAssertApproxEqual(actual.make_array(), expected);
+    }
+
+    // Checked kernels skip null slots, unchecked ones compute all slots
+    for (auto func : {Add, Subtract, Multiply}) {
+      this->SetOverflowCheck(false);
+      ASSERT_OK_AND_ASSIGN(Datum unchecked, func(lhs, rhs, this->options_, nullptr));
+      this->SetOverflowCheck(true);
+      ASSERT_OK_AND_ASSIGN(Datum checked, func(lhs, rhs, this->options_, nullptr));
+      this->ValidateAndAssertApproxEqual(checked.make_array(), unchecked.make_array());
+      ASSERT_OK_AND_ASSIGN(checked, func(lhs, *rhs->GetScalar(0), this->options_,
+                                         nullptr));
+      ASSERT_OK_AND_ASSIGN(unchecked, func(lhs, *rhs->GetScalar(0),
+                                           ArithmeticOptions(), nullptr));
+      this->ValidateAndAssertApproxEqual(checked.make_array(), unchecked.make_array());
+    }
+  }
+}
+
 TYPED_TEST(TestBinaryArithmeticFloating, DivideByZero) {
   this->SetOverflowCheck(true);
   this->AssertBinopRaises(Divide, "[3.0, 2.0, 6.0]", "[1.0, 1.0, 0.0]", "divide by zero");
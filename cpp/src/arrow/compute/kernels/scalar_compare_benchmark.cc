@@ -62,6 +62,22 @@ static void GreaterArrayScalarInt64(benchmark::State& state) {
   CompareArrayScalar<GREATER, Int64Type>(state);
 }
 
+static void GreaterArrayArrayDouble(benchmark::State& state) {
+  CompareArrayArray<GREATER, DoubleType>(state);
+}
+
+static void GreaterArrayScalarDouble(benchmark::State& state) {
+  CompareArrayScalar<GREATER, DoubleType>(state);
+}
+
+static void EqualArrayArrayInt32(benchmark::State& state) {
+  CompareArrayArray<EQUAL, Int32Type>(state);
+}
+
+static void EqualArrayScalarInt32(benchmark::State& state) {
+  CompareArrayScalar<EQUAL, Int32Type>(state);
+}
+
 static void GreaterArrayArrayString(benchmark::State& state) {
   CompareArrayArray<GREATER, StringType>(state);
 }
@@ -73,6 +89,11 @@ static void GreaterArrayScalarString(benchmark::State& state) {
 BENCHMARK(GreaterArrayArrayInt64)->Apply(RegressionSetArgs);
 BENCHMARK(GreaterArrayScalarInt64)->Apply(RegressionSetArgs);
 
+BENCHMARK(GreaterArrayArrayDouble)->Apply(RegressionSetArgs);
+BENCHMARK(GreaterArrayScalarDouble)->Apply(RegressionSetArgs);
+BENCHMARK(EqualArrayArrayInt32)->Apply(RegressionSetArgs);
+BENCHMARK(EqualArrayScalarInt32)->Apply(RegressionSetArgs);
+
 BENCHMARK(GreaterArrayArrayString)->Apply(RegressionSetArgs);
 BENCHMARK(GreaterArrayScalarString)->Apply(RegressionSetArgs);
 
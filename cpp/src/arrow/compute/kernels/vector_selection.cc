@@ -25,6 +25,7 @@
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
@@ -1893,29 +1894,470 @@ Result<std::shared_ptr<Array>> TakeAA(const Array& values, const Array& indices,
   return result.make_array();
 }
 
+// ----------------------------------------------------------------------
+// Take from a ChunkedArray without concatenating its chunks
+
+// Resolves logical indices into a chunked array to a chunk and an index within
+// that chunk.  Successive take indices frequently land in the same chunk, so
+// the last resolved chunk is checked before binary searching the chunk offsets.
+class ChunkResolver {
+ public:
+  struct Location {
+    int64_t chunk_index;
+    int64_t index_in_chunk;
+  };
+
+  explicit ChunkResolver(const ArrayVector& chunks) : offsets_(chunks.size() + 1, 0) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      offsets_[i + 1] = offsets_[i] + chunks[i]->length();
+    }
+  }
+
+  int64_t chunk_offset(int64_t chunk_index) const { return offsets_[chunk_index]; }
+
+  /// \brief Resolve a logical index, which must be in [0, total length)
+  Location Resolve(int64_t index) {
+    if (index < offsets_[cached_chunk_] || index >= offsets_[cached_chunk_ + 1]) {
+      // Last chunk starting at or before `index`, which skips empty chunks
+      auto it = std::upper_bound(offsets_.begin(), offsets_.end(), index);
+      cached_chunk_ = static_cast<int64_t>(it - offsets_.begin()) - 1;
+    }
+    return {cached_chunk_, index - offsets_[cached_chunk_]};
+  }
+
+ private:
+  std::vector<int64_t> offsets_;
+  int64_t cached_chunk_ = 0;
+};
+
+bool CanGatherFromChunks(const DataType& type) {
+  switch (type.id()) {
+    case Type::BINARY:
+    case Type::STRING:
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return true;
+    case Type::DICTIONARY:
+      // Chunks may have different dictionaries
+      return false;
+    default:
+      return is_fixed_width(type.id());
+  }
+}
+
+// Call visit_valid(position, index) or visit_null(position) for each of `indices`
+template <typename IndexCType, typename VisitValid, typename VisitNull>
+void VisitTakeIndices(const ArrayData& indices, VisitValid&& visit_valid,
+                      VisitNull&& visit_null) {
+  const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+  int64_t position = 0;
+  ::arrow::internal::VisitBitBlocksVoid(
+      indices.buffers[0], indices.offset, indices.length,
+      [&](int64_t i) { visit_valid(position++, static_cast<int64_t>(raw_indices[i])); },
+      [&]() { visit_null(position++); });
+}
+
+// Gather fixed-width values, including booleans, directly from the chunks
+template <typename IndexCType>
+Result<std::shared_ptr<ArrayData>> GatherFixedWidth(const ChunkedArray& values,
+                                                    ChunkResolver* resolver,
+                                                    const ArrayData& indices,
+                                                    MemoryPool* pool) {
+  const int bit_width = checked_cast<const FixedWidthType&>(*values.type()).bit_width();
+  const int64_t byte_width = bit_width / 8;
+  const int64_t length = indices.length;
+
+  std::vector<const uint8_t*> chunk_validity, chunk_values;
+  std::vector<int64_t> chunk_offsets;
+  for (const auto& chunk : values.chunks()) {
+    const ArrayData& data = *chunk->data();
+    chunk_validity.push_back(data.GetNullCount() > 0 ? data.buffers[0]->data() : NULLPTR);
+    // Empty chunks may have no values buffer
+    chunk_values.push_back(data.buffers[1] != NULLPTR ? data.buffers[1]->data()
+                                                      : NULLPTR);
+    chunk_offsets.push_back(data.offset);
+  }
+
+  std::shared_ptr<Buffer> out_validity;
+  uint8_t* out_bitmap = NULLPTR;
+  if (values.null_count() > 0 || indices.GetNullCount() > 0) {
+    ARROW_ASSIGN_OR_RAISE(out_validity, AllocateEmptyBitmap(length, pool));
+    out_bitmap = out_validity->mutable_data();
+  }
+  std::shared_ptr<Buffer> out_values;
+  if (bit_width == 1) {
+    ARROW_ASSIGN_OR_RAISE(out_values, AllocateEmptyBitmap(length, pool));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(out_values, AllocateBuffer(length * byte_width, pool));
+  }
+  uint8_t* out = out_values->mutable_data();
+
+  int64_t null_count = 0;
+  auto visit_null = [&](int64_t position) {
+    ++null_count;
+    if (bit_width != 1) {
+      std::memset(out + position * byte_width, 0, byte_width);
+    }
+  };
+  auto visit_valid = [&](int64_t position, int64_t index) {
+    const ChunkResolver::Location loc = resolver->Resolve(index);
+    const int64_t i = chunk_offsets[loc.chunk_index] + loc.index_in_chunk;
+    const uint8_t* validity = chunk_validity[loc.chunk_index];
+    if (validity != NULLPTR && !BitUtil::GetBit(validity, i)) {
+      return visit_null(position);
+    }
+    if (out_bitmap != NULLPTR) {
+      BitUtil::SetBit(out_bitmap, position);
+    }
+    const uint8_t* in = chunk_values[loc.chunk_index];
+    switch (byte_width) {
+      case 0:
+        if (BitUtil::GetBit(in, i)) {
+          BitUtil::SetBit(out, position);
+        }
+        break;
+      case 1:
+        out[position] = in[i];
+        break;
+      case 2:
+        std::memcpy(out + position * 2, in + i * 2, 2);
+        break;
+      case 4:
+        std::memcpy(out + position * 4, in + i * 4, 4);
+        break;
+      case 8:
+        std::memcpy(out + position * 8, in + i * 8, 8);
+        break;
+      default:
+        std::memcpy(out + position * byte_width, in + i * byte_width, byte_width);
+        break;
+    }
+  };
+  VisitTakeIndices<IndexCType>(indices, visit_valid, visit_null);
+
+  return ArrayData::Make(values.type(), length, {std::move(out_validity), out_values},
+                         null_count);
+}
+
+// Gather binary-like values directly from the chunks: a first pass computes
+// the output offsets, a second one copies the value bytes
+template <typename Type, typename IndexCType>
+Result<std::shared_ptr<ArrayData>> GatherBinary(const ChunkedArray& values,
+                                                ChunkResolver* resolver,
+                                                const ArrayData& indices,
+                                                MemoryPool* pool) {
+  using offset_type = typename Type::offset_type;
+  const int64_t length = indices.length;
+
+  std::vector<const uint8_t*> chunk_validity, chunk_data;
+  std::vector<const offset_type*> chunk_value_offsets;
+  std::vector<int64_t> chunk_offsets;
+  for (const auto& chunk : values.chunks()) {
+    const ArrayData& data = *chunk->data();
+    chunk_validity.push_back(data.GetNullCount() > 0 ? data.buffers[0]->data() : NULLPTR);
+    chunk_value_offsets.push_back(data.GetValues<offset_type>(1));
+    chunk_data.push_back(data.buffers[2] != NULLPTR ? data.buffers[2]->data() : NULLPTR);
+    chunk_offsets.push_back(data.offset);
+  }
+  auto is_valid = [&](const ChunkResolver::Location& loc) {
+    const uint8_t* validity = chunk_validity[loc.chunk_index];
+    return validity == NULLPTR ||
+           BitUtil::GetBit(validity,
+                           chunk_offsets[loc.chunk_index] + loc.index_in_chunk);
+  };
+
+  std::shared_ptr<Buffer> out_validity;
+  uint8_t* out_bitmap = NULLPTR;
+  if (values.null_count() > 0 || indices.GetNullCount() > 0) {
+    ARROW_ASSIGN_OR_RAISE(out_validity, AllocateEmptyBitmap(length, pool));
+    out_bitmap = out_validity->mutable_data();
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out_offsets_buffer,
+                        AllocateBuffer((length + 1) * sizeof(offset_type), pool));
+  auto out_offsets = reinterpret_cast<offset_type*>(out_offsets_buffer->mutable_data());
+
+  int64_t null_count = 0;
+  int64_t data_length = 0;
+  out_offsets[0] = 0;
+  VisitTakeIndices<IndexCType>(
+      indices,
+      [&](int64_t position, int64_t index) {
+        const ChunkResolver::Location loc = resolver->Resolve(index);
+        if (is_valid(loc)) {
+          const offset_type* value_offsets = chunk_value_offsets[loc.chunk_index];
+          data_length += value_offsets[loc.index_in_chunk + 1] -
+                         value_offsets[loc.index_in_chunk];
+          if (out_bitmap != NULLPTR) {
+            BitUtil::SetBit(out_bitmap, position);
+          }
+        } else {
+          ++null_count;
+        }
+        // Checked for overflow below, before any offset is used
+        out_offsets[position + 1] = static_cast<offset_type>(data_length);
+      },
+      [&](int64_t position) {
+        ++null_count;
+        out_offsets[position + 1] = static_cast<offset_type>(data_length);
+      });
+  if (data_length > std::numeric_limits<offset_type>::max()) {
+    return Status::CapacityError("Take result of ", data_length,
+                                 " bytes does not fit in a ", values.type()->ToString(),
+                                 " array");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out_data,
+                        AllocateBuffer(data_length, pool));
+  uint8_t* out = out_data->mutable_data();
+  VisitTakeIndices<IndexCType>(
+      indices,
+      [&](int64_t position, int64_t index) {
+        const int64_t value_length = out_offsets[position + 1] - out_offsets[position];
+        if (value_length > 0) {
+          const ChunkResolver::Location loc = resolver->Resolve(index);
+          const offset_type* value_offsets = chunk_value_offsets[loc.chunk_index];
+          std::memcpy(out + out_offsets[position],
+                      chunk_data[loc.chunk_index] + value_offsets[loc.index_in_chunk],
+                      value_length);
+        }
+      },
+      [](int64_t) {});
+
+  return ArrayData::Make(values.type(), length,
+                         {std::move(out_validity), std::move(out_offsets_buffer),
+                          std::move(out_data)},
+                         null_count);
+}
+
+template <typename IndexCType>
+Result<std::shared_ptr<ArrayData>> GatherFromChunksImpl(const ChunkedArray& values,
+                                                        ChunkResolver* resolver,
+                                                        const ArrayData& indices,
+                                                        MemoryPool* pool) {
+  switch (values.type()->id()) {
+    case Type::BINARY:
+    case Type::STRING:
+      return GatherBinary<BinaryType, IndexCType>(values, resolver, indices, pool);
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return GatherBinary<LargeBinaryType, IndexCType>(values, resolver, indices, pool);
+    default:
+      return GatherFixedWidth<IndexCType>(values, resolver, indices, pool);
+  }
+}
+
+Result<std::shared_ptr<ArrayData>> GatherFromChunks(const ChunkedArray& values,
+                                                    ChunkResolver* resolver,
+                                                    const ArrayData& indices,
+                                                    MemoryPool* pool) {
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return GatherFromChunksImpl<int8_t>(values, resolver, indices, pool);
+    case Type::INT16:
+      return GatherFromChunksImpl<int16_t>(values, resolver, indices, pool);
+    case Type::INT32:
+      return GatherFromChunksImpl<int32_t>(values, resolver, indices, pool);
+    case Type::INT64:
+      return GatherFromChunksImpl<int64_t>(values, resolver, indices, pool);
+    case Type::UINT8:
+      return GatherFromChunksImpl<uint8_t>(values, resolver, indices, pool);
+    case Type::UINT16:
+      return GatherFromChunksImpl<uint16_t>(values, resolver, indices, pool);
+    case Type::UINT32:
+      return GatherFromChunksImpl<uint32_t>(values, resolver, indices, pool);
+    default:
+      return GatherFromChunksImpl<uint64_t>(values, resolver, indices, pool);
+  }
+}
+
+// Take from a chunked array into a single array.  When the value type does not
+// allow gathering directly from the chunks, they are concatenated once into
+// `*concatenated` and the array take kernel is used instead.
+Result<std::shared_ptr<Array>> TakeChunksToArray(const ChunkedArray& values,
+                                                 ChunkResolver* resolver,
+                                                 const Array& indices,
+                                                 const TakeOptions& options,
+                                                 ExecContext* ctx,
+                                                 std::shared_ptr<Array>* concatenated) {
+  if (CanGatherFromChunks(*values.type()) && is_integer(indices.type_id())) {
+    const ArrayData& data = *indices.data();
+    if (options.boundscheck) {
+      RETURN_NOT_OK(CheckIndexBounds(data, static_cast<uint64_t>(values.length())));
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ArrayData> result,
+                          GatherFromChunks(values, resolver, data, ctx->memory_pool()));
+    return MakeArray(result);
+  }
+  if (*concatenated == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(*concatenated,
+                          Concatenate(values.chunks(), ctx->memory_pool()));
+  }
+  return TakeAA(**concatenated, indices, options, ctx);
+}
+
+template <typename IndexCType>
+bool IndicesAreSorted(const ArrayData& indices) {
+  if (indices.GetNullCount() > 0) {
+    return false;
+  }
+  const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+  for (int64_t i = 1; i < indices.length; ++i) {
+    if (raw_indices[i] < raw_indices[i - 1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Take sorted, non-null, boundschecked indices one values chunk at a time,
+// yielding one output chunk per values chunk hit by the indices.  Runs of
+// consecutive indices become zero-copy slices of the values chunk.
+template <typename IndexCType>
+Result<ArrayVector> TakeSortedChunks(const ChunkedArray& values,
+                                     ChunkResolver* resolver, const ArrayData& indices,
+                                     const TakeOptions& options, ExecContext* ctx) {
+  const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+  const int64_t length = indices.length;
+  // Indices are rebased to the chunk and have already been boundschecked
+  TakeOptions chunk_options = options;
+  chunk_options.boundscheck = false;
+
+  ArrayVector out_chunks;
+  int64_t start = 0;
+  while (start < length) {
+    const ChunkResolver::Location loc =
+        resolver->Resolve(static_cast<int64_t>(raw_indices[start]));
+    const int64_t chunk_offset = resolver->chunk_offset(loc.chunk_index);
+    const int64_t chunk_end = resolver->chunk_offset(loc.chunk_index + 1);
+    const int64_t end =
+        std::lower_bound(raw_indices + start, raw_indices + length, chunk_end,
+                         [](IndexCType index, int64_t bound) {
+                           return static_cast<int64_t>(index) < bound;
+                         }) -
+        raw_indices;
+    const auto& chunk = values.chunk(static_cast<int>(loc.chunk_index));
+
+    const int64_t run_length = end - start;
+    bool consecutive = true;
+    for (int64_t i = start + 1; i < end && consecutive; ++i) {
+      consecutive = raw_indices[i] == raw_indices[i - 1] + 1;
+    }
+    if (consecutive) {
+      out_chunks.push_back(chunk->Slice(loc.index_in_chunk, run_length));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Buffer> chunk_indices,
+          AllocateBuffer(run_length * sizeof(int64_t), ctx->memory_pool()));
+      auto rebased = reinterpret_cast<int64_t*>(chunk_indices->mutable_data());
+      for (int64_t i = start; i < end; ++i) {
+        rebased[i - start] = static_cast<int64_t>(raw_indices[i]) - chunk_offset;
+      }
+      Int64Array chunk_indices_array(run_length, std::move(chunk_indices));
+      ARROW_ASSIGN_OR_RAISE(auto out_chunk,
+                            TakeAA(*chunk, chunk_indices_array, chunk_options, ctx));
+      out_chunks.push_back(std::move(out_chunk));
+    }
+    start = end;
+  }
+  return out_chunks;
+}
+
+// If `indices` are sorted and non-null, take them chunk by chunk, otherwise
+// return an empty vector.
+Result<ArrayVector> TryTakeSortedChunks(const ChunkedArray& values,
+                                        ChunkResolver* resolver, const Array& indices,
+                                        const TakeOptions& options, ExecContext* ctx) {
+  const ArrayData& data = *indices.data();
+  if (!is_integer(indices.type_id()) || data.length == 0 || data.GetNullCount() > 0) {
+    return ArrayVector{};
+  }
+  bool sorted;
+  switch (indices.type_id()) {
+    case Type::INT8:
+      sorted = IndicesAreSorted<int8_t>(data);
+      break;
+    case Type::INT16:
+      sorted = IndicesAreSorted<int16_t>(data);
+      break;
+    case Type::INT32:
+      sorted = IndicesAreSorted<int32_t>(data);
+      break;
+    case Type::INT64:
+      sorted = IndicesAreSorted<int64_t>(data);
+      break;
+    case Type::UINT8:
+      sorted = IndicesAreSorted<uint8_t>(data);
+      break;
+    case Type::UINT16:
+      sorted = IndicesAreSorted<uint16_t>(data);
+      break;
+    case Type::UINT32:
+      sorted = IndicesAreSorted<uint32_t>(data);
+      break;
+    default:
+      sorted = IndicesAreSorted<uint64_t>(data);
+      break;
+  }
+  if (!sorted) {
+    return ArrayVector{};
+  }
+  if (options.boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(data, static_cast<uint64_t>(values.length())));
+  }
+  switch (indices.type_id()) {
+    case Type::INT8:
+      return TakeSortedChunks<int8_t>(values, resolver, data, options, ctx);
+    case Type::INT16:
+      return TakeSortedChunks<int16_t>(values, resolver, data, options, ctx);
+    case Type::INT32:
+      return TakeSortedChunks<int32_t>(values, resolver, data, options, ctx);
+    case Type::INT64:
+      return TakeSortedChunks<int64_t>(values, resolver, data, options, ctx);
+    case Type::UINT8:
+      return TakeSortedChunks<uint8_t>(values, resolver, data, options, ctx);
+    case Type::UINT16:
+      return TakeSortedChunks<uint16_t>(values, resolver, data, options, ctx);
+    case Type::UINT32:
+      return TakeSortedChunks<uint32_t>(values, resolver, data, options, ctx);
+    default:
+      return TakeSortedChunks<uint64_t>(values, resolver, data, options, ctx);
+  }
+}
+
 Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
                                              const Array& indices,
                                              const TakeOptions& options,
                                              ExecContext* ctx) {
   auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
+  std::vector<std::shared_ptr<Array>> new_chunks(1);
 
-  // Case 1: `values` has a single chunk, so just use it
-  if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
-  } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
+  // Case 1: `values` has a single chunk (or none), so just use it
+  if (num_chunks <= 1) {
+    std::shared_ptr<Array> current_chunk;
+    if (num_chunks == 1) {
+      current_chunk = values.chunk(0);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(current_chunk,
+                            MakeArrayOfNull(values.type(), 0, ctx->memory_pool()));
+    }
+    ARROW_ASSIGN_OR_RAISE(new_chunks[0], TakeAA(*current_chunk, indices, options, ctx));
+    return std::make_shared<ChunkedArray>(std::move(new_chunks));
+  }
 
-    // Case 4: Else, concatenate chunks and call Array Take
-    ARROW_ASSIGN_OR_RAISE(current_chunk,
-                          Concatenate(values.chunks(), ctx->memory_pool()));
+  ChunkResolver resolver(values.chunks());
+  // Case 2: sorted indices, take from each values chunk they hit and keep the
+  // output chunked along the same boundaries
+  ARROW_ASSIGN_OR_RAISE(new_chunks,
+                        TryTakeSortedChunks(values, &resolver, indices, options, ctx));
+  if (!new_chunks.empty()) {
+    return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
   }
-  // Call Array Take on our single chunk
-  ARROW_ASSIGN_OR_RAISE(new_chunks[0], TakeAA(*current_chunk, indices, options, ctx));
+
+  // Case 3: gather into a single output chunk
+  std::shared_ptr<Array> concatenated;
+  new_chunks.resize(1);
+  ARROW_ASSIGN_OR_RAISE(new_chunks[0], TakeChunksToArray(values, &resolver, indices,
+                                                         options, ctx, &concatenated));
   return std::make_shared<ChunkedArray>(std::move(new_chunks));
 }
 
@@ -1925,17 +2367,25 @@ Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
                                              ExecContext* ctx) {
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
+  if (values.num_chunks() <= 1) {
+    for (int i = 0; i < num_chunks; i++) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
+                            TakeCA(values, *indices.chunk(i), options, ctx));
+      new_chunks[i] = current_chunk->chunk(0);
+    }
+    return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
+  }
+  // The resolver and, if needed, the concatenated values are shared by all
+  // indices chunks
+  ChunkResolver resolver(values.chunks());
+  std::shared_ptr<Array> concatenated;
   for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
-                          TakeCA(values, *indices.chunk(i), options, ctx));
-    // Concatenate the result to make a single array for this chunk
+    // Take with that indices chunk, yielding one output chunk
     ARROW_ASSIGN_OR_RAISE(new_chunks[i],
-                          Concatenate(current_chunk->chunks(), ctx->memory_pool()));
+                          TakeChunksToArray(values, &resolver, *indices.chunk(i), options,
+                                            ctx, &concatenated));
   }
-  return std::make_shared<ChunkedArray>(std::move(new_chunks));
+  return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
 }
 
 Result<std::shared_ptr<ChunkedArray>> TakeAC(const Array& values,
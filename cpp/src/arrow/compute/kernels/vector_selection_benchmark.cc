@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <sstream>
 
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -106,14 +107,17 @@ struct TakeBenchmark {
   random::RandomArrayGenerator rand;
   bool indices_have_nulls;
   bool monotonic_indices = false;
+  // If greater than 1, take from a ChunkedArray with this many chunks
+  int num_chunks = 1;
 
   TakeBenchmark(benchmark::State& state, bool indices_have_nulls,
-                bool monotonic_indices = false)
+                bool monotonic_indices = false, int num_chunks = 1)
       : state(state),
         args(state, /*size_is_bytes=*/false),
         rand(kSeed),
         indices_have_nulls(indices_have_nulls),
-        monotonic_indices(monotonic_indices) {}
+        monotonic_indices(monotonic_indices),
+        num_chunks(num_chunks) {}
 
   void Int64() {
     auto values = rand.Int64(args.size, -100, 100, args.null_proportion);
@@ -146,6 +150,21 @@ struct TakeBenchmark {
       indices = *Take(*indices, *arg_sorter);
     }
 
+    if (num_chunks > 1) {
+      ArrayVector chunks;
+      const int64_t chunk_length = values->length() / num_chunks;
+      for (int i = 0; i < num_chunks; ++i) {
+        const int64_t length =
+            i == num_chunks - 1 ? values->length() - i * chunk_length : chunk_length;
+        chunks.push_back(values->Slice(i * chunk_length, length));
+      }
+      auto chunked_values = std::make_shared<ChunkedArray>(std::move(chunks));
+      for (auto _ : state) {
+        ABORT_NOT_OK(Take(chunked_values, indices).status());
+      }
+      return;
+    }
+
     for (auto _ : state) {
       ABORT_NOT_OK(Take(values, indices).status());
     }
@@ -303,6 +322,26 @@ static void TakeStringMonotonicIndices(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).FSLInt64();
 }
 
+static void TakeChunkedInt64RandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, false, /*monotonic=*/false, /*num_chunks=*/64).Int64();
+}
+
+static void TakeChunkedInt64MonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, false, /*monotonic=*/true, /*num_chunks=*/64).Int64();
+}
+
+static void TakeChunkedStringRandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, false, /*monotonic=*/false, /*num_chunks=*/64).String();
+}
+
+static void TakeChunkedStringMonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, false, /*monotonic=*/true, /*num_chunks=*/64).String();
+}
+
+static void TakeChunkedFSLInt64RandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, false, /*monotonic=*/false, /*num_chunks=*/64).FSLInt64();
+}
+
 void FilterSetArgs(benchmark::internal::Benchmark* bench) {
   for (int64_t size : g_data_sizes) {
     for (int i = 0; i < static_cast<int>(g_filter_params.size()); ++i) {
@@ -344,6 +383,11 @@ BENCHMARK(TakeFSLInt64MonotonicIndices)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringMonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedInt64MonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringMonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedFSLInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
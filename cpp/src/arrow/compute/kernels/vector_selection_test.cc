@@ -1477,6 +1477,58 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArrayWithoutConcatenation) {
+  // Unsorted indices are gathered into a single chunk
+  this->AssertTake(int8(), {"[7, null]", "[]", "[8, 9]"}, "[3, null, 1, 0, 2]",
+                   {"[9, null, null, 7, 8]"});
+  this->AssertTake(boolean(), {"[true, null]", "[false, true]"}, "[2, 3, 1, 0]",
+                   {"[false, true, null, true]"});
+  this->AssertTake(utf8(), {R"(["a", null])", R"([])", R"(["bc", ""])"},
+                   "[3, 1, null, 2, 0]", {R"(["", null, null, "bc", "a"])"});
+  this->AssertTake(large_utf8(), {R"(["a", "b"])", R"(["cd"])"}, "[2, 0, 2]",
+                   {R"(["cd", "a", "cd"])"});
+  this->AssertTake(list(int8()), {"[[1], null]", "[[2, 3]]"}, "[2, 1, 0]",
+                   {"[[2, 3], null, [1]]"});
+
+  // Sorted indices keep the output chunked along the values chunks
+  this->AssertTake(int8(), {"[7]", "[8, 9]"}, "[0, 1]", {"[7]", "[8]"});
+  this->AssertTake(int8(), {"[1, 2, 3]", "[]", "[4, 5]"}, "[0, 0, 2, 4]",
+                   {"[1, 1, 3]", "[5]"});
+  this->AssertTake(utf8(), {R"(["a", "b", "c"])", R"(["d"])"}, "[1, 2, 3]",
+                   {R"(["b", "c"])", R"(["d"])"});
+  this->AssertTake(list(int8()), {"[[1], null]", "[[2, 3]]"}, "[0, 0, 2]",
+                   {"[[1], [1]]", "[[2, 3]]"});
+
+  // Indices chunks are gathered one output chunk each
+  this->AssertChunkedTake(utf8(), {R"(["a"])", R"(["b", null])"},
+                          {"[2, 0]", "[]", "[1, 1]"},
+                          {R"([null, "a"])", R"([])", R"(["b", "b"])"});
+
+  std::shared_ptr<ChunkedArray> arr;
+  ASSERT_RAISES(IndexError,
+                this->TakeWithArray(utf8(), {R"(["a"])", R"(["b"])"}, "[2, 0]", &arr));
+  ASSERT_RAISES(IndexError,
+                this->TakeWithArray(int8(), {"[7]", "[8, 9]"}, "[0, 3]", &arr));
+  ASSERT_RAISES(IndexError, this->TakeWithArray(int8(), {"[7]", "[8, 9]"}, "[-1]", &arr));
+}
+
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArrayWithEmptyUnallocatedChunk) {
+  // A zero-length chunk may have no buffers at all
+  auto empty = MakeArray(ArrayData::Make(int32(), 0, {nullptr, nullptr}));
+  auto values = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[1, 2]"), empty, ArrayFromJSON(int32(), "[3, null]")});
+
+  // Unsorted indices are gathered, sorted ones sliced from the chunks
+  ASSERT_OK_AND_ASSIGN(auto taken,
+                       Take(Datum(values), Datum(ArrayFromJSON(int8(), "[3, 0, 2]"))));
+  AssertChunkedEqual(ChunkedArray({ArrayFromJSON(int32(), "[null, 1, 3]")}),
+                     *taken.chunked_array());
+  ASSERT_OK_AND_ASSIGN(taken,
+                       Take(Datum(values), Datum(ArrayFromJSON(int8(), "[1, 2]"))));
+  AssertChunkedEquivalent(ChunkedArray({ArrayFromJSON(int32(), "[2, 3]")}),
+                          *taken.chunked_array());
+}
+
 class TestTakeKernelWithTable : public TestTakeKernel<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
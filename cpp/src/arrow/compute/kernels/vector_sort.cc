@@ -22,6 +22,8 @@
 #include "arrow/array/data.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/util/optional.h"
 
 namespace arrow {
@@ -117,7 +119,8 @@ class CompareSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
 
  public:
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+            SortOrder order) {
     std::iota(indices_begin, indices_end, 0);
 
     auto nulls_begin = indices_end;
@@ -126,10 +129,17 @@ class CompareSorter {
           std::stable_partition(indices_begin, indices_end,
                                 [&values](uint64_t ind) { return !values.IsNull(ind); });
     }
-    std::stable_sort(indices_begin, nulls_begin,
-                     [&values](uint64_t left, uint64_t right) {
-                       return values.GetView(left) < values.GetView(right);
-                     });
+    if (order == SortOrder::Ascending) {
+      std::stable_sort(indices_begin, nulls_begin,
+                       [&values](uint64_t left, uint64_t right) {
+                         return values.GetView(left) < values.GetView(right);
+                       });
+    } else {
+      std::stable_sort(indices_begin, nulls_begin,
+                       [&values](uint64_t left, uint64_t right) {
+                         return values.GetView(right) < values.GetView(left);
+                       });
+    }
   }
 };
 
@@ -149,12 +159,13 @@ class CountSorter {
     value_range_ = static_cast<uint32_t>(max - min) + 1;
   }
 
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+            SortOrder order) {
     // 32bit counter performs much better than 64bit one
     if (values.length() < (1LL << 32)) {
-      SortInternal<uint32_t>(indices_begin, indices_end, values);
+      SortInternal<uint32_t>(indices_begin, indices_end, values, order);
     } else {
-      SortInternal<uint64_t>(indices_begin, indices_end, values);
+      SortInternal<uint64_t>(indices_begin, indices_end, values, order);
     }
   }
 
@@ -164,14 +175,22 @@ class CountSorter {
 
   template <typename CounterType>
   void SortInternal(uint64_t* indices_begin, uint64_t* indices_end,
-                    const ArrayType& values) {
+                    const ArrayType& values, SortOrder order) {
     const uint32_t value_range = value_range_;
 
+    // Descending order simply reverses the slot assigned to each value
+    const uint32_t last_slot = value_range - 1;
+    const bool ascending = order == SortOrder::Ascending;
+    auto slot = [&](c_type v) -> uint32_t {
+      const auto offset = static_cast<uint32_t>(v - min_);
+      return ascending ? offset : last_slot - offset;
+    };
+
     // first slot reserved for prefix sum
     std::vector<CounterType> counts(1 + value_range);
 
     VisitRawValuesInline(
-        values, [&](c_type v) { ++counts[v - min_ + 1]; }, []() {});
+        values, [&](c_type v) { ++counts[slot(v) + 1]; }, []() {});
 
     for (uint32_t i = 1; i <= value_range; ++i) {
       counts[i] += counts[i - 1];
@@ -179,7 +198,7 @@ class CountSorter {
 
     int64_t index = 0;
     VisitRawValuesInline(
-        values, [&](c_type v) { indices_begin[counts[v - min_]++] = index++; },
+        values, [&](c_type v) { indices_begin[counts[slot(v)]++] = index++; },
         [&]() { indices_begin[counts[value_range]++] = index++; });
   }
 };
@@ -193,7 +212,8 @@ class CountOrCompareSorter {
   using c_type = typename ArrowType::c_type;
 
  public:
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+            SortOrder order) {
     if (values.length() >= countsort_min_len_ && values.length() > values.null_count()) {
       c_type min{std::numeric_limits<c_type>::max()};
       c_type max{std::numeric_limits<c_type>::min()};
@@ -211,12 +231,12 @@ class CountOrCompareSorter {
       if (static_cast<uint64_t>(max) - static_cast<uint64_t>(min) <=
           countsort_max_range_) {
         count_sorter_.SetMinMax(min, max);
-        count_sorter_.Sort(indices_begin, indices_end, values);
+        count_sorter_.Sort(indices_begin, indices_end, values, order);
         return;
       }
     }
 
-    compare_sorter_.Sort(indices_begin, indices_end, values);
+    compare_sorter_.Sort(indices_begin, indices_end, values, order);
   }
 
  private:
@@ -263,8 +283,15 @@ struct Sorter<Type, enable_if_t<is_floating_type<Type>::value ||
   CompareSorter<Type> impl;
 };
 
+namespace {
+
+// ----------------------------------------------------------------------
+// array_sort_indices implementation
+
+using ArraySortIndicesState = internal::OptionsWrapper<ArraySortOptions>;
+
 template <typename OutType, typename InType>
-struct SortIndices {
+struct ArraySortIndices {
   using ArrayType = typename TypeTraits<InType>::ArrayType;
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     std::shared_ptr<ArrayData> arg0;
@@ -277,10 +304,390 @@ struct SortIndices {
     uint64_t* out_end = out_begin + arr.length();
 
     Sorter<InType> sorter;
-    sorter.impl.Sort(out_begin, out_end, arr);
+    sorter.impl.Sort(out_begin, out_end, arr, ArraySortIndicesState::Get(ctx).order);
+  }
+};
+
+// ----------------------------------------------------------------------
+// sort_indices implementation for chunked arrays, record batches and tables
+//
+// The sort key columns are split into batches with identical boundaries, so a
+// row is addressed by a (batch, index) pair for every key. Each batch is
+// first sorted on its own with the single array sorters above (which use a
+// counting sort for narrow integer keys), ties of the leading key are then
+// ordered by the remaining keys, and finally the sorted batches are merged.
+// No chunk is ever concatenated or copied.
+
+// Three-way comparison of two rows of one sort key; nulls sort after
+// non-null values regardless of the sort order
+class SortKeyComparator {
+ public:
+  virtual ~SortKeyComparator() = default;
+
+  virtual int Compare(int64_t left_batch, uint64_t left_index, int64_t right_batch,
+                      uint64_t right_index) const = 0;
+
+  // Write the indices that sort the given batch by this key alone
+  virtual void SortBatch(int64_t batch, uint64_t* indices_begin,
+                         uint64_t* indices_end) const = 0;
+};
+
+template <typename ArrowType>
+class TypedSortKeyComparator : public SortKeyComparator {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  explicit TypedSortKeyComparator(SortOrder order) : order_(order) {}
+
+  Status Init(const std::vector<std::shared_ptr<Array>>& batches) {
+    for (const auto& batch : batches) {
+      std::shared_ptr<ArrayData> data;
+      RETURN_NOT_OK(
+          GetPhysicalView(batch->data(), TypeTraits<ArrowType>::type_singleton(), &data));
+      null_count_ += batch->null_count();
+      arrays_.push_back(std::make_shared<ArrayType>(std::move(data)));
+    }
+    return Status::OK();
+  }
+
+  int Compare(int64_t left_batch, uint64_t left_index, int64_t right_batch,
+              uint64_t right_index) const override {
+    const ArrayType& left = *arrays_[left_batch];
+    const ArrayType& right = *arrays_[right_batch];
+    if (null_count_ > 0) {
+      const bool left_null = left.IsNull(left_index);
+      const bool right_null = right.IsNull(right_index);
+      if (left_null || right_null) {
+        return static_cast<int>(left_null) - static_cast<int>(right_null);
+      }
+    }
+    const auto left_value = left.GetView(left_index);
+    const auto right_value = right.GetView(right_index);
+    int compared = 0;
+    if (left_value < right_value) {
+      compared = -1;
+    } else if (right_value < left_value) {
+      compared = 1;
+    }
+    return order_ == SortOrder::Ascending ? compared : -compared;
+  }
+
+  void SortBatch(int64_t batch, uint64_t* indices_begin,
+                 uint64_t* indices_end) const override {
+    Sorter<ArrowType> sorter;
+    sorter.impl.Sort(indices_begin, indices_end, *arrays_[batch], order_);
+  }
+
+ private:
+  SortOrder order_;
+  int64_t null_count_ = 0;
+  std::vector<std::shared_ptr<ArrayType>> arrays_;
+};
+
+struct SortKeyComparatorFactory {
+  template <typename Type>
+  enable_if_t<is_integer_type<Type>::value || is_floating_type<Type>::value ||
+                  is_base_binary_type<Type>::value,
+              Status>
+  Visit(const Type&) {
+    auto comparator = ::arrow::internal::make_unique<TypedSortKeyComparator<Type>>(order);
+    RETURN_NOT_OK(comparator->Init(*batches));
+    out = std::move(comparator);
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) { return Unsupported(type); }
+
+  Status Visit(const DataType& type) { return Unsupported(type); }
+
+  Status Unsupported(const DataType& type) {
+    return Status::NotImplemented("Sorting by a column of type ", type,
+                                  " is not supported");
+  }
+
+  const std::vector<std::shared_ptr<Array>>* batches;
+  SortOrder order;
+  std::unique_ptr<SortKeyComparator> out;
+};
+
+// A sort key column split into batches, see MultipleKeySorter
+struct BatchedSortKey {
+  std::shared_ptr<DataType> type;
+  std::vector<std::shared_ptr<Array>> batches;
+  SortOrder order;
+};
+
+class MultipleKeySorter {
+ public:
+  // All keys must have the same number of batches, with equal lengths
+  static Result<std::shared_ptr<Array>> Sort(const std::vector<BatchedSortKey>& keys,
+                                             int64_t length, MemoryPool* pool) {
+    MultipleKeySorter sorter;
+    RETURN_NOT_OK(sorter.Init(keys));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                          AllocateBuffer(length * sizeof(uint64_t), pool));
+    auto indices_begin = reinterpret_cast<uint64_t*>(indices->mutable_data());
+    sorter.SortBatches(indices_begin);
+    sorter.MergeBatches(indices_begin);
+    return std::make_shared<UInt64Array>(length, std::move(indices));
+  }
+
+ private:
+  Status Init(const std::vector<BatchedSortKey>& keys) {
+    DCHECK(!keys.empty());
+    batch_offsets_.push_back(0);
+    for (const auto& batch : keys[0].batches) {
+      batch_offsets_.push_back(batch_offsets_.back() + batch->length());
+    }
+    for (const auto& key : keys) {
+      DCHECK_EQ(key.batches.size(), keys[0].batches.size());
+      SortKeyComparatorFactory factory{&key.batches, key.order, NULLPTR};
+      RETURN_NOT_OK(VisitTypeInline(*key.type, &factory));
+      comparators_.push_back(std::move(factory.out));
+    }
+    return Status::OK();
+  }
+
+  int64_t num_batches() const { return static_cast<int64_t>(batch_offsets_.size()) - 1; }
+
+  // Compare two rows of the same or different batches on the keys from
+  // `first_key` onwards
+  int Compare(int64_t left_batch, uint64_t left_index, int64_t right_batch,
+              uint64_t right_index, size_t first_key = 0) const {
+    for (size_t i = first_key; i < comparators_.size(); ++i) {
+      int compared =
+          comparators_[i]->Compare(left_batch, left_index, right_batch, right_index);
+      if (compared != 0) {
+        return compared;
+      }
+    }
+    return 0;
+  }
+
+  void SortBatches(uint64_t* indices) const {
+    for (int64_t batch = 0; batch < num_batches(); ++batch) {
+      uint64_t* begin = indices + batch_offsets_[batch];
+      uint64_t* end = indices + batch_offsets_[batch + 1];
+      comparators_[0]->SortBatch(batch, begin, end);
+
+      if (comparators_.size() > 1) {
+        // Order each run of rows equal on the leading key by the other keys
+        auto less = [&](uint64_t left, uint64_t right) {
+          return Compare(batch, left, batch, right, /*first_key=*/1) < 0;
+        };
+        uint64_t* run_begin = begin;
+        while (run_begin != end) {
+          uint64_t* run_end = run_begin + 1;
+          while (run_end != end &&
+                 comparators_[0]->Compare(batch, *run_begin, batch, *run_end) == 0) {
+            ++run_end;
+          }
+          if (run_end - run_begin > 1) {
+            std::stable_sort(run_begin, run_end, less);
+          }
+          run_begin = run_end;
+        }
+      }
+
+      // Turn batch-local indices into logical row numbers
+      const auto offset = static_cast<uint64_t>(batch_offsets_[batch]);
+      if (offset != 0) {
+        for (uint64_t* it = begin; it != end; ++it) {
+          *it += offset;
+        }
+      }
+    }
+  }
+
+  int64_t ResolveBatch(uint64_t index) const {
+    auto it = std::upper_bound(batch_offsets_.begin(), batch_offsets_.end(),
+                               static_cast<int64_t>(index));
+    return static_cast<int64_t>(it - batch_offsets_.begin()) - 1;
+  }
+
+  // Merge the sorted batches pairwise until a single sorted run is left.
+  // std::merge keeps elements of the left run first on ties, so the result
+  // is stable.
+  void MergeBatches(uint64_t* indices) const {
+    if (num_batches() <= 1) {
+      return;
+    }
+    auto less = [&](uint64_t left, uint64_t right) {
+      const int64_t left_batch = ResolveBatch(left);
+      const int64_t right_batch = ResolveBatch(right);
+      return Compare(left_batch, left - batch_offsets_[left_batch], right_batch,
+                     right - batch_offsets_[right_batch]) < 0;
+    };
+
+    const int64_t length = batch_offsets_.back();
+    std::vector<uint64_t> scratch(length);
+    uint64_t* src = indices;
+    uint64_t* dest = scratch.data();
+    std::vector<int64_t> run_offsets = batch_offsets_;
+    while (run_offsets.size() > 2) {
+      std::vector<int64_t> merged_offsets = {0};
+      for (size_t i = 0; i + 1 < run_offsets.size(); i += 2) {
+        if (i + 2 < run_offsets.size()) {
+          std::merge(src + run_offsets[i], src + run_offsets[i + 1],
+                     src + run_offsets[i + 1], src + run_offsets[i + 2],
+                     dest + run_offsets[i], less);
+          merged_offsets.push_back(run_offsets[i + 2]);
+        } else {
+          std::copy(src + run_offsets[i], src + run_offsets[i + 1],
+                    dest + run_offsets[i]);
+          merged_offsets.push_back(run_offsets[i + 1]);
+        }
+      }
+      std::swap(src, dest);
+      run_offsets = std::move(merged_offsets);
+    }
+    if (src != indices) {
+      std::copy(src, src + length, indices);
+    }
+  }
+
+  std::vector<int64_t> batch_offsets_;
+  std::vector<std::unique_ptr<SortKeyComparator>> comparators_;
+};
+
+Result<SortOrder> GetSingleArrayOrder(const SortOptions& options) {
+  if (options.sort_keys.size() > 1) {
+    return Status::Invalid("Sorting an array requires at most one sort key, got ",
+                           options.sort_keys.size());
+  }
+  return options.sort_keys.empty() ? SortOrder::Ascending : options.sort_keys[0].order;
+}
+
+Result<std::shared_ptr<Array>> SortChunkedArrayIndices(const ChunkedArray& chunked_array,
+                                                       SortOrder order,
+                                                       MemoryPool* pool) {
+  BatchedSortKey key{chunked_array.type(), {}, order};
+  for (const auto& chunk : chunked_array.chunks()) {
+    if (chunk->length() > 0) {
+      key.batches.push_back(chunk);
+    }
+  }
+  return MultipleKeySorter::Sort({key}, chunked_array.length(), pool);
+}
+
+Status CheckSortKeys(const SortOptions& options) {
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Array>> SortRecordBatchIndices(const RecordBatch& batch,
+                                                      const SortOptions& options,
+                                                      MemoryPool* pool) {
+  RETURN_NOT_OK(CheckSortKeys(options));
+  std::vector<BatchedSortKey> keys;
+  for (const auto& sort_key : options.sort_keys) {
+    auto column = batch.GetColumnByName(sort_key.name);
+    if (column == nullptr) {
+      return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+    }
+    keys.push_back(BatchedSortKey{column->type(), {column}, sort_key.order});
+  }
+  return MultipleKeySorter::Sort(keys, batch.num_rows(), pool);
+}
+
+Result<std::shared_ptr<Array>> SortTableIndices(const Table& table,
+                                                const SortOptions& options,
+                                                MemoryPool* pool) {
+  RETURN_NOT_OK(CheckSortKeys(options));
+  std::vector<std::shared_ptr<Field>> key_fields;
+  std::vector<std::shared_ptr<ChunkedArray>> key_columns;
+  for (const auto& sort_key : options.sort_keys) {
+    auto column = table.GetColumnByName(sort_key.name);
+    if (column == nullptr) {
+      return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+    }
+    key_fields.push_back(field(sort_key.name, column->type()));
+    key_columns.push_back(std::move(column));
+  }
+
+  // Slice the key columns (without copying) along the union of their chunk
+  // boundaries, so that every key shares the same batches
+  auto key_table = Table::Make(schema(std::move(key_fields)), std::move(key_columns),
+                               table.num_rows());
+  // A column may be given as several keys, so look the keys up by position
+  std::vector<BatchedSortKey> keys;
+  for (size_t i = 0; i < options.sort_keys.size(); ++i) {
+    keys.push_back(BatchedSortKey{key_table->column(static_cast<int>(i))->type(),
+                                  {},
+                                  options.sort_keys[i].order});
+  }
+  TableBatchReader reader(*key_table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    if (batch->num_rows() == 0) {
+      continue;
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+      keys[i].batches.push_back(batch->column(static_cast<int>(i)));
+    }
+  }
+  return MultipleKeySorter::Sort(keys, table.num_rows(), pool);
+}
+
+const SortOptions* GetDefaultSortOptions() {
+  static const auto kDefaultSortOptions = SortOptions::Defaults();
+  return &kDefaultSortOptions;
+}
+
+class SortIndicesMetaFunction : public MetaFunction {
+ public:
+  SortIndicesMetaFunction()
+      : MetaFunction("sort_indices", Arity::Unary(), GetDefaultSortOptions()) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const auto& sort_options = static_cast<const SortOptions&>(*options);
+    MemoryPool* pool = ctx != nullptr ? ctx->memory_pool() : default_memory_pool();
+    switch (args[0].kind()) {
+      case Datum::ARRAY: {
+        ARROW_ASSIGN_OR_RAISE(SortOrder order, GetSingleArrayOrder(sort_options));
+        ArraySortOptions array_options(order);
+        return CallFunction("array_sort_indices", args, &array_options, ctx);
+      }
+      case Datum::CHUNKED_ARRAY: {
+        ARROW_ASSIGN_OR_RAISE(SortOrder order, GetSingleArrayOrder(sort_options));
+        ARROW_ASSIGN_OR_RAISE(
+            auto indices, SortChunkedArrayIndices(*args[0].chunked_array(), order, pool));
+        return Datum(std::move(indices));
+      }
+      case Datum::RECORD_BATCH: {
+        ARROW_ASSIGN_OR_RAISE(
+            auto indices, SortRecordBatchIndices(*args[0].record_batch(), sort_options,
+                                                 pool));
+        return Datum(std::move(indices));
+      }
+      case Datum::TABLE: {
+        ARROW_ASSIGN_OR_RAISE(
+            auto indices, SortTableIndices(*args[0].table(), sort_options, pool));
+        return Datum(std::move(indices));
+      }
+      default:
+        break;
+    }
+    return Status::NotImplemented("Unsupported types for sort_indices operation: ",
+                                  args[0].ToString());
   }
 };
 
+const ArraySortOptions* GetDefaultArraySortOptions() {
+  static const auto kDefaultArraySortOptions = ArraySortOptions::Defaults();
+  return &kDefaultArraySortOptions;
+}
+
+}  // namespace
+
 namespace internal {
 
 // Sort indices kernels implemented for
@@ -308,9 +715,16 @@ void RegisterVectorSort(FunctionRegistry* registry) {
   base.mem_allocation = MemAllocation::PREALLOCATE;
   base.null_handling = NullHandling::OUTPUT_NOT_NULL;
 
-  auto sort_indices = std::make_shared<VectorFunction>("sort_indices", Arity::Unary());
-  AddSortingKernels<SortIndices>(base, sort_indices.get());
-  DCHECK_OK(registry->AddFunction(std::move(sort_indices)));
+  // array_sort_indices needs its init function for the sort order
+  auto array_sort_indices = std::make_shared<VectorFunction>(
+      "array_sort_indices", Arity::Unary(), GetDefaultArraySortOptions());
+  base.init = ArraySortIndicesState::Init;
+  AddSortingKernels<ArraySortIndices>(base, array_sort_indices.get());
+  DCHECK_OK(registry->AddFunction(std::move(array_sort_indices)));
+
+  // sort_indices dispatches to array_sort_indices for arrays and handles
+  // chunked arrays, record batches and tables itself
+  DCHECK_OK(registry->AddFunction(std::make_shared<SortIndicesMetaFunction>()));
 
   // partition_nth_indices has a parameter so needs its init function
   auto part_indices =
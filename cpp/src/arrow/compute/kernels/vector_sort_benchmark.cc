@@ -19,6 +19,7 @@
 
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
@@ -59,6 +60,34 @@ static void SortToIndicesInt64Compare(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+// Sort a table chunked into 8 pieces by a narrow integer key, breaking ties
+// with a wide integer key
+static void SortIndicesTableTwoKeys(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t num_rows = args.size / (2 * sizeof(int64_t));
+  const int64_t num_chunks = 8;
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  ArrayVector narrow_chunks, wide_chunks;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    const int64_t chunk_length = num_rows / num_chunks;
+    narrow_chunks.push_back(rand.Int64(chunk_length, 0, 100, args.null_proportion));
+    wide_chunks.push_back(rand.Int64(chunk_length, std::numeric_limits<int64_t>::min(),
+                                     std::numeric_limits<int64_t>::max(),
+                                     args.null_proportion));
+  }
+  auto table = Table::Make(schema({field("narrow", int64()), field("wide", int64())}),
+                           {std::make_shared<ChunkedArray>(narrow_chunks),
+                            std::make_shared<ChunkedArray>(wide_chunks)});
+  SortOptions options({SortKey("narrow"), SortKey("wide", SortOrder::Descending)});
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(SortIndices(Datum(table), options).status());
+  }
+  state.SetItemsProcessed(state.iterations() * table->num_rows());
+}
+
 BENCHMARK(SortToIndicesInt64Count)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -73,5 +102,12 @@ BENCHMARK(SortToIndicesInt64Compare)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(SortIndicesTableTwoKeys)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
@@ -22,6 +22,7 @@
 
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -30,6 +31,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace compute {
@@ -376,5 +378,131 @@ TYPED_TEST(TestSortToIndicesKernelRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+TEST(TestSortIndices, ArrayDescending) {
+  auto values = ArrayFromJSON(int32(), "[3, null, 1, 3, 7, null, 1]");
+  ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(*values, SortOrder::Descending));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[4, 0, 3, 2, 6, 1, 5]"), *indices);
+
+  values = ArrayFromJSON(utf8(), R"(["b", "a", null, "c", "b"])");
+  ASSERT_OK_AND_ASSIGN(indices, SortIndices(*values, SortOrder::Descending));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, 0, 4, 1, 2]"), *indices);
+}
+
+TEST(TestSortIndices, ArrayDescendingCount) {
+  // Long enough and narrow enough for the counting sort
+  RandomRange<Int16Type> rand(0x5487658);
+  auto values = rand.Generate(4000, 100, 0.1);
+  ASSERT_OK_AND_ASSIGN(auto count_indices, SortIndices(*values, SortOrder::Descending));
+  const auto& offsets = checked_cast<const UInt64Array&>(*count_indices);
+  const auto& array = checked_cast<const Int16Array&>(*values);
+  for (int64_t i = 1; i < array.length(); ++i) {
+    const uint64_t lhs = offsets.Value(i - 1);
+    const uint64_t rhs = offsets.Value(i);
+    if (array.IsNull(rhs)) {
+      ASSERT_TRUE(!array.IsNull(lhs) || lhs < rhs);
+    } else {
+      ASSERT_FALSE(array.IsNull(lhs));
+      ASSERT_GE(array.Value(lhs), array.Value(rhs));
+      if (array.Value(lhs) == array.Value(rhs)) {
+        ASSERT_LT(lhs, rhs);
+      }
+    }
+  }
+}
+
+TEST(TestSortIndices, ChunkedArray) {
+  auto chunked = ChunkedArrayFromJSON(int32(), {"[]", "[3, null, 1]", "[3, 7]", "[]",
+                                                "[null, 1, 0]"});
+  ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(*chunked));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[7, 2, 6, 0, 3, 4, 1, 5]"), *indices);
+  ASSERT_OK_AND_ASSIGN(indices, SortIndices(*chunked, SortOrder::Descending));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[4, 0, 3, 2, 6, 7, 1, 5]"), *indices);
+
+  chunked = ChunkedArrayFromJSON(utf8(), {R"(["b", "a"])", R"(["c", null, "a"])"});
+  ASSERT_OK_AND_ASSIGN(indices, SortIndices(*chunked));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4, 0, 2, 3]"), *indices);
+
+  chunked = ChunkedArrayFromJSON(int32(), {});
+  ASSERT_OK_AND_ASSIGN(indices, SortIndices(*chunked));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[]"), *indices);
+}
+
+TEST(TestSortIndices, ChunkedArrayMatchesArray) {
+  Random<Int64Type> rand(0x548765a);
+  auto values = rand.Generate(5000, 0.1);
+  std::vector<std::shared_ptr<Array>> chunks;
+  for (int64_t offset = 0; offset < values->length(); offset += 1300) {
+    chunks.push_back(values->Slice(offset, 1300));
+  }
+  for (auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+    ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(*values, order));
+    ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(ChunkedArray(chunks), order));
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
+TEST(TestSortIndices, RecordBatch) {
+  auto schema = ::arrow::schema({field("a", uint8()), field("b", utf8())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [1, "x"],
+    [0, "y"],
+    [1, "w"],
+    [0, null],
+    [null, "z"],
+    [1, "x"]
+  ])");
+  SortOptions options({SortKey("a"), SortKey("b", SortOrder::Descending)});
+  ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(Datum(batch), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 3, 0, 5, 2, 4]"), *indices);
+
+  options.sort_keys = {SortKey("b"), SortKey("a", SortOrder::Descending)};
+  ASSERT_OK_AND_ASSIGN(indices, SortIndices(Datum(batch), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 0, 5, 1, 4, 3]"), *indices);
+}
+
+TEST(TestSortIndices, Table) {
+  auto schema = ::arrow::schema(
+      {field("a", int32()), field("b", float64()), field("c", utf8())});
+  // The columns are chunked differently
+  auto table = Table::Make(
+      schema, {ChunkedArrayFromJSON(int32(), {"[1, 0]", "[1, 0, null, 1, 0]"}),
+               ChunkedArrayFromJSON(float64(), {"[2.5, 1]", "[2.5]", "[null, 0, 1, 1]"}),
+               ChunkedArrayFromJSON(utf8(), {R"(["a", "b", "c", "d", "e", "f", "g"])"})});
+
+  SortOptions options({SortKey("a", SortOrder::Descending), SortKey("b")});
+  ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(Datum(table), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[5, 0, 2, 1, 6, 3, 4]"), *indices);
+
+  // A repeated key is only a tie-breaker for itself
+  options.sort_keys = {SortKey("a", SortOrder::Descending), SortKey("a")};
+  ASSERT_OK_AND_ASSIGN(indices, SortIndices(Datum(table), options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 2, 5, 1, 3, 6, 4]"), *indices);
+
+  // Sorting the table and the combined record batch must agree
+  ASSERT_OK_AND_ASSIGN(auto combined, table->CombineChunks());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(TableBatchReader(*combined).ReadNext(&batch));
+  for (const auto& keys : std::vector<std::vector<SortKey>>{
+           {SortKey("c", SortOrder::Descending)},
+           {SortKey("b"), SortKey("c")},
+           {SortKey("b", SortOrder::Descending), SortKey("a")},
+           {SortKey("c"), SortKey("b"), SortKey("c", SortOrder::Descending)}}) {
+    options.sort_keys = keys;
+    ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(Datum(batch), options));
+    ASSERT_OK_AND_ASSIGN(indices, SortIndices(Datum(table), options));
+    AssertArraysEqual(*expected, *indices);
+  }
+}
+
+TEST(TestSortIndices, Errors) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", list(int32()))});
+  auto batch = RecordBatchFromJSON(schema, "[[1, [1]], [0, null]]");
+  ASSERT_RAISES(Invalid, SortIndices(Datum(batch), SortOptions()));
+  ASSERT_RAISES(Invalid, SortIndices(Datum(batch), SortOptions({SortKey("c")})));
+  ASSERT_RAISES(NotImplemented, SortIndices(Datum(batch), SortOptions({SortKey("b")})));
+  ASSERT_RAISES(Invalid, SortIndices(batch->column(0),
+                                     SortOptions({SortKey("a"), SortKey("b")})));
+}
+
 }  // namespace compute
 }  // namespace arrow
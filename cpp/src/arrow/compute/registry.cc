@@ -126,6 +126,7 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
 
   // Aggregate functions
   RegisterScalarAggregateBasic(registry.get());
+  RegisterHashAggregateBasic(registry.get());
 
   // Vector functions
   RegisterVectorHash(registry.get());
@@ -21,6 +21,7 @@
 #include <memory>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
@@ -45,11 +46,14 @@ class Lexer {
     AT_QUOTED_ESCAPE
   };
 
-  explicit Lexer(const ParseOptions& options) : options_(options) {
+  explicit Lexer(const ParseOptions& options) : options_(options), scanner_(options) {
     DCHECK_EQ(quoting, options_.quoting);
     DCHECK_EQ(escaping, options_.escaping);
   }
 
+  // Must be called before reading lines from another buffer
+  void SwitchBuffer() { scanner_.Reset(); }
+
   const char* ReadLine(const char* data, const char* data_end) {
     // The parsing state machine
     char c;
@@ -88,6 +92,7 @@ class Lexer {
 
   InField:
     // Inside a non-quoted part of a field
+    data = scanner_.Find(data, data_end);
     if (ARROW_PREDICT_FALSE(data == data_end)) {
       state_ = IN_FIELD;
       goto AbortLine;
@@ -122,6 +127,7 @@ class Lexer {
 
   InQuotedField:
     // Inside a quoted part of a field
+    data = scanner_.Find(data, data_end);
     if (ARROW_PREDICT_FALSE(data == data_end)) {
       state_ = IN_QUOTED_FIELD;
       goto AbortLine;
@@ -180,6 +186,7 @@ class Lexer {
 
  protected:
   const ParseOptions& options_;
+  SpecialCharScanner<quoting, escaping> scanner_;
   State state_ = FIELD_START;
 };
 
@@ -197,6 +204,7 @@ class LexingBoundaryFinder : public BoundaryFinder {
     const char* line_end =
         lexer.ReadLine(partial.data(), partial.data() + partial.size());
     DCHECK_EQ(line_end, nullptr);  // Otherwise `partial` is a whole CSV line
+    lexer.SwitchBuffer();
     line_end = lexer.ReadLine(block.data(), block.data() + block.size());
 
     if (line_end == nullptr) {
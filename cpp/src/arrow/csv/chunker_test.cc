@@ -19,6 +19,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -261,5 +262,22 @@ TEST_P(BaseChunkerTest, EscapingNewline) {
   }
 }
 
+TEST_P(BaseChunkerTest, LongFields) {
+  // Fields spanning several 64-byte windows, with special characters
+  // at various offsets
+  std::vector<std::string> rows;
+  std::vector<int64_t> lengths;
+  for (int32_t i = 0; i < 60; ++i) {
+    const auto y = std::string(i * 7 % 131, 'y');
+    const auto z = std::string(i % 67, 'z');
+    rows.push_back(std::string(i, 'x') + ",\"" + y + ",\n\"\"" + z + "\"\n");
+    lengths.push_back(static_cast<int64_t>(rows.back().size()));
+  }
+  if (options_.newlines_in_values) {
+    MakeChunker();
+    AssertChunking(*chunker_, MakeCSVData(rows), lengths);
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/csv/lexing_internal.h"
+
+namespace arrow {
+namespace csv {
+
+uint64_t ClassifyCharsAvx2(const uint8_t* data, const SpecialChars& specials) {
+  __m256i needles[SpecialChars::kNumChars];
+  for (int j = 0; j < SpecialChars::kNumChars; ++j) {
+    needles[j] = _mm256_set1_epi8(static_cast<char>(specials.chars[j]));
+  }
+  uint64_t mask = 0;
+  for (int i = 0; i < 2; ++i) {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 32));
+    __m256i matches = _mm256_cmpeq_epi8(block, needles[0]);
+    for (int j = 1; j < SpecialChars::kNumChars; ++j) {
+      matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, needles[j]));
+    }
+    const auto bits = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+    mask |= static_cast<uint64_t>(bits) << (i * 32);
+  }
+  return mask;
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/lexing_internal.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+
+namespace {
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+uint64_t ClassifyCharsDefault(const uint8_t* data, const SpecialChars& specials) {
+  __m128i needles[SpecialChars::kNumChars];
+  for (int j = 0; j < SpecialChars::kNumChars; ++j) {
+    needles[j] = _mm_set1_epi8(static_cast<char>(specials.chars[j]));
+  }
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; ++i) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16));
+    __m128i matches = _mm_cmpeq_epi8(block, needles[0]);
+    for (int j = 1; j < SpecialChars::kNumChars; ++j) {
+      matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, needles[j]));
+    }
+    const auto bits = static_cast<uint16_t>(_mm_movemask_epi8(matches));
+    mask |= static_cast<uint64_t>(bits) << (i * 16);
+  }
+  return mask;
+}
+
+#else
+
+// Portable version, looking at 8 bytes at a time
+uint64_t ClassifyCharsDefault(const uint8_t* data, const SpecialChars& specials) {
+  constexpr uint64_t kLowBits = 0x0101010101010101ULL;
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+  uint64_t mask = 0;
+  for (int i = 0; i < 8; ++i) {
+    uint64_t word;
+    memcpy(&word, data + i * 8, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    // Set the high bit of each byte equal to a special character (the borrows
+    // may also set it in the bytes following a match, which is harmless)
+    uint64_t found = 0;
+    for (int j = 0; j < SpecialChars::kNumChars; ++j) {
+      const uint64_t x = word ^ (kLowBits * specials.chars[j]);
+      found |= (x - kLowBits) & ~x & kHighBits;
+    }
+    // Gather the high bits into the top byte
+    const uint64_t bits = ((found >> 7) * 0x0102040810204080ULL) >> 56;
+    mask |= bits << (i * 8);
+  }
+  return mask;
+}
+
+#endif
+
+struct ClassifyCharsDynamicFunction {
+  using FunctionType = ClassifyCharsFunc;
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, ClassifyCharsDefault }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, ClassifyCharsAvx2 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+ClassifyCharsFunc GetClassifyCharsFunc() {
+  static DynamicDispatch<ClassifyCharsDynamicFunction> dispatch;
+  return dispatch.func;
+}
+
+}  // namespace csv
+}  // namespace arrow
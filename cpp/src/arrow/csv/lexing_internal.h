@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace csv {
+
+// The characters a CSV lexing state machine may have to act upon.
+// Unused slots repeat the newline character.
+struct SpecialChars {
+  static constexpr int kNumChars = 5;
+
+  uint8_t chars[kNumChars];
+};
+
+// Classify the 64 bytes starting at `data`: bit i of the result is set if
+// data[i] may be a special character.  False positives are allowed.
+using ClassifyCharsFunc = uint64_t (*)(const uint8_t* data, const SpecialChars& specials);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+uint64_t ClassifyCharsAvx2(const uint8_t* data, const SpecialChars& specials);
+#endif
+
+// Return the fastest classification routine for the running CPU
+ClassifyCharsFunc GetClassifyCharsFunc();
+
+// A helper letting the CSV state machines skip runs of ordinary characters.
+// Input is classified one 64-byte window at a time into a bitmask of special
+// characters, and the bitmask is reused as long as the lexer stays inside
+// the window.
+template <bool quoting, bool escaping>
+class SpecialCharScanner {
+ public:
+  static constexpr int64_t kWindowSize = 64;
+
+  explicit SpecialCharScanner(const ParseOptions& options)
+      : classify_(GetClassifyCharsFunc()) {
+    specials_.chars[0] = '\n';
+    specials_.chars[1] = '\r';
+    specials_.chars[2] = static_cast<uint8_t>(options.delimiter);
+    specials_.chars[3] = static_cast<uint8_t>(quoting ? options.quote_char : '\n');
+    specials_.chars[4] = static_cast<uint8_t>(escaping ? options.escape_char : '\n');
+  }
+
+  // Forget the current window.  This must be called before scanning
+  // another buffer.
+  void Reset() { window_start_ = nullptr; }
+
+  // Return the first position in [data, data_end) that may hold a special
+  // character, or data_end if there is none
+  const char* Find(const char* data, const char* data_end) {
+    while (true) {
+      // (wraps around if `data` is before the window or there is no window)
+      auto offset = reinterpret_cast<uintptr_t>(data) -
+                    reinterpret_cast<uintptr_t>(window_start_);
+      if (ARROW_PREDICT_FALSE(offset >= kWindowSize)) {
+        if (data_end - data < kWindowSize) {
+          break;
+        }
+        window_start_ = data;
+        mask_ = classify_(reinterpret_cast<const uint8_t*>(data), specials_);
+        offset = 0;
+      }
+      const uint64_t mask = mask_ >> offset;
+      if (mask != 0) {
+        return data + BitUtil::CountTrailingZeros(mask);
+      }
+      data = window_start_ + kWindowSize;
+    }
+    // Not enough data left for a whole window
+    while (data < data_end && !IsSpecial(static_cast<uint8_t>(*data))) {
+      ++data;
+    }
+    return data;
+  }
+
+ protected:
+  bool IsSpecial(uint8_t c) const {
+    return c == specials_.chars[0] || c == specials_.chars[1] ||
+           c == specials_.chars[2] || (quoting && c == specials_.chars[3]) ||
+           (escaping && c == specials_.chars[4]);
+  }
+
+  const ClassifyCharsFunc classify_;
+  SpecialChars specials_;
+
+  const char* window_start_ = nullptr;
+  uint64_t mask_ = 0;
+};
+
+}  // namespace csv
+}  // namespace arrow
@@ -136,5 +136,20 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// Whether to write an initial header line with column names
+  bool include_header = true;
+  /// Maximum number of rows formatted at once; bounds the size of each
+  /// chunk handed to the output stream
+  int32_t batch_size = 1024;
+  /// Whether to format column slices in parallel on the global CPU thread pool
+  bool use_threads = true;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
@@ -19,9 +19,11 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -42,6 +44,9 @@ static Status MismatchingColumns(int32_t expected, int32_t actual) {
 
 static inline bool IsControlChar(uint8_t c) { return c < ' '; }
 
+// The field length from which the rest of a field is lexed in bulk
+static constexpr int64_t kMinBulkFieldLength = 8;
+
 int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
                  const uint8_t** out_data) {
   const auto end = data + size;
@@ -73,6 +78,7 @@ class SpecializedOptions {
  public:
   static constexpr bool quoting = Quoting;
   static constexpr bool escaping = Escaping;
+  using CharScanner = SpecialCharScanner<Quoting, Escaping>;
 };
 
 // A helper class allocating the buffer for parsed values and writing into it
@@ -97,6 +103,20 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  void PushFieldChars(const char* data, int64_t length) {
+    DCHECK_LE(parsed_size_ + length, parsed_capacity_);
+    uint8_t* out = parsed_ + parsed_size_;
+    parsed_size_ += length;
+    if (length > 16) {
+      memcpy(out, data, static_cast<size_t>(length));
+    } else {
+      // Avoid the overhead of calling memcpy() for short runs
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = static_cast<uint8_t>(data[i]);
+      }
+    }
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -213,7 +233,8 @@ class BlockParser::PresizedValuesWriter {
 };
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
+Status BlockParser::ParseLine(typename SpecializedOptions::CharScanner* scanner,
+                              ValuesWriter* values_writer, ParsedWriter* parsed_writer,
                               const char* data, const char* data_end, bool is_final,
                               const char** out_data) {
   int32_t num_cols = 0;
@@ -223,6 +244,17 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
   auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
 
+  // Short fields are common and best lexed one character at a time.  Past a
+  // few characters, copy the following ordinary characters in bulk.
+  const char* field_start = data;
+  auto MaybeCopyInBulk = [&]() {
+    if (ARROW_PREDICT_FALSE(data - field_start >= kMinBulkFieldLength)) {
+      const char* run_end = scanner->Find(data, data_end);
+      parsed_writer->PushFieldChars(data, run_end - data);
+      data = run_end;
+    }
+  };
+
   values_writer->BeginLine();
   parsed_writer->BeginLine();
 
@@ -246,6 +278,7 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
 FieldStart:
   // At the start of a field
+  field_start = data;
   // Quoting is only recognized at start of field
   if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
     ++data;
@@ -286,6 +319,7 @@ InField:
     }
   }
   parsed_writer->PushFieldChar(c);
+  MaybeCopyInBulk();
   goto InField;
 
 InQuotedField:
@@ -313,6 +347,7 @@ InQuotedField:
     }
   }
   parsed_writer->PushFieldChar(c);
+  MaybeCopyInBulk();
   goto InQuotedField;
 
 FieldEnd:
@@ -376,7 +411,8 @@ EmptyLine:
 }
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
+Status BlockParser::ParseChunk(typename SpecializedOptions::CharScanner* scanner,
+                               ValuesWriter* values_writer, ParsedWriter* parsed_writer,
                                const char* data, const char* data_end, bool is_final,
                                int32_t rows_in_chunk, const char** out_data,
                                bool* finished_parsing) {
@@ -384,8 +420,8 @@ Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed
 
   while (data < data_end && num_rows_ < num_rows_deadline) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    RETURN_NOT_OK(ParseLine<SpecializedOptions>(scanner, values_writer, parsed_writer,
+                                                data, data_end, is_final, &line_end));
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -423,9 +459,11 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
   }
 
   PresizedParsedWriter parsed_writer(pool_, static_cast<uint32_t>(total_view_length));
+  typename SpecializedOptions::CharScanner scanner(options_);
   uint32_t total_parsed_length = 0;
 
   for (const auto& view : views) {
+    scanner.Reset();
     const char* data = view.data();
     const char* data_end = view.data() + view.length();
     bool finished_parsing = false;
@@ -437,9 +475,9 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       ResizableValuesWriter values_writer(pool_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+          &scanner, &values_writer, &parsed_writer, data, data_end, is_final,
+          rows_in_chunk, &data, &finished_parsing));
       if (num_cols_ == -1) {
         return ParseError("Empty CSV file or block: cannot infer number of columns");
       }
@@ -462,9 +500,9 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+          &scanner, &values_writer, &parsed_writer, data, data_end, is_final,
+          rows_in_chunk, &data, &finished_parsing));
     }
     DCHECK_GE(data, view.data());
     DCHECK_LE(data, data_end);
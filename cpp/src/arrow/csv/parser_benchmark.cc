@@ -34,6 +34,10 @@ namespace csv {
 // >> For a static/global string constant, use a C style string instead
 const char* one_row = "abc,\"d,f\",12.34,\n";
 const char* one_row_escaped = "abc,d\\,f,12.34,\n";
+const char* one_row_long =
+    "\"Rather long text field, spanning several SIMD registers\","
+    "another long unquoted field with several words in it,"
+    "\"text with \"\"quotes\"\" and a\nnewline\",123456.789\n";
 
 const auto num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row));
 
@@ -139,11 +143,30 @@ static void ParseCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void ChunkCSVLongFieldsBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_long, num_rows / 8);
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+
+  BenchmarkCSVChunking(state, csv, options);
+}
+
+static void ParseCSVLongFieldsBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_long, num_rows / 8);
+  auto options = ParseOptions::Defaults();
+
+  BenchmarkCSVParsing(state, csv, num_rows / 8, options);
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
+BENCHMARK(ChunkCSVLongFieldsBlock);
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
+BENCHMARK(ParseCSVLongFieldsBlock);
 
 }  // namespace csv
 }  // namespace arrow
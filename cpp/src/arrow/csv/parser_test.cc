@@ -580,6 +580,27 @@ TEST(BlockParser, Escaping) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several 64-byte windows, with special characters
+  // at various offsets
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+
+  std::vector<std::string> rows, unquoted_values, quoted_values;
+  for (int32_t i = 0; i < 150; ++i) {
+    const auto half = std::string(i / 2, 'x');
+    const auto y = std::string(i * 7 % 131, 'y');
+    const auto z = std::string(i % 67, 'z');
+    rows.push_back(half + "\\," + half + ",\"" + y + ",\n\"\"" + z + "\"\n");
+    unquoted_values.push_back(half + "," + half);
+    quoted_values.push_back(y + ",\n\"" + z);
+  }
+  auto csv = MakeCSVData(rows);
+  BlockParser parser(options);
+  AssertParseOk(parser, csv);
+  AssertColumnsEq(parser, {unquoted_values, quoted_values});
+}
+
 // Generate test data with the given number of columns.
 std::string MakeLotsOfCsvColumns(int32_t num_columns) {
   std::string values, header;
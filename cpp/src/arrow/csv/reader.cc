@@ -17,8 +17,10 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -40,6 +42,8 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/future.h"
+#include "arrow/util/future_iterator.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -261,16 +265,30 @@ class ThreadedBlockReader : public BlockReader {
 
 class ReaderMixin {
  public:
-  ReaderMixin(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
-              const ReadOptions& read_options, const ParseOptions& parse_options,
-              const ConvertOptions& convert_options)
+  ReaderMixin(MemoryPool* pool, io::AsyncContext io_context,
+              std::shared_ptr<io::InputStream> input, const ReadOptions& read_options,
+              const ParseOptions& parse_options, const ConvertOptions& convert_options)
       : pool_(pool),
+        io_context_(std::move(io_context)),
         read_options_(read_options),
         parse_options_(parse_options),
         convert_options_(convert_options),
         input_(std::move(input)) {}
 
  protected:
+  // Read blocks of the input in the background on the I/O executor,
+  // keeping up to `readahead` blocks ahead of the parser
+  Status MakeBufferIterator(int32_t readahead) {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+    ARROW_ASSIGN_OR_RAISE(auto block_generator,
+                          MakeBackgroundGenerator(std::move(istream_it),
+                                                  io_context_.executor, readahead));
+    buffer_iterator_ =
+        CSVBufferIterator::Make(MakeGeneratorIterator(std::move(block_generator)));
+    return Status::OK();
+  }
+
   // Read header and column names from buffer, create column builders
   Status ProcessHeader(const std::shared_ptr<Buffer>& buf,
                        std::shared_ptr<Buffer>* rest) {
@@ -438,6 +456,7 @@ class ReaderMixin {
   }
 
   MemoryPool* pool_;
+  io::AsyncContext io_context_;
   ReadOptions read_options_;
   ParseOptions parse_options_;
   ConvertOptions convert_options_;
@@ -635,14 +654,8 @@ class SerialStreamingReader : public BaseStreamingReader {
   using BaseStreamingReader::BaseStreamingReader;
 
   Status Init() override {
-    ARROW_ASSIGN_OR_RAISE(auto istream_it,
-                          io::MakeInputStreamIterator(input_, read_options_.block_size));
-
     // Since we're converting serially, no need to readahead more than one block
-    int32_t block_queue_size = 1;
-    ARROW_ASSIGN_OR_RAISE(auto rh_it,
-                          MakeReadaheadIterator(std::move(istream_it), block_queue_size));
-    buffer_iterator_ = CSVBufferIterator::Make(std::move(rh_it));
+    RETURN_NOT_OK(MakeBufferIterator(/*readahead=*/1));
     task_group_ = internal::TaskGroup::MakeSerial();
 
     // Read schema from first batch
@@ -716,6 +729,146 @@ class SerialStreamingReader : public BaseStreamingReader {
   std::shared_ptr<SerialBlockReader> block_reader_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Parallel StreamingReader implementation
+
+class ThreadedStreamingReader : public BaseStreamingReader {
+ public:
+  ThreadedStreamingReader(MemoryPool* pool, io::AsyncContext io_context,
+                          std::shared_ptr<io::InputStream> input,
+                          const ReadOptions& read_options,
+                          const ParseOptions& parse_options,
+                          const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : BaseStreamingReader(pool, std::move(io_context), std::move(input), read_options,
+                            parse_options, convert_options),
+        thread_pool_(thread_pool) {}
+
+  ~ThreadedStreamingReader() override {
+    // Make sure all pending tasks are finished before we start destroying
+    // BaseStreamingReader members
+    for (const auto& parsed : parsed_blocks_) {
+      parsed.Wait();
+    }
+    if (task_group_) {
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Init() override {
+    // Parse and convert up to one block per thread ahead of the consumer
+    readahead_ = std::max(thread_pool_->GetCapacity(), 1);
+    RETURN_NOT_OK(MakeBufferIterator(readahead_));
+    task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
+
+    // Read schema from first batch
+    ARROW_ASSIGN_OR_RAISE(pending_batch_, ReadNext());
+    DCHECK_NE(schema_, nullptr);
+    return Status::OK();
+  }
+
+ protected:
+  Result<std::shared_ptr<RecordBatch>> ReadNext() override {
+    if (eof_) {
+      return nullptr;
+    }
+    if (block_reader_ == nullptr) {
+      Status st = SetupReader();
+      if (!st.ok()) {
+        // Can't setup reader => bail out
+        eof_ = true;
+        return st;
+      }
+    }
+    auto batch = std::move(pending_batch_);
+    if (batch != nullptr) {
+      return batch;
+    }
+
+    Status st = LaunchBlocks();
+    if (st.ok()) {
+      st = InsertBlocks();
+    }
+    if (!st.ok()) {
+      // Read or parse error => bail out
+      eof_ = true;
+      return st;
+    }
+
+    auto maybe_batch = DecodeNextBatch();
+    ++num_decoded_blocks_;
+    if (schema_ == nullptr && maybe_batch.ok()) {
+      schema_ = (*maybe_batch)->schema();
+    }
+    return maybe_batch;
+  }
+
+  // Launch parse tasks until `readahead_` blocks past the last decoded one
+  // are in flight
+  Status LaunchBlocks() {
+    while (!source_eof_ && num_launched_blocks_ - num_decoded_blocks_ < readahead_) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
+      if (!maybe_block.has_value()) {
+        source_eof_ = true;
+        for (auto& decoder : column_decoders_) {
+          decoder->SetEOF(num_launched_blocks_);
+        }
+        break;
+      }
+      DCHECK(!maybe_block->consume_bytes);
+      DCHECK_EQ(maybe_block->block_index, num_launched_blocks_);
+
+      ARROW_ASSIGN_OR_RAISE(auto parsed, thread_pool_->Submit([this, maybe_block] {
+        return Parse(maybe_block->partial, maybe_block->completion, maybe_block->buffer,
+                     maybe_block->block_index, maybe_block->is_final);
+      }));
+      parsed_blocks_.push_back(std::move(parsed));
+      ++num_launched_blocks_;
+    }
+    return Status::OK();
+  }
+
+  // Hand parsed blocks over to the column decoders in file order, waiting
+  // only for the block the next batch is decoded from.  This must not run
+  // on the thread pool, as type-inferring decoders wait for the first block
+  // to be converted.
+  Status InsertBlocks() {
+    while (!parsed_blocks_.empty() &&
+           (num_inserted_blocks_ == num_decoded_blocks_ ||
+            IsFutureFinished(parsed_blocks_.front().state()))) {
+      auto parsed = std::move(parsed_blocks_.front());
+      parsed_blocks_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto result, std::move(parsed).result());
+      RETURN_NOT_OK(ProcessData(result.parser, num_inserted_blocks_++));
+    }
+    return Status::OK();
+  }
+
+  Status SetupReader() {
+    ARROW_ASSIGN_OR_RAISE(auto first_buffer, buffer_iterator_.Next());
+    if (first_buffer == nullptr) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(MakeColumnDecoders());
+
+    block_reader_ = std::make_shared<ThreadedBlockReader>(MakeChunker(parse_options_),
+                                                          std::move(buffer_iterator_),
+                                                          std::move(first_buffer));
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  int32_t readahead_ = 1;
+
+  bool source_eof_ = false;
+  int64_t num_launched_blocks_ = 0;
+  int64_t num_inserted_blocks_ = 0;
+  int64_t num_decoded_blocks_ = 0;
+  // Parse results of launched blocks not yet inserted, in file order
+  std::deque<Future<ParseResult>> parsed_blocks_;
+  std::shared_ptr<ThreadedBlockReader> block_reader_;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -724,14 +877,8 @@ class SerialTableReader : public BaseTableReader {
   using BaseTableReader::BaseTableReader;
 
   Status Init() override {
-    ARROW_ASSIGN_OR_RAISE(auto istream_it,
-                          io::MakeInputStreamIterator(input_, read_options_.block_size));
-
     // Since we're converting serially, no need to readahead more than one block
-    int32_t block_queue_size = 1;
-    ARROW_ASSIGN_OR_RAISE(auto rh_it,
-                          MakeReadaheadIterator(std::move(istream_it), block_queue_size));
-    buffer_iterator_ = CSVBufferIterator::Make(std::move(rh_it));
+    RETURN_NOT_OK(MakeBufferIterator(/*readahead=*/1));
     return Status::OK();
   }
 
@@ -774,10 +921,12 @@ class ThreadedTableReader : public BaseTableReader {
  public:
   using BaseTableReader::BaseTableReader;
 
-  ThreadedTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+  ThreadedTableReader(MemoryPool* pool, io::AsyncContext io_context,
+                      std::shared_ptr<io::InputStream> input,
                       const ReadOptions& read_options, const ParseOptions& parse_options,
                       const ConvertOptions& convert_options, ThreadPool* thread_pool)
-      : BaseTableReader(pool, input, read_options, parse_options, convert_options),
+      : BaseTableReader(pool, std::move(io_context), std::move(input), read_options,
+                        parse_options, convert_options),
         thread_pool_(thread_pool) {}
 
   ~ThreadedTableReader() override {
@@ -789,14 +938,7 @@ class ThreadedTableReader : public BaseTableReader {
   }
 
   Status Init() override {
-    ARROW_ASSIGN_OR_RAISE(auto istream_it,
-                          io::MakeInputStreamIterator(input_, read_options_.block_size));
-
-    int32_t block_queue_size = thread_pool_->GetCapacity();
-    ARROW_ASSIGN_OR_RAISE(auto rh_it,
-                          MakeReadaheadIterator(std::move(istream_it), block_queue_size));
-    buffer_iterator_ = CSVBufferIterator::Make(std::move(rh_it));
-    return Status::OK();
+    return MakeBufferIterator(/*readahead=*/thread_pool_->GetCapacity());
   }
 
   Result<std::shared_ptr<Table>> Read() override {
@@ -847,12 +989,22 @@ Result<std::shared_ptr<TableReader>> TableReader::Make(
     MemoryPool* pool, std::shared_ptr<io::InputStream> input,
     const ReadOptions& read_options, const ParseOptions& parse_options,
     const ConvertOptions& convert_options) {
+  return Make(pool, io::AsyncContext(), std::move(input), read_options, parse_options,
+              convert_options);
+}
+
+Result<std::shared_ptr<TableReader>> TableReader::Make(
+    MemoryPool* pool, io::AsyncContext io_context, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options) {
   std::shared_ptr<BaseTableReader> reader;
   if (read_options.use_threads) {
-    reader = std::make_shared<ThreadedTableReader>(
-        pool, input, read_options, parse_options, convert_options, GetCpuThreadPool());
+    reader = std::make_shared<ThreadedTableReader>(pool, std::move(io_context), input,
+                                                   read_options, parse_options,
+                                                   convert_options, GetCpuThreadPool());
   } else {
-    reader = std::make_shared<SerialTableReader>(pool, input, read_options, parse_options,
+    reader = std::make_shared<SerialTableReader>(pool, std::move(io_context), input,
+                                                 read_options, parse_options,
                                                  convert_options);
   }
   RETURN_NOT_OK(reader->Init());
@@ -863,9 +1015,24 @@ Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
     MemoryPool* pool, std::shared_ptr<io::InputStream> input,
     const ReadOptions& read_options, const ParseOptions& parse_options,
     const ConvertOptions& convert_options) {
+  return Make(pool, io::AsyncContext(), std::move(input), read_options, parse_options,
+              convert_options);
+}
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, io::AsyncContext io_context, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options) {
   std::shared_ptr<BaseStreamingReader> reader;
-  reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
-                                                   parse_options, convert_options);
+  if (read_options.use_threads) {
+    reader = std::make_shared<ThreadedStreamingReader>(
+        pool, std::move(io_context), input, read_options, parse_options,
+        convert_options, GetCpuThreadPool());
+  } else {
+    reader = std::make_shared<SerialStreamingReader>(
+        pool, std::move(io_context), input, read_options, parse_options,
+        convert_options);
+  }
   RETURN_NOT_OK(reader->Init());
   return reader;
 }
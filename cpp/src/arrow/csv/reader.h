@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/io/interfaces.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/type.h"
@@ -27,10 +28,6 @@
 #include "arrow/util/visibility.h"
 
 namespace arrow {
-namespace io {
-class InputStream;
-}  // namespace io
-
 namespace csv {
 
 /// A class that reads an entire CSV file into a Arrow Table
@@ -47,6 +44,14 @@ class ARROW_EXPORT TableReader {
                                                    const ReadOptions&,
                                                    const ParseOptions&,
                                                    const ConvertOptions&);
+
+  /// Create a TableReader instance reading blocks on the executor of io_context
+  static Result<std::shared_ptr<TableReader>> Make(MemoryPool* pool,
+                                                   io::AsyncContext io_context,
+                                                   std::shared_ptr<io::InputStream> input,
+                                                   const ReadOptions&,
+                                                   const ParseOptions&,
+                                                   const ConvertOptions&);
 };
 
 /// Experimental
@@ -56,11 +61,19 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
 
   /// Create a StreamingReader instance
   ///
-  /// Currently, the StreamingReader is always single-threaded (parallel
-  /// readahead is not supported).
+  /// If ReadOptions::use_threads is true, several blocks are parsed and
+  /// converted in parallel on the CPU thread pool, up to one block per thread
+  /// ahead of the consumer.  Batches are always yielded in file order.
   static Result<std::shared_ptr<StreamingReader>> Make(
       MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
       const ParseOptions&, const ConvertOptions&);
+
+  /// Create a StreamingReader instance reading blocks on the executor of
+  /// io_context
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, io::AsyncContext io_context,
+      std::shared_ptr<io::InputStream> input, const ReadOptions&, const ParseOptions&,
+      const ConvertOptions&);
 };
 
 }  // namespace csv
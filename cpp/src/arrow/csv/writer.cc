@@ -0,0 +1,333 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::OptionalParallelFor;
+using internal::StringFormatter;
+
+namespace csv {
+
+namespace {
+
+constexpr char kQuote = '"';
+constexpr char kDelimiter = ',';
+constexpr char kEndOfLine = '\n';
+
+// The CSV text of one column over a range of rows: the field of row `i` is
+// `data[offsets[i]:offsets[i + 1]]`
+struct FormattedColumn {
+  std::string data;
+  std::vector<int64_t> offsets{0};
+
+  int64_t num_rows() const { return static_cast<int64_t>(offsets.size()) - 1; }
+
+  void FinishField() { offsets.push_back(static_cast<int64_t>(data.size())); }
+};
+
+// Append `value` between quotes, doubling any quote inside it
+void AppendQuoted(util::string_view value, std::string* out) {
+  out->push_back(kQuote);
+  const char* data = value.data();
+  const char* data_end = data + value.size();
+  while (data < data_end) {
+    auto quote = static_cast<const char*>(std::memchr(data, kQuote, data_end - data));
+    if (quote == nullptr) {
+      out->append(data, data_end - data);
+      break;
+    }
+    // Append up to and including the quote, then escape it
+    out->append(data, quote - data + 1);
+    out->push_back(kQuote);
+    data = quote + 1;
+  }
+  out->push_back(kQuote);
+}
+
+// Formats the values of an array into a FormattedColumn
+class ColumnFormatter {
+ public:
+  ColumnFormatter(const ArrayData& data, FormattedColumn* out) : data_(data), out_(out) {}
+
+  Status Format() {
+    out_->offsets.reserve(out_->offsets.size() + data_.length);
+    return VisitTypeInline(*data_.type, this);
+  }
+
+  Status Visit(const NullType&) {
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_->FinishField();
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<internal::is_formattable<T>::value, Status> Visit(const T&) {
+    StringFormatter<T> formatter(data_.type);
+    auto append = [this](util::string_view formatted) {
+      out_->data.append(formatted.data(), formatted.size());
+    };
+    VisitArrayDataInline<T>(
+        data_,
+        [&](typename StringFormatter<T>::value_type value) {
+          formatter(value, append);
+          out_->FinishField();
+        },
+        [&]() { out_->FinishField(); });
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<is_base_binary_type<T>::value || is_fixed_size_binary_type<T>::value,
+              Status>
+  Visit(const T&) {
+    VisitArrayDataInline<T>(
+        data_,
+        [&](util::string_view value) {
+          AppendQuoted(value, &out_->data);
+          out_->FinishField();
+        },
+        [&]() { out_->FinishField(); });
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal128Type& type) {
+    VisitArrayDataInline<Decimal128Type>(
+        data_,
+        [&](util::string_view bytes) {
+          Decimal128 value(reinterpret_cast<const uint8_t*>(bytes.data()));
+          out_->data += value.ToString(type.scale());
+          out_->FinishField();
+        },
+        [&]() { out_->FinishField(); });
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    // Format the dictionary once, then copy its fields for each index
+    FormattedColumn dictionary;
+    RETURN_NOT_OK(ColumnFormatter(*data_.dictionary, &dictionary).Format());
+
+    ArrayData indices(data_);
+    indices.type = type.index_type();
+    indices.dictionary = nullptr;
+    switch (type.index_type()->id()) {
+      case Type::INT8:
+        return CopyDictionaryFields<Int8Type>(indices, dictionary);
+      case Type::INT16:
+        return CopyDictionaryFields<Int16Type>(indices, dictionary);
+      case Type::INT32:
+        return CopyDictionaryFields<Int32Type>(indices, dictionary);
+      case Type::INT64:
+        return CopyDictionaryFields<Int64Type>(indices, dictionary);
+      case Type::UINT8:
+        return CopyDictionaryFields<UInt8Type>(indices, dictionary);
+      case Type::UINT16:
+        return CopyDictionaryFields<UInt16Type>(indices, dictionary);
+      case Type::UINT32:
+        return CopyDictionaryFields<UInt32Type>(indices, dictionary);
+      case Type::UINT64:
+        return CopyDictionaryFields<UInt64Type>(indices, dictionary);
+      default:
+        return Status::Invalid("Invalid dictionary index type: ", *type.index_type());
+    }
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Unsupported type for CSV writing: ", type);
+  }
+
+ private:
+  template <typename IndexType>
+  Status CopyDictionaryFields(const ArrayData& indices,
+                              const FormattedColumn& dictionary) {
+    const int64_t dictionary_length = dictionary.num_rows();
+    return VisitArrayDataInline<IndexType>(
+        indices,
+        [&](typename IndexType::c_type index) {
+          const auto i = static_cast<int64_t>(index);
+          if (ARROW_PREDICT_FALSE(i < 0 || i >= dictionary_length)) {
+            return Status::IndexError("Dictionary index out of bounds: ", i);
+          }
+          const int64_t start = dictionary.offsets[i];
+          out_->data.append(dictionary.data, start, dictionary.offsets[i + 1] - start);
+          out_->FinishField();
+          return Status::OK();
+        },
+        [&]() {
+          out_->FinishField();
+          return Status::OK();
+        });
+  }
+
+  const ArrayData& data_;
+  FormattedColumn* out_;
+};
+
+Status FormatColumn(const ChunkedArray& column, FormattedColumn* out) {
+  for (const auto& chunk : column.chunks()) {
+    RETURN_NOT_OK(ColumnFormatter(*chunk->data(), out).Format());
+  }
+  return Status::OK();
+}
+
+// Interleave the formatted columns of a slice into CSV rows
+Result<std::shared_ptr<Buffer>> AssembleRows(const std::vector<FormattedColumn>& columns,
+                                             MemoryPool* pool) {
+  DCHECK(!columns.empty());
+  const int64_t num_rows = columns[0].num_rows();
+  // Every field is followed by either a delimiter or an end of line
+  int64_t size = num_rows * static_cast<int64_t>(columns.size());
+  for (const auto& column : columns) {
+    DCHECK_EQ(column.num_rows(), num_rows);
+    size += static_cast<int64_t>(column.data.size());
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, AllocateBuffer(size, pool));
+  uint8_t* out = buffer->mutable_data();
+  for (int64_t row = 0; row < num_rows; ++row) {
+    for (const auto& column : columns) {
+      const int64_t start = column.offsets[row];
+      const int64_t length = column.offsets[row + 1] - start;
+      std::memcpy(out, column.data.data() + start, static_cast<size_t>(length));
+      out += length;
+      *out++ = kDelimiter;
+    }
+    out[-1] = kEndOfLine;
+  }
+  DCHECK_EQ(out, buffer->data() + size);
+  return buffer;
+}
+
+class CSVWriterImpl {
+ public:
+  CSVWriterImpl(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output)
+      : table_(table), options_(options), pool_(pool), output_(output) {}
+
+  Status Write() {
+    const int num_columns = table_.num_columns();
+    if (num_columns == 0) {
+      return Status::OK();
+    }
+    if (options_.include_header) {
+      RETURN_NOT_OK(WriteHeader());
+    }
+
+    // Format up to one slice per thread at a time, so that memory use stays
+    // bounded whatever the size of the table
+    const int64_t batch_size = std::max<int64_t>(options_.batch_size, 1);
+    const int slices_per_round =
+        options_.use_threads ? std::max(GetCpuThreadPool()->GetCapacity(), 1) : 1;
+
+    int64_t offset = 0;
+    while (offset < table_.num_rows()) {
+      std::vector<std::shared_ptr<Table>> slices;
+      while (offset < table_.num_rows() &&
+             static_cast<int>(slices.size()) < slices_per_round) {
+        slices.push_back(table_.Slice(offset, batch_size));
+        offset += batch_size;
+      }
+      const int num_slices = static_cast<int>(slices.size());
+
+      std::vector<std::vector<FormattedColumn>> formatted(
+          num_slices, std::vector<FormattedColumn>(num_columns));
+      RETURN_NOT_OK(OptionalParallelFor(
+          options_.use_threads, num_slices * num_columns, [&](int task) -> Status {
+            const int slice = task / num_columns;
+            const int column = task % num_columns;
+            return FormatColumn(*slices[slice]->column(column),
+                                &formatted[slice][column]);
+          }));
+
+      std::vector<std::shared_ptr<Buffer>> chunks(num_slices);
+      RETURN_NOT_OK(
+          OptionalParallelFor(options_.use_threads, num_slices, [&](int slice) -> Status {
+            ARROW_ASSIGN_OR_RAISE(chunks[slice], AssembleRows(formatted[slice], pool_));
+            // Release the formatted text as early as possible
+            std::vector<FormattedColumn>().swap(formatted[slice]);
+            return Status::OK();
+          }));
+
+      for (const auto& chunk : chunks) {
+        RETURN_NOT_OK(output_->Write(chunk));
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status WriteHeader() {
+    std::string header;
+    for (const auto& field : table_.schema()->fields()) {
+      AppendQuoted(field->name(), &header);
+      header.push_back(kDelimiter);
+    }
+    header.back() = kEndOfLine;
+    return output_->Write(header.data(), static_cast<int64_t>(header.size()));
+  }
+
+  const Table& table_;
+  const WriteOptions& options_;
+  MemoryPool* pool_;
+  io::OutputStream* output_;
+};
+
+}  // namespace
+
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                arrow::io::OutputStream* output) {
+  return CSVWriterImpl(table, options, pool, output).Write();
+}
+
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                arrow::io::OutputStream* output) {
+  auto table = Table::Make(batch.schema(), batch.columns(), batch.num_rows());
+  return WriteCSV(*table, options, pool, output);
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/csv/options.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace csv {
+
+// Conversion of Arrow data to comma-separated values text.
+//
+// Null, boolean, numeric, decimal, temporal, string and binary columns are
+// supported, as well as dictionaries of those.  The following formatting rules
+// apply:
+//  - Nulls are written as empty, unquoted fields.
+//  - Non-null string and binary values are always quoted; quotes within the
+//    data are escaped by doubling them.
+//  - Other values are written unquoted, in the same representation the CSV
+//    reader parses back (e.g. "true", "2020-01-31 12:00:00.000").
+//  - LF (\n) is always used as a line ending.
+
+/// \brief Convert a table to CSV and write the result to `output`
+///
+/// Rows are formatted `options.batch_size` at a time and written to `output`
+/// in order, one Write() call per chunk.
+ARROW_EXPORT Status WriteCSV(const Table& table, const WriteOptions& options,
+                             MemoryPool* pool, arrow::io::OutputStream* output);
+
+/// \brief Convert a record batch to CSV and write the result to `output`
+ARROW_EXPORT Status WriteCSV(const RecordBatch& batch, const WriteOptions& options,
+                             MemoryPool* pool, arrow::io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+Result<std::string> WriteToString(const Table& table, const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteCSV(table, options, default_memory_pool(), out.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+void AssertWritten(const Table& table, const WriteOptions& options,
+                   const std::string& expected) {
+  for (bool use_threads : {false, true}) {
+    auto opts = options;
+    opts.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(table, opts));
+    ASSERT_EQ(csv, expected) << "use_threads = " << use_threads;
+  }
+}
+
+TEST(CSVWriterTest, Basics) {
+  auto schema = ::arrow::schema({field("i", int32()), field("f", float64()),
+                                 field("b", boolean()), field("s", utf8()),
+                                 field("n", null())});
+  auto table = TableFromJSON(schema, {R"([
+    [1, 1.5, true, "abc", null],
+    [-2, null, false, "", null],
+    [null, -0.25, null, null, null]
+  ])"});
+
+  AssertWritten(*table, WriteOptions::Defaults(),
+                "\"i\",\"f\",\"b\",\"s\",\"n\"\n"
+                "1,1.5,true,\"abc\",\n"
+                "-2,,false,\"\",\n"
+                ",-0.25,,,\n");
+
+  auto options = WriteOptions::Defaults();
+  options.include_header = false;
+  AssertWritten(*table, options,
+                "1,1.5,true,\"abc\",\n"
+                "-2,,false,\"\",\n"
+                ",-0.25,,,\n");
+}
+
+TEST(CSVWriterTest, Quoting) {
+  auto schema = ::arrow::schema({field("a\"b", utf8()), field("c", binary())});
+  auto table = TableFromJSON(schema, {R"([
+    ["x,y", "\"quoted\""],
+    ["line\nbreak", "a\"\"b"]
+  ])"});
+
+  AssertWritten(*table, WriteOptions::Defaults(),
+                "\"a\"\"b\",\"c\"\n"
+                "\"x,y\",\"\"\"quoted\"\"\"\n"
+                "\"line\nbreak\",\"a\"\"\"\"b\"\n");
+}
+
+TEST(CSVWriterTest, TemporalAndDecimal) {
+  auto schema = ::arrow::schema({field("d", date32()),
+                                 field("ts", timestamp(TimeUnit::MILLI)),
+                                 field("t", time32(TimeUnit::SECOND)),
+                                 field("dec", decimal(5, 2))});
+  auto table = TableFromJSON(schema, {R"([
+    [18262, 1580472000123, 3661, "123.45"],
+    [null, null, null, "-0.01"]
+  ])"});
+
+  AssertWritten(*table, WriteOptions::Defaults(),
+                "\"d\",\"ts\",\"t\",\"dec\"\n"
+                "2020-01-01,2020-01-31 12:00:00.123,01:01:01,123.45\n"
+                ",,,-0.01\n");
+}
+
+TEST(CSVWriterTest, Dictionary) {
+  auto type = dictionary(int8(), utf8());
+  auto array = DictArrayFromJSON(type, "[1, null, 0, 1]", R"(["foo", "bar"])");
+  auto table = Table::Make(::arrow::schema({field("d", type)}), {array});
+
+  AssertWritten(*table, WriteOptions::Defaults(),
+                "\"d\"\n\"bar\"\n\n\"foo\"\n\"bar\"\n");
+}
+
+TEST(CSVWriterTest, ChunksAndBatches) {
+  auto schema = ::arrow::schema({field("a", int64()), field("b", utf8())});
+  auto a = ChunkedArrayFromJSON(int64(), {"[0, 1, 2]", "[]", "[3, 4, 5, 6]"});
+  auto b = ChunkedArrayFromJSON(utf8(), {"[\"0\", \"1\"]", "[\"2\", \"3\", \"4\"]",
+                                         "[\"5\", null]"});
+  auto table = Table::Make(schema, {a, b});
+  const std::string expected =
+      "\"a\",\"b\"\n0,\"0\"\n1,\"1\"\n2,\"2\"\n3,\"3\"\n4,\"4\"\n5,\"5\"\n6,\n";
+
+  auto options = WriteOptions::Defaults();
+  for (int32_t batch_size : {1, 2, 3, 7, 1024}) {
+    options.batch_size = batch_size;
+    AssertWritten(*table, options, expected);
+  }
+  // Sliced tables start mid-chunk
+  AssertWritten(*table->Slice(2, 3), options, "\"a\",\"b\"\n2,\"2\"\n3,\"3\"\n4,\"4\"\n");
+  // Empty tables only get a header
+  AssertWritten(*table->Slice(0, 0), options, "\"a\",\"b\"\n");
+}
+
+TEST(CSVWriterTest, RecordBatch) {
+  auto schema = ::arrow::schema({field("a", int16())});
+  auto batch = RecordBatchFromJSON(schema, "[[1], [2]]");
+
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  ASSERT_OK(WriteCSV(*batch, WriteOptions::Defaults(), default_memory_pool(), out.get()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+  ASSERT_EQ(buffer->ToString(), "\"a\"\n1\n2\n");
+}
+
+TEST(CSVWriterTest, RoundTrip) {
+  auto schema = ::arrow::schema({field("i", int64()), field("f", float64()),
+                                 field("b", boolean()), field("s", utf8()),
+                                 field("ts", timestamp(TimeUnit::SECOND))});
+  auto table = TableFromJSON(schema, {R"([
+    [1, 1.5, true, "a,\"b\"", 0],
+    [null, 1e-10, false, "x\ny", 1580472000],
+    [-3, null, null, null, null]
+  ])"});
+
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(*table, WriteOptions::Defaults()));
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.newlines_in_values = true;
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.strings_can_be_null = true;
+  for (const auto& field : schema->fields()) {
+    convert_options.column_types[field->name()] = field->type();
+  }
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       TableReader::Make(default_memory_pool(), input,
+                                         ReadOptions::Defaults(), parse_options,
+                                         convert_options));
+  ASSERT_OK_AND_ASSIGN(auto read_table, reader->Read());
+  AssertTablesEqual(*table, *read_table, /*same_chunk_layout=*/false);
+}
+
+TEST(CSVWriterTest, UnsupportedType) {
+  auto schema = ::arrow::schema({field("l", list(int32()))});
+  auto table = TableFromJSON(schema, {"[[[1, 2]]]"});
+  ASSERT_RAISES(NotImplemented, WriteToString(*table, WriteOptions::Defaults()));
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -21,9 +21,11 @@
 
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/discovery.h"
+#include "arrow/dataset/exec_plan.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/file_csv.h"
 #include "arrow/dataset/file_ipc.h"
 #include "arrow/dataset/file_parquet.h"
 #include "arrow/dataset/filter.h"
+#include "arrow/dataset/metadata_cache.h"
 #include "arrow/dataset/scanner.h"
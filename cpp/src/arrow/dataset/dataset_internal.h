@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -25,10 +27,12 @@
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/type.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
@@ -57,6 +61,62 @@ inline RecordBatchIterator IteratorFromReader(
   return MakeFunctionIterator([reader] { return reader->Next(); });
 }
 
+/// \brief Call func(i) for every i in [0, num_tasks), keeping at most
+/// max_concurrency calls in flight.
+///
+/// Intended for fanning out blocking IO such as file listings and footer reads: the
+/// calls are distributed over the IO thread pool, with the calling thread taking part.
+/// After the first error no further calls are started and that error is returned.
+template <typename Function>
+Status ParallelForIO(int64_t num_tasks, int max_concurrency, Function&& func) {
+  const int64_t num_workers = std::min<int64_t>(max_concurrency, num_tasks);
+  if (num_workers <= 1) {
+    for (int64_t i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(func(i));
+    }
+    return Status::OK();
+  }
+
+  struct State {
+    std::atomic<int64_t> next_task{0};
+    std::atomic<bool> failed{false};
+  };
+  auto state = std::make_shared<State>();
+
+  // func is captured by reference; every worker is waited for before returning
+  auto work = [state, num_tasks, &func]() -> Status {
+    for (int64_t i = state->next_task++; i < num_tasks && !state->failed.load();
+         i = state->next_task++) {
+      Status st = func(i);
+      if (!st.ok()) {
+        state->failed.store(true);
+        return st;
+      }
+    }
+    return Status::OK();
+  };
+
+  auto pool = io::internal::GetIOThreadPool();
+  std::vector<Future<Status>> workers;
+  Status st;
+  for (int64_t i = 1; i < num_workers; ++i) {
+    auto maybe_worker = pool->Submit(work);
+    if (!maybe_worker.ok()) {
+      st = maybe_worker.status();
+      state->failed.store(true);
+      break;
+    }
+    workers.push_back(maybe_worker.MoveValueUnsafe());
+  }
+
+  // Take a share of the tasks on this thread, then join the workers
+  st &= work();
+  for (auto& worker : workers) {
+    st &= worker.status();
+  }
+  return st;
+}
+
 inline std::shared_ptr<Schema> SchemaFromColumnNames(
     const std::shared_ptr<Schema>& input, const std::vector<std::string>& column_names) {
   std::vector<std::shared_ptr<Field>> columns;
@@ -25,16 +25,45 @@
 #include <vector>
 
 #include "arrow/dataset/dataset.h"
+#include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/metadata_cache.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace dataset {
 
+namespace {
+
+// Unify schemas as a tree reduction: contiguous runs of schemas are unified in
+// parallel, then the partial results are unified in order. Fields therefore keep the
+// order in which they are first seen, exactly as with a single UnifySchemas call.
+Result<std::shared_ptr<Schema>> UnifySchemasInParallel(
+    const std::vector<std::shared_ptr<Schema>>& schemas) {
+  constexpr size_t kSchemasPerTask = 256;
+  if (schemas.size() <= kSchemasPerTask) {
+    return UnifySchemas(schemas);
+  }
+
+  const size_t num_tasks = (schemas.size() + kSchemasPerTask - 1) / kSchemasPerTask;
+  std::vector<std::shared_ptr<Schema>> partials(num_tasks);
+  RETURN_NOT_OK(internal::ParallelFor(static_cast<int>(num_tasks), [&](int i) -> Status {
+    const size_t begin = i * kSchemasPerTask;
+    const size_t end = std::min(schemas.size(), begin + kSchemasPerTask);
+    ARROW_ASSIGN_OR_RAISE(partials[i], UnifySchemas({schemas.begin() + begin,
+                                                     schemas.begin() + end}));
+    return Status::OK();
+  }));
+  return UnifySchemasInParallel(partials);
+}
+
+}  // namespace
+
 DatasetFactory::DatasetFactory() : root_partition_(scalar(true)) {}
 
 Result<std::shared_ptr<Schema>> DatasetFactory::Inspect(InspectOptions options) {
@@ -44,7 +73,7 @@ Result<std::shared_ptr<Schema>> DatasetFactory::Inspect(InspectOptions options)
     return arrow::schema({});
   }
 
-  return UnifySchemas(schemas);
+  return UnifySchemasInParallel(schemas);
 }
 
 Result<std::shared_ptr<Dataset>> DatasetFactory::Finish() {
@@ -80,7 +109,7 @@ Result<std::vector<std::shared_ptr<Schema>>> UnionDatasetFactory::InspectSchemas
 
   for (const auto& child_factory : factories_) {
     ARROW_ASSIGN_OR_RAISE(auto child_schemas, child_factory->InspectSchemas(options));
-    ARROW_ASSIGN_OR_RAISE(auto child_schema, UnifySchemas(child_schemas));
+    ARROW_ASSIGN_OR_RAISE(auto child_schema, UnifySchemasInParallel(child_schemas));
     schemas.emplace_back(child_schema);
   }
 
@@ -114,38 +143,30 @@ FileSystemDatasetFactory::FileSystemDatasetFactory(
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, const std::vector<std::string>& paths,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
-  std::vector<fs::FileInfo> filtered_files;
-  for (const auto& path : paths) {
-    if (options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(path, filesystem)));
-      if (!supported) {
-        continue;
-      }
-    }
-
-    filtered_files.emplace_back(path);
-  }
-
-  return std::shared_ptr<DatasetFactory>(
-      new FileSystemDatasetFactory(std::move(filtered_files), std::move(filesystem),
-                                   std::move(format), std::move(options)));
+  std::vector<fs::FileInfo> files(paths.begin(), paths.end());
+  return Make(std::move(filesystem), files, std::move(format), std::move(options));
 }
 
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, const std::vector<fs::FileInfo>& files,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
   std::vector<fs::FileInfo> filtered_files;
-  for (const auto& info : files) {
-    if (options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(info, filesystem)));
-      if (!supported) {
-        continue;
+  if (options.exclude_invalid_files) {
+    std::vector<char> supported(files.size());
+    RETURN_NOT_OK(ParallelForIO(
+        files.size(), options.io_concurrency, [&](int64_t i) -> Status {
+          ARROW_ASSIGN_OR_RAISE(supported[i],
+                                format->IsSupported(FileSource(files[i], filesystem)));
+          return Status::OK();
+        }));
+
+    for (size_t i = 0; i < files.size(); ++i) {
+      if (supported[i]) {
+        filtered_files.emplace_back(files[i]);
       }
     }
-
-    filtered_files.emplace_back(info);
+  } else {
+    filtered_files = files;
   }
 
   return std::shared_ptr<DatasetFactory>(
@@ -166,6 +187,53 @@ bool StartsWithAnyOf(const std::string& path, const std::vector<std::string>& pr
   });
 }
 
+// Equivalent to filesystem->GetFileInfo(selector), but directories are listed
+// concurrently. The tree is walked breadth first until a level holds enough
+// directories to keep max_concurrency listings busy, then each directory of that level
+// is listed recursively. Directories matching ignore_prefixes are not descended into.
+static Result<std::vector<fs::FileInfo>> ListFiles(
+    fs::FileSystem* filesystem, const fs::FileSelector& selector,
+    const std::vector<std::string>& ignore_prefixes, int max_concurrency) {
+  if (!selector.recursive || max_concurrency <= 1) {
+    return filesystem->GetFileInfo(selector);
+  }
+
+  std::vector<fs::FileInfo> files;
+  std::vector<std::string> dirs = {selector.base_dir};
+
+  // dirs are nested `depth` levels below selector.base_dir
+  for (int32_t depth = 0; !dirs.empty(); ++depth) {
+    const bool recursive = dirs.size() >= static_cast<size_t>(max_concurrency);
+
+    std::vector<std::vector<fs::FileInfo>> listings(dirs.size());
+    RETURN_NOT_OK(ParallelForIO(dirs.size(), max_concurrency, [&](int64_t i) -> Status {
+      fs::FileSelector dir_selector;
+      dir_selector.base_dir = dirs[i];
+      dir_selector.allow_not_found = selector.allow_not_found;
+      dir_selector.recursive = recursive;
+      dir_selector.max_recursion = selector.max_recursion - depth;
+      ARROW_ASSIGN_OR_RAISE(listings[i], filesystem->GetFileInfo(dir_selector));
+      return Status::OK();
+    }));
+
+    dirs.clear();
+    for (auto& listing : listings) {
+      for (auto& info : listing) {
+        if (!recursive && info.IsDirectory() && depth < selector.max_recursion) {
+          auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+          if (!relative.has_value() ||
+              !StartsWithAnyOf(std::string(*relative), ignore_prefixes)) {
+            dirs.push_back(info.path());
+          }
+        }
+        files.push_back(std::move(info));
+      }
+    }
+  }
+
+  return files;
+}
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
@@ -177,7 +245,9 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
+  ARROW_ASSIGN_OR_RAISE(
+      auto files, ListFiles(filesystem.get(), selector, options.selector_ignore_prefixes,
+                            options.io_concurrency));
 
   // Filter out anything that's not a file or that's explicitly ignored
   Status st;
@@ -210,14 +280,25 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
+  int64_t num_inspected = static_cast<int64_t>(files_.size());
+  if (options.fragments >= 0) {
+    num_inspected = std::min<int64_t>(num_inspected, options.fragments);
+  }
 
-  const bool has_fragments_limit = options.fragments >= 0;
-  int fragments = options.fragments;
-  for (const auto& info : files_) {
-    if (has_fragments_limit && fragments-- == 0) break;
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect({info, fs_}));
-    schemas.push_back(schema);
+  std::vector<std::shared_ptr<Schema>> schemas(static_cast<size_t>(num_inspected));
+  if (!options_.metadata_cache_path.empty()) {
+    RETURN_NOT_OK(EnsureMetadata());
+    for (int64_t i = 0; i < num_inspected; ++i) {
+      schemas[i] = metadata_[i].physical_schema;
+    }
+  } else {
+    // Each Inspect is typically a footer read: a round trip worth overlapping
+    RETURN_NOT_OK(ParallelForIO(num_inspected, options_.io_concurrency,
+                                [&](int64_t i) -> Status {
+                                  ARROW_ASSIGN_OR_RAISE(
+                                      schemas[i], format_->Inspect({files_[i], fs_}));
+                                  return Status::OK();
+                                }));
   }
 
   ARROW_ASSIGN_OR_RAISE(auto partition_schema,
@@ -250,16 +331,79 @@ Result<std::shared_ptr<Dataset>> FileSystemDatasetFactory::Finish(FinishOptions
     ARROW_ASSIGN_OR_RAISE(partitioning, factory->Finish(schema));
   }
 
+  const bool use_metadata = !options_.metadata_cache_path.empty();
+  if (use_metadata) {
+    RETURN_NOT_OK(EnsureMetadata());
+  }
+
   std::vector<std::shared_ptr<FileFragment>> fragments;
-  for (const auto& info : files_) {
+  for (size_t i = 0; i < files_.size(); ++i) {
+    const auto& info = files_[i];
     auto fixed_path = StripPrefixAndFilename(info.path(), options_.partition_base_dir);
     ARROW_ASSIGN_OR_RAISE(auto partition, partitioning->Parse(fixed_path));
-    ARROW_ASSIGN_OR_RAISE(auto fragment, format_->MakeFragment({info, fs_}, partition));
+    std::shared_ptr<FileFragment> fragment;
+    if (use_metadata) {
+      ARROW_ASSIGN_OR_RAISE(fragment, format_->MakeFragmentFromMetadata(
+                                          {info, fs_}, partition, metadata_[i]));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(fragment, format_->MakeFragment({info, fs_}, partition));
+    }
     fragments.push_back(fragment);
   }
 
   return FileSystemDataset::Make(schema, root_partition_, format_, fs_, fragments);
 }
 
+Status FileSystemDatasetFactory::EnsureMetadata() {
+  if (has_metadata_) {
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto cache,
+      MetadataCache::Read(fs_.get(), options_.metadata_cache_path, format_->type_name(),
+                          format_->metadata_fingerprint()));
+
+  // Explicitly listed paths carry no size or modification time to validate the cache
+  // entries against
+  if (std::any_of(files_.begin(), files_.end(), [](const fs::FileInfo& info) {
+        return info.type() == fs::FileType::Unknown;
+      })) {
+    std::vector<std::string> paths;
+    for (const auto& info : files_) {
+      paths.push_back(info.path());
+    }
+    ARROW_ASSIGN_OR_RAISE(files_, fs_->GetFileInfo(paths));
+  }
+
+  std::vector<FileMetadata> metadata(files_.size());
+  std::vector<char> cached(files_.size());
+  RETURN_NOT_OK(
+      ParallelForIO(files_.size(), options_.io_concurrency, [&](int64_t i) -> Status {
+        if (auto entry = cache->Find(files_[i])) {
+          metadata[i] = *entry;
+          cached[i] = true;
+          return Status::OK();
+        }
+        ARROW_ASSIGN_OR_RAISE(metadata[i], format_->ReadMetadata({files_[i], fs_}));
+        metadata[i].info = files_[i];
+        return Status::OK();
+      }));
+
+  // Rewrite the cache if any entry was missing or stale, or if files were removed
+  if (cache->size() != files_.size() ||
+      std::find(cached.begin(), cached.end(), false) != cached.end()) {
+    MetadataCache updated(format_->type_name(), format_->metadata_fingerprint());
+    for (const auto& file_metadata : metadata) {
+      updated.Insert(file_metadata);
+    }
+    RETURN_NOT_OK(updated.Write(fs_.get(), options_.metadata_cache_path));
+  }
+
+  metadata_ = std::move(metadata);
+  has_metadata_ = true;
+  return Status::OK();
+}
+
 }  // namespace dataset
 }  // namespace arrow
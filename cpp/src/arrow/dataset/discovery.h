@@ -161,12 +161,31 @@ struct FileSystemFactoryOptions {
   std::string partition_base_dir;
 
   // Invalid files (via selector or explicitly) will be excluded by checking
-  // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
+  // with the FileFormat::IsSupported method.  This will incur IO for each file
+  // (see io_concurrency). Disabling this feature will skip the
   // IO, but unsupported files may be present in the Dataset
   // (resulting in an error at scan time).
   bool exclude_invalid_files = false;
 
+  // Maximum number of IO requests in flight during discovery: listing the
+  // subdirectories of a recursive selector, IsSupported checks and reading the
+  // schema of each inspected file. Requests run on the IO thread pool, whose
+  // capacity also bounds them. A value of 1 makes discovery serial.
+  int io_concurrency = 8;
+
+  // If not empty, the path on the dataset's filesystem of a MetadataCache.
+  // InspectSchemas() and Finish() then take the physical schema and row group
+  // statistics of each file from the cache while the file's size and modification
+  // time are unchanged, read them (see FileFormat::ReadMetadata) for the other files
+  // and rewrite the cache if it was missing or stale. Fragments are created with
+  // complete metadata, so they can be filtered without IO.
+  //
+  // Note that while the cache is missing or stale the metadata of every file is read,
+  // regardless of InspectOptions::fragments. If the cache lives under the selector's
+  // base_dir, give it a name matched by selector_ignore_prefixes, for example
+  // "_metadata_cache.arrow".
+  std::string metadata_cache_path;
+
   // When discovering from a Selector (and not from an explicit file list), ignore
   // files and directories matching any of these prefixes.
   //
@@ -233,10 +252,17 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
 
   Result<std::shared_ptr<Schema>> PartitionSchema();
 
+  /// Populate metadata_ from options_.metadata_cache_path, updating the cache
+  Status EnsureMetadata();
+
   std::vector<fs::FileInfo> files_;
   std::shared_ptr<fs::FileSystem> fs_;
   std::shared_ptr<FileFormat> format_;
   FileSystemFactoryOptions options_;
+
+  /// Metadata of each of files_, once EnsureMetadata() was called
+  std::vector<FileMetadata> metadata_;
+  bool has_metadata_ = false;
 };
 
 }  // namespace dataset
@@ -20,8 +20,11 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/partition.h"
@@ -123,6 +126,19 @@ TEST_F(MockDatasetFactoryTest, UnifySchemas) {
   AssertInspectSchemas({schema({i32, f64}), schema({f64, i32_fake})});
 }
 
+TEST_F(MockDatasetFactoryTest, UnifyManySchemas) {
+  // Enough schemas to be unified in parallel runs; fields keep first-seen order
+  std::vector<std::shared_ptr<Schema>> schemas(1000, schema({i32_req}));
+  schemas[400] = schema({f64, i32});
+  schemas[999] = schema({i64});
+  MakeFactory(schemas);
+  AssertInspect(schema({i32, f64, i64}));
+
+  schemas[700] = schema({i32_fake});
+  MakeFactory(schemas);
+  ASSERT_RAISES(Invalid, factory_->Inspect());
+}
+
 class FileSystemDatasetFactoryTest : public DatasetFactoryTest {
  public:
   void MakeFactory(const std::vector<fs::FileInfo>& files) {
@@ -305,6 +321,44 @@ TEST_F(FileSystemDatasetFactoryTest, OptionsIgnoredPrefixesWithBaseDirectory) {
       {dir + "not_ignored_by_default", dir + "not_ignored_by_default_either/dat"});
 }
 
+TEST_F(FileSystemDatasetFactoryTest, ConcurrentDiscovery) {
+  selector_.base_dir = "base";
+  selector_.recursive = true;
+  factory_options_.exclude_invalid_files = true;
+
+  std::vector<fs::FileInfo> files;
+  std::vector<std::string> shallow_paths, all_paths;
+  for (int i = 0; i < 6; ++i) {
+    auto dir = "base/" + std::to_string(i);
+    files.push_back(fs::File(dir + "/dat"));
+    files.push_back(fs::File(dir + "/_temporary/dat"));
+    shallow_paths.push_back(dir + "/dat");
+    for (int j = 0; j < 6; ++j) {
+      files.push_back(fs::File(dir + "/" + std::to_string(j) + "/dat"));
+      all_paths.push_back(dir + "/" + std::to_string(j) + "/dat");
+    }
+  }
+  all_paths.insert(all_paths.end(), shallow_paths.begin(), shallow_paths.end());
+
+  InspectOptions inspect_all;
+  inspect_all.fragments = InspectOptions::kInspectAllFragments;
+
+  // Listings and inspections in flight concurrently find the same files as serial ones
+  for (int io_concurrency : {1, 2, 4, 64}) {
+    factory_options_.io_concurrency = io_concurrency;
+
+    selector_.max_recursion = std::numeric_limits<int32_t>::max();
+    MakeFactory(files);
+    ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(inspect_all));
+    EXPECT_THAT(schemas, SizeIs(all_paths.size() + 1));
+    AssertFinishWithPaths(all_paths, nullptr, inspect_all);
+
+    selector_.max_recursion = 1;
+    MakeFactory(files);
+    AssertFinishWithPaths(shallow_paths);
+  }
+}
+
 TEST_F(FileSystemDatasetFactoryTest, Inspect) {
   auto s = schema({field("f64", float64())});
   format_ = std::make_shared<DummyFileFormat>(s);
@@ -0,0 +1,510 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/exec_plan.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/util.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::TaskGroup;
+
+namespace dataset {
+
+Status ExecNode::InputFinished() {
+  if (output_ == NULLPTR) {
+    return Status::OK();
+  }
+  return output_->InputFinished();
+}
+
+Status ExecNode::EmitBatch(compute::ExecBatch batch) {
+  DCHECK_NE(output_, NULLPTR);
+  return output_->InputReceived(std::move(batch));
+}
+
+namespace {
+
+Result<std::shared_ptr<Array>> MaterializeValue(const Datum& value, int64_t length,
+                                                MemoryPool* pool) {
+  if (value.is_scalar()) {
+    return MakeArrayFromScalar(*value.scalar(), length, pool);
+  }
+  return value.make_array();
+}
+
+Result<std::shared_ptr<RecordBatch>> ToRecordBatch(std::shared_ptr<Schema> schema,
+                                                   const compute::ExecBatch& batch,
+                                                   MemoryPool* pool) {
+  std::vector<std::shared_ptr<Array>> columns(batch.values.size());
+  for (size_t i = 0; i < batch.values.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i], MaterializeValue(batch[i], batch.length, pool));
+  }
+  return RecordBatch::Make(std::move(schema), batch.length, std::move(columns));
+}
+
+compute::ExecBatch FromRecordBatch(const RecordBatch& batch) {
+  std::vector<Datum> values;
+  for (const auto& column : batch.columns()) {
+    values.emplace_back(column);
+  }
+  return compute::ExecBatch(std::move(values), batch.num_rows());
+}
+
+Result<std::vector<int>> FieldIndices(const Schema& schema,
+                                      const std::vector<std::string>& names) {
+  RETURN_NOT_OK(schema.CanReferenceFieldsByNames(names));
+  std::vector<int> indices;
+  for (const auto& name : names) {
+    indices.push_back(schema.GetFieldIndex(name));
+  }
+  return indices;
+}
+
+// ----------------------------------------------------------------------
+// Nodes
+
+class FilterNode : public ExecNode {
+ public:
+  FilterNode(std::shared_ptr<Schema> schema, std::shared_ptr<Expression> filter,
+             MemoryPool* pool)
+      : ExecNode(std::move(schema)), filter_(std::move(filter)), pool_(pool) {}
+
+  const char* kind_name() const override { return "filter"; }
+
+  Status InputReceived(compute::ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, ToRecordBatch(output_schema_, batch, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto selection,
+                          evaluator_.Evaluate(*filter_, *record_batch, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto filtered,
+                          evaluator_.Filter(selection, record_batch, pool_));
+    if (filtered->num_rows() == 0) {
+      return Status::OK();
+    }
+    return EmitBatch(FromRecordBatch(*filtered));
+  }
+
+ private:
+  std::shared_ptr<Expression> filter_;
+  FusedEvaluator evaluator_;
+  MemoryPool* pool_;
+};
+
+class ProjectNode : public ExecNode {
+ public:
+  ProjectNode(std::shared_ptr<Schema> input_schema, std::shared_ptr<Schema> output_schema,
+              std::vector<std::shared_ptr<Expression>> exprs, MemoryPool* pool)
+      : ExecNode(std::move(output_schema)),
+        input_schema_(std::move(input_schema)),
+        exprs_(std::move(exprs)),
+        pool_(pool) {}
+
+  const char* kind_name() const override { return "project"; }
+
+  Status InputReceived(compute::ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, ToRecordBatch(input_schema_, batch, pool_));
+
+    std::vector<Datum> values(exprs_.size());
+    for (size_t i = 0; i < exprs_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto value,
+                            evaluator_.Evaluate(*exprs_[i], *record_batch, pool_));
+      // Downstream nodes expect arrays, broadcast scalar results
+      ARROW_ASSIGN_OR_RAISE(values[i], MaterializeValue(value, batch.length, pool_));
+    }
+    return EmitBatch(compute::ExecBatch(std::move(values), batch.length));
+  }
+
+ private:
+  std::shared_ptr<Schema> input_schema_;
+  std::vector<std::shared_ptr<Expression>> exprs_;
+  TreeEvaluator evaluator_;
+  MemoryPool* pool_;
+};
+
+class AggregateNode : public ExecNode {
+ public:
+  AggregateNode(std::shared_ptr<Schema> output_schema, std::vector<int> column_indices,
+                std::vector<ValueDescr> argument_descrs,
+                std::vector<ValueDescr> key_descrs,
+                std::vector<compute::internal::Aggregate> aggregates,
+                compute::ExecContext* ctx)
+      : ExecNode(std::move(output_schema)),
+        column_indices_(std::move(column_indices)),
+        argument_descrs_(std::move(argument_descrs)),
+        key_descrs_(std::move(key_descrs)),
+        aggregates_(std::move(aggregates)),
+        ctx_(ctx) {}
+
+  const char* kind_name() const override { return "aggregate"; }
+
+  Status InputReceived(compute::ExecBatch batch) override {
+    std::vector<Datum> values;
+    for (int i : column_indices_) {
+      values.push_back(batch[i]);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto aggregator, AcquireAggregator());
+    Status st = aggregator->Consume(compute::ExecBatch(std::move(values), batch.length));
+    ReleaseAggregator(std::move(aggregator));
+    return st;
+  }
+
+  Status InputFinished() override {
+    ARROW_ASSIGN_OR_RAISE(auto aggregator, AcquireAggregator());
+    for (auto& other : idle_aggregators_) {
+      RETURN_NOT_OK(aggregator->Merge(std::move(*other)));
+    }
+    idle_aggregators_.clear();
+
+    ARROW_ASSIGN_OR_RAISE(auto out, aggregator->Finalize());
+    auto groups = out.make_array();
+    if (groups->length() > 0) {
+      std::vector<Datum> values;
+      for (const auto& column : checked_cast<const StructArray&>(*groups).fields()) {
+        values.emplace_back(column);
+      }
+      RETURN_NOT_OK(EmitBatch(compute::ExecBatch(std::move(values), groups->length())));
+    }
+    return ExecNode::InputFinished();
+  }
+
+ private:
+  // Every thread consuming input concurrently works on its own aggregator,
+  // the partial aggregations are merged once the input is exhausted.
+  Result<std::unique_ptr<compute::internal::GroupByAggregator>> AcquireAggregator() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!idle_aggregators_.empty()) {
+        auto aggregator = std::move(idle_aggregators_.back());
+        idle_aggregators_.pop_back();
+        return std::move(aggregator);
+      }
+    }
+    return compute::internal::GroupByAggregator::Make(argument_descrs_, key_descrs_,
+                                                      aggregates_, ctx_);
+  }
+
+  void ReleaseAggregator(std::unique_ptr<compute::internal::GroupByAggregator> agg) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_aggregators_.push_back(std::move(agg));
+  }
+
+  std::vector<int> column_indices_;
+  std::vector<ValueDescr> argument_descrs_, key_descrs_;
+  std::vector<compute::internal::Aggregate> aggregates_;
+  compute::ExecContext* ctx_;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<compute::internal::GroupByAggregator>> idle_aggregators_;
+};
+
+class SinkNode : public ExecNode {
+ public:
+  SinkNode(std::shared_ptr<Schema> schema, MemoryPool* pool)
+      : ExecNode(std::move(schema)), pool_(pool) {}
+
+  const char* kind_name() const override { return "sink"; }
+
+  Status InputReceived(compute::ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, ToRecordBatch(output_schema_, batch, pool_));
+    std::lock_guard<std::mutex> lock(mutex_);
+    batches_.push_back(std::move(record_batch));
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Table>> Finish() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return Table::FromRecordBatches(output_schema_, std::move(batches_));
+  }
+
+ private:
+  MemoryPool* pool_;
+  std::mutex mutex_;
+  RecordBatchVector batches_;
+};
+
+/// \brief A bounded queue of scanned batches in front of the first node.
+///
+/// Scan tasks push batches into the queue and a limited number of drain
+/// tasks push them through the plan. Nothing ever blocks: once the queue is
+/// full, a scan task processes its batch itself, which throttles the scan to
+/// the pace of the plan without occupying threads of the pool.
+class BatchQueue : public std::enable_shared_from_this<BatchQueue> {
+ public:
+  BatchQueue(ExecNode* head, TaskGroup* task_group, int64_t capacity, int max_drainers)
+      : head_(head),
+        task_group_(task_group),
+        capacity_(capacity),
+        max_drainers_(max_drainers) {}
+
+  Status Push(compute::ExecBatch batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (static_cast<int64_t>(queue_.size()) >= capacity_) {
+      lock.unlock();
+      return head_->InputReceived(std::move(batch));
+    }
+
+    queue_.push_back(std::move(batch));
+    if (num_drainers_ >= max_drainers_) {
+      return Status::OK();
+    }
+    ++num_drainers_;
+    lock.unlock();
+
+    auto self = shared_from_this();
+    task_group_->Append([self] { return self->Drain(); });
+    return Status::OK();
+  }
+
+ private:
+  Status Drain() {
+    while (true) {
+      compute::ExecBatch batch;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+          --num_drainers_;
+          return Status::OK();
+        }
+        batch = std::move(queue_.front());
+        queue_.pop_front();
+      }
+
+      Status st = head_->InputReceived(std::move(batch));
+      if (!st.ok()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --num_drainers_;
+        return st;
+      }
+    }
+  }
+
+  ExecNode* head_;
+  TaskGroup* task_group_;
+  const int64_t capacity_;
+  const int max_drainers_;
+
+  std::mutex mutex_;
+  std::deque<compute::ExecBatch> queue_;
+  int num_drainers_ = 0;
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ExecPlan
+
+struct ExecPlan::Impl {
+  Impl(std::shared_ptr<Scanner> scanner, ExecPlanOptions options)
+      : scanner(std::move(scanner)),
+        options(options),
+        ctx(this->scanner->context()->pool) {}
+
+  const std::shared_ptr<Schema>& output_schema() const {
+    return nodes.empty() ? scanner->schema() : nodes.back()->output_schema();
+  }
+
+  Status AddNode(std::unique_ptr<ExecNode> node) {
+    if (!nodes.empty()) {
+      nodes.back()->set_output(node.get());
+    }
+    nodes.push_back(std::move(node));
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Table>> Run() {
+    if (started) {
+      return Status::Invalid("An ExecPlan can only be run once");
+    }
+    started = true;
+
+    SinkNode sink(output_schema(), ctx.memory_pool());
+    ExecNode* head = &sink;
+    if (!nodes.empty()) {
+      nodes.back()->set_output(&sink);
+      head = nodes.front().get();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto scan_task_it, scanner->Scan());
+    auto task_group = scanner->context()->TaskGroup();
+
+    int max_drainers = options.max_concurrency > 0 ? options.max_concurrency
+                                                   : GetCpuThreadPoolCapacity();
+    auto queue = std::make_shared<BatchQueue>(head, task_group.get(),
+                                              options.queue_capacity, max_drainers);
+
+    Status st;
+    for (auto maybe_scan_task : scan_task_it) {
+      if (!maybe_scan_task.ok()) {
+        st = maybe_scan_task.status();
+        break;
+      }
+      auto scan_task = maybe_scan_task.MoveValueUnsafe();
+      task_group->Append([queue, scan_task] {
+        ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
+        for (auto maybe_batch : batch_it) {
+          ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+          RETURN_NOT_OK(queue->Push(FromRecordBatch(*batch)));
+        }
+        return Status::OK();
+      });
+    }
+
+    // Wait for the tasks already spawned even if the scan failed, they
+    // reference the nodes.
+    st &= task_group->Finish();
+    RETURN_NOT_OK(st);
+
+    RETURN_NOT_OK(head->InputFinished());
+    return sink.Finish();
+  }
+
+  std::shared_ptr<Scanner> scanner;
+  ExecPlanOptions options;
+  compute::ExecContext ctx;
+  std::vector<std::unique_ptr<ExecNode>> nodes;
+  bool started = false;
+};
+
+ExecPlan::ExecPlan(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+ExecPlan::~ExecPlan() = default;
+
+Result<std::unique_ptr<ExecPlan>> ExecPlan::Make(std::shared_ptr<Scanner> scanner,
+                                                 ExecPlanOptions options) {
+  if (options.queue_capacity <= 0) {
+    return Status::Invalid("ExecPlan queue capacity must be greater than 0, got ",
+                           options.queue_capacity);
+  }
+  if (options.max_concurrency < 0) {
+    return Status::Invalid("ExecPlan concurrency must not be negative, got ",
+                           options.max_concurrency);
+  }
+  return std::unique_ptr<ExecPlan>(
+      new ExecPlan(std::unique_ptr<Impl>(new Impl(std::move(scanner), options))));
+}
+
+const std::shared_ptr<Schema>& ExecPlan::output_schema() const {
+  return impl_->output_schema();
+}
+
+Status ExecPlan::Filter(std::shared_ptr<Expression> filter) {
+  const auto& schema = output_schema();
+  RETURN_NOT_OK(schema->CanReferenceFieldsByNames(FieldsInExpression(*filter)));
+  ARROW_ASSIGN_OR_RAISE(auto type, filter->Validate(*schema));
+  if (!type->Equals(boolean())) {
+    return Status::TypeError("Filter expression must evaluate to bool, got ", *type);
+  }
+  return impl_->AddNode(std::unique_ptr<ExecNode>(
+      new FilterNode(schema, std::move(filter), impl_->ctx.memory_pool())));
+}
+
+Status ExecPlan::Project(std::vector<std::shared_ptr<Expression>> exprs,
+                         std::vector<std::string> names) {
+  if (exprs.size() != names.size()) {
+    return Status::Invalid("Project got ", exprs.size(), " expressions but ",
+                           names.size(), " names");
+  }
+
+  const auto& schema = output_schema();
+  std::vector<std::shared_ptr<Field>> fields(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    RETURN_NOT_OK(schema->CanReferenceFieldsByNames(FieldsInExpression(*exprs[i])));
+    ARROW_ASSIGN_OR_RAISE(auto type, exprs[i]->Validate(*schema));
+    fields[i] = field(std::move(names[i]), std::move(type));
+  }
+
+  return impl_->AddNode(std::unique_ptr<ExecNode>(
+      new ProjectNode(schema, arrow::schema(std::move(fields)), std::move(exprs),
+                      impl_->ctx.memory_pool())));
+}
+
+Status ExecPlan::Aggregate(std::vector<compute::internal::Aggregate> aggregates,
+                           std::vector<std::string> arguments,
+                           std::vector<std::string> names,
+                           std::vector<std::string> keys) {
+  if (aggregates.size() != arguments.size() || aggregates.size() != names.size()) {
+    return Status::Invalid("Aggregate got ", aggregates.size(), " aggregates but ",
+                           arguments.size(), " arguments and ", names.size(), " names");
+  }
+  if (keys.empty()) {
+    return Status::Invalid("Aggregate requires at least one key");
+  }
+
+  const auto& schema = output_schema();
+  ARROW_ASSIGN_OR_RAISE(auto argument_indices, FieldIndices(*schema, arguments));
+  ARROW_ASSIGN_OR_RAISE(auto key_indices, FieldIndices(*schema, keys));
+
+  std::vector<ValueDescr> argument_descrs, key_descrs;
+  for (int i : argument_indices) {
+    argument_descrs.emplace_back(schema->field(i)->type(), ValueDescr::ARRAY);
+  }
+  for (int i : key_indices) {
+    key_descrs.emplace_back(schema->field(i)->type(), ValueDescr::ARRAY);
+  }
+
+  // Resolve the output types by finalizing an aggregator which consumed nothing
+  ARROW_ASSIGN_OR_RAISE(auto aggregator,
+                        compute::internal::GroupByAggregator::Make(
+                            argument_descrs, key_descrs, aggregates, &impl_->ctx));
+  ARROW_ASSIGN_OR_RAISE(auto empty, aggregator->Finalize());
+
+  std::vector<std::shared_ptr<Field>> fields;
+  const auto& struct_type = *empty.type();
+  for (size_t i = 0; i < names.size(); ++i) {
+    fields.push_back(field(std::move(names[i]), struct_type.child(i)->type()));
+  }
+  for (size_t i = 0; i < keys.size(); ++i) {
+    fields.push_back(
+        field(std::move(keys[i]), struct_type.child(names.size() + i)->type()));
+  }
+
+  auto column_indices = std::move(argument_indices);
+  column_indices.insert(column_indices.end(), key_indices.begin(), key_indices.end());
+
+  return impl_->AddNode(std::unique_ptr<ExecNode>(new AggregateNode(
+      arrow::schema(std::move(fields)), std::move(column_indices),
+      std::move(argument_descrs), std::move(key_descrs), std::move(aggregates),
+      &impl_->ctx)));
+}
+
+Status ExecPlan::AddNode(std::unique_ptr<ExecNode> node) {
+  return impl_->AddNode(std::move(node));
+}
+
+Result<std::shared_ptr<Table>> ExecPlan::Run() { return impl_->Run(); }
+
+}  // namespace dataset
+}  // namespace arrow
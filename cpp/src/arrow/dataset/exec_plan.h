@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A node of an ExecPlan.
+///
+/// Batches are pushed into a node with InputReceived(), which transforms them
+/// and pushes the results to the node's output. Nodes form a linear chain
+/// rooted at a Scanner and terminated by a sink collecting the results.
+class ARROW_DS_EXPORT ExecNode {
+ public:
+  virtual ~ExecNode() = default;
+
+  /// \brief A short name describing the kind of this node, e.g. "filter"
+  virtual const char* kind_name() const = 0;
+
+  /// \brief The schema of the batches emitted by this node
+  const std::shared_ptr<Schema>& output_schema() const { return output_schema_; }
+
+  /// \brief Receive a batch whose values match the output schema of the
+  /// preceding node.
+  ///
+  /// May be called concurrently from several threads.
+  virtual Status InputReceived(compute::ExecBatch batch) = 0;
+
+  /// \brief Called once after every input batch has been received.
+  ///
+  /// The default implementation forwards the notification to the output.
+  virtual Status InputFinished();
+
+  /// \brief Connect this node to the node receiving its output
+  void set_output(ExecNode* output) { output_ = output; }
+
+ protected:
+  explicit ExecNode(std::shared_ptr<Schema> output_schema)
+      : output_schema_(std::move(output_schema)) {}
+
+  /// \brief Push a batch to the output of this node
+  Status EmitBatch(compute::ExecBatch batch);
+
+  std::shared_ptr<Schema> output_schema_;
+  ExecNode* output_ = NULLPTR;
+};
+
+/// \brief Options controlling the execution of an ExecPlan
+struct ARROW_DS_EXPORT ExecPlanOptions {
+  /// Maximum number of scanned batches waiting to be pushed through the plan.
+  /// Once the queue is full, scanning threads process their batches
+  /// themselves instead of reading further ahead.
+  int64_t queue_capacity = 16;
+
+  /// Maximum number of threads pushing queued batches through the plan.
+  /// Zero means the capacity of the CPU thread pool.
+  int max_concurrency = 0;
+};
+
+/// \brief A push-based pipeline of operators fed by a Scanner.
+///
+/// Scanned batches flow through every node on the thread which picked them
+/// up, so a batch remains cache resident from the scan to the final
+/// aggregation and only a bounded number of batches is in flight at once.
+/// The Scanner's ScanContext decides whether the plan runs on the CPU thread
+/// pool; when it does, the order of the output rows is unspecified.
+///
+/// \code
+/// ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(scanner));
+/// RETURN_NOT_OK(plan->Filter(greater(field_ref("a"), scalar(0))));
+/// RETURN_NOT_OK(plan->Project({field_ref("b")}, {"b"}));
+/// ARROW_ASSIGN_OR_RAISE(auto table, plan->Run());
+/// \endcode
+class ARROW_DS_EXPORT ExecPlan {
+ public:
+  ~ExecPlan();
+
+  static Result<std::unique_ptr<ExecPlan>> Make(std::shared_ptr<Scanner> scanner,
+                                                ExecPlanOptions options = {});
+
+  /// \brief Append a node keeping the rows which satisfy a boolean expression
+  Status Filter(std::shared_ptr<Expression> filter);
+
+  /// \brief Append a node computing one named column per expression
+  Status Project(std::vector<std::shared_ptr<Expression>> exprs,
+                 std::vector<std::string> names);
+
+  /// \brief Append a node computing grouped aggregations.
+  ///
+  /// Each aggregate is applied to the column of the same index in arguments
+  /// and emitted under the column of the same index in names, followed by
+  /// the key columns. The node emits a single batch once its input is
+  /// exhausted.
+  Status Aggregate(std::vector<compute::internal::Aggregate> aggregates,
+                   std::vector<std::string> arguments, std::vector<std::string> names,
+                   std::vector<std::string> keys);
+
+  /// \brief Append a custom node. Its input is the output of the last node.
+  Status AddNode(std::unique_ptr<ExecNode> node);
+
+  /// \brief The schema of the batches produced by the last node
+  const std::shared_ptr<Schema>& output_schema() const;
+
+  /// \brief Scan the dataset, push every batch through the plan and collect
+  /// the output.
+  ///
+  /// A plan can be run only once.
+  Result<std::shared_ptr<Table>> Run();
+
+ private:
+  struct Impl;
+
+  explicit ExecPlan(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
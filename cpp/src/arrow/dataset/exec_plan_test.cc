@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/exec_plan.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestExecPlan : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    schema_ = schema({field("k", utf8()), field("a", int64()), field("b", float64())});
+    batches_ = {
+        RecordBatchFromJSON(schema_, R"([["x", 1, 0.5], ["y", 2, 1.5], [null, 3, 2.5]])"),
+        RecordBatchFromJSON(schema_, R"([["y", -4, 3.5], ["x", 5, null]])"),
+        RecordBatchFromJSON(schema_, R"([["z", 6, 4.5], ["x", -7, 5.5], ["y", 8, 6.5]])"),
+    };
+  }
+
+  std::shared_ptr<Scanner> MakeScanner() {
+    auto dataset = std::make_shared<InMemoryDataset>(schema_, batches_);
+    auto context = std::make_shared<ScanContext>();
+    context->use_threads = GetParam();
+    ScannerBuilder builder(dataset, context);
+    EXPECT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    return scanner;
+  }
+
+  // Threaded plans emit rows in an unspecified order
+  std::shared_ptr<Table> SortBy(const std::shared_ptr<Table>& table,
+                                const std::string& column) {
+    compute::SortOptions options({compute::SortKey(column)});
+    EXPECT_OK_AND_ASSIGN(auto indices, compute::SortIndices(Datum(table), options));
+    EXPECT_OK_AND_ASSIGN(auto sorted, compute::Take(table, indices));
+    return sorted.table();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+};
+
+TEST_P(TestExecPlan, ScanOnly) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(MakeScanner()));
+  AssertSchemaEqual(*schema_, *plan->output_schema());
+
+  ASSERT_OK_AND_ASSIGN(auto table, plan->Run());
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches_));
+  AssertTablesEqual(*SortBy(expected, "a"), *SortBy(table, "a"),
+                    /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestExecPlan, FilterProject) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(MakeScanner()));
+  ASSERT_OK(plan->Filter(greater(field_ref("a"), scalar<int64_t>(0))));
+  ASSERT_OK(plan->Project({field_ref("a"), field_ref("k"), scalar(true)},
+                          {"a", "key", "flag"}));
+  AssertSchemaEqual(
+      *schema({field("a", int64()), field("key", utf8()), field("flag", boolean())}),
+      *plan->output_schema());
+
+  ASSERT_OK_AND_ASSIGN(auto table, plan->Run());
+  auto expected = TableFromJSON(plan->output_schema(), {R"([
+    [1, "x", true], [2, "y", true], [3, null, true],
+    [5, "x", true], [6, "z", true], [8, "y", true]
+  ])"});
+  AssertTablesEqual(*expected, *SortBy(table, "a"), /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestExecPlan, FilterEverything) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(MakeScanner()));
+  ASSERT_OK(plan->Filter(greater(field_ref("a"), scalar<int64_t>(100))));
+
+  ASSERT_OK_AND_ASSIGN(auto table, plan->Run());
+  ASSERT_EQ(table->num_rows(), 0);
+  AssertSchemaEqual(*schema_, *table->schema());
+}
+
+TEST_P(TestExecPlan, FilterAggregate) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(MakeScanner()));
+  ASSERT_OK(plan->Filter(not_equal(field_ref("k"), scalar("z"))));
+  ASSERT_OK(plan->Aggregate({{"hash_sum", nullptr}, {"hash_count", nullptr}},
+                            {"a", "b"}, {"sum_a", "count_b"}, {"k"}));
+  AssertSchemaEqual(*schema({field("sum_a", int64()), field("count_b", int64()),
+                             field("k", utf8())}),
+                    *plan->output_schema());
+
+  // The null key fails the filter like "z"
+  ASSERT_OK_AND_ASSIGN(auto table, plan->Run());
+  auto expected = TableFromJSON(plan->output_schema(), {R"([
+    [-1, 2, "x"], [6, 3, "y"]
+  ])"});
+  AssertTablesEqual(*SortBy(expected, "k"), *SortBy(table, "k"),
+                    /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestExecPlan, ProjectAggregate) {
+  // Exercise the caller-runs path of the queue
+  ExecPlanOptions options;
+  options.queue_capacity = 1;
+  options.max_concurrency = 2;
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(MakeScanner(), options));
+  ASSERT_OK(plan->Project({field_ref("a"), scalar("all")}, {"a", "group"}));
+  ASSERT_OK(plan->Aggregate({{"hash_sum", nullptr}}, {"a"}, {"total"}, {"group"}));
+
+  ASSERT_OK_AND_ASSIGN(auto table, plan->Run());
+  auto expected = TableFromJSON(plan->output_schema(), {R"([[14, "all"]])"});
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestExecPlan, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(MakeScanner()));
+  ASSERT_RAISES(TypeError, plan->Filter(field_ref("a")));
+  ASSERT_RAISES(Invalid, plan->Filter(equal(field_ref("nope"), scalar(1))));
+  ASSERT_RAISES(Invalid, plan->Project({field_ref("a")}, {}));
+  ASSERT_RAISES(Invalid,
+                plan->Aggregate({{"hash_sum", nullptr}}, {"a"}, {"sum_a"}, {"nope"}));
+  ASSERT_RAISES(Invalid, plan->Aggregate({{"hash_sum", nullptr}}, {"a"}, {"sum_a"}, {}));
+
+  ASSERT_OK(plan->Run());
+  ASSERT_RAISES(Invalid, plan->Run());
+
+  ExecPlanOptions options;
+  options.queue_capacity = 0;
+  ASSERT_RAISES(Invalid, ExecPlan::Make(MakeScanner(), options));
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecPlan, TestExecPlan, ::testing::Values(false, true));
+
+}  // namespace dataset
+}  // namespace arrow
@@ -18,6 +18,11 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <iterator>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
@@ -143,6 +148,24 @@ FragmentIterator FileSystemDataset::GetFragmentsImpl(
   return MakeVectorIterator(std::move(fragments));
 }
 
+Result<FileMetadata> FileFormat::ReadMetadata(const FileSource& source) const {
+  FileMetadata metadata;
+  ARROW_ASSIGN_OR_RAISE(metadata.physical_schema, Inspect(source));
+  return metadata;
+}
+
+Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragmentFromMetadata(
+    FileSource source, std::shared_ptr<Expression> partition_expression,
+    const FileMetadata& metadata) {
+  return MakeFragment(std::move(source), std::move(partition_expression),
+                      metadata.physical_schema);
+}
+
+Result<std::shared_ptr<FileWriter>> FileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema) const {
+  return Status::NotImplemented("incremental writing of ", type_name(), " files");
+}
+
 struct WriteTask {
   Status Execute();
 
@@ -237,5 +260,170 @@ Status FileSystemDataset::Write(std::shared_ptr<Schema> schema,
   return task_group->Finish();
 }
 
+Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& options,
+                                RecordBatchIterator batches) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, FileSystemDatasetWriter::Make(options));
+  for (auto maybe_batch : batches) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+    RETURN_NOT_OK(writer->Write(batch));
+  }
+  return writer->Finish();
+}
+
+struct FileSystemDatasetWriter::Impl {
+  struct OpenFile {
+    std::shared_ptr<FileWriter> writer;
+    int64_t num_rows;
+    /// Position of this file's directory in lru_
+    std::list<std::string>::iterator lru_position;
+  };
+
+  explicit Impl(FileSystemDatasetWriteOptions options) : options_(std::move(options)) {
+    options_.base_dir = std::string(fs::internal::RemoveTrailingSlash(options_.base_dir));
+  }
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) {
+    ARROW_ASSIGN_OR_RAISE(auto partitioned_batches,
+                          options_.partitioning->Partition(batch));
+
+    for (const auto& partitioned_batch : partitioned_batches) {
+      std::string dir = options_.base_dir;
+      if (!partitioned_batch.partition_expression->Equals(true)) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto path,
+            options_.partitioning->Format(*partitioned_batch.partition_expression));
+        dir += fs::internal::EnsureLeadingSlash(path);
+      }
+      RETURN_NOT_OK(WriteToDirectory(dir, partitioned_batch.batch));
+    }
+    return Status::OK();
+  }
+
+  Status Finish() {
+    while (!lru_.empty()) {
+      RETURN_NOT_OK(CloseFile(lru_.front()));
+    }
+    return Status::OK();
+  }
+
+  // Append rows to the open file of a directory, rolling over to new files whenever
+  // max_rows_per_file is reached.
+  Status WriteToDirectory(const std::string& dir,
+                          const std::shared_ptr<RecordBatch>& batch) {
+    const int64_t max_rows = options_.max_rows_per_file;
+
+    for (int64_t offset = 0; offset < batch->num_rows();) {
+      ARROW_ASSIGN_OR_RAISE(OpenFile * file, GetOpenFile(dir, batch->schema()));
+
+      int64_t length = batch->num_rows() - offset;
+      if (max_rows > 0) {
+        length = std::min(length, max_rows - file->num_rows);
+      }
+      RETURN_NOT_OK(file->writer->Write(length == batch->num_rows()
+                                            ? batch
+                                            : batch->Slice(offset, length)));
+      file->num_rows += length;
+      offset += length;
+
+      if (max_rows > 0 && file->num_rows == max_rows) {
+        RETURN_NOT_OK(CloseFile(dir));
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<OpenFile*> GetOpenFile(const std::string& dir,
+                                const std::shared_ptr<Schema>& schema) {
+    auto it = open_files_.find(dir);
+    if (it != open_files_.end()) {
+      // mark as most recently written
+      lru_.splice(lru_.end(), lru_, it->second.lru_position);
+      return &it->second;
+    }
+
+    if (open_files_.size() >= static_cast<size_t>(options_.max_open_files)) {
+      RETURN_NOT_OK(CloseFile(lru_.front()));
+    }
+
+    if (!dir.empty() && created_dirs_.insert(dir).second) {
+      RETURN_NOT_OK(options_.filesystem->CreateDir(dir, /*recursive=*/true));
+    }
+
+    auto basename = options_.basename_prefix + std::to_string(written_files_.size()) +
+                    "." + options_.format->type_name();
+    auto path = fs::internal::ConcatAbstractPath(dir, basename);
+    ARROW_ASSIGN_OR_RAISE(auto destination, options_.filesystem->OpenOutputStream(path));
+    ARROW_ASSIGN_OR_RAISE(auto writer,
+                          options_.format->MakeWriter(std::move(destination), schema));
+    written_files_.push_back(std::move(path));
+
+    lru_.push_back(dir);
+    OpenFile& file = open_files_[dir];
+    file.writer = std::move(writer);
+    file.num_rows = 0;
+    file.lru_position = std::prev(lru_.end());
+    return &file;
+  }
+
+  Status CloseFile(std::string dir) {
+    auto it = open_files_.find(dir);
+    DCHECK(it != open_files_.end());
+    auto writer = std::move(it->second.writer);
+    lru_.erase(it->second.lru_position);
+    open_files_.erase(it);
+    return writer->Finish();
+  }
+
+  FileSystemDatasetWriteOptions options_;
+
+  /// Open files keyed by directory, and those directories from least to most
+  /// recently written
+  std::unordered_map<std::string, OpenFile> open_files_;
+  std::list<std::string> lru_;
+
+  std::unordered_set<std::string> created_dirs_;
+  std::vector<std::string> written_files_;
+};
+
+FileSystemDatasetWriter::FileSystemDatasetWriter(FileSystemDatasetWriteOptions options)
+    : impl_(new Impl(std::move(options))) {}
+
+FileSystemDatasetWriter::~FileSystemDatasetWriter() = default;
+
+Result<std::unique_ptr<FileSystemDatasetWriter>> FileSystemDatasetWriter::Make(
+    FileSystemDatasetWriteOptions options) {
+  if (options.format == nullptr || options.filesystem == nullptr ||
+      options.partitioning == nullptr) {
+    return Status::Invalid(
+        "FileSystemDatasetWriteOptions requires a format, filesystem and partitioning");
+  }
+  if (options.max_open_files <= 0) {
+    return Status::Invalid("max_open_files must be positive, got ",
+                           options.max_open_files);
+  }
+  if (options.max_rows_per_file < 0) {
+    return Status::Invalid("max_rows_per_file must not be negative, got ",
+                           options.max_rows_per_file);
+  }
+  for (const auto& f : options.partitioning->schema()->fields()) {
+    if (f->type()->id() == Type::DICTIONARY) {
+      return Status::NotImplemented("writing with dictionary partitions");
+    }
+  }
+
+  return std::unique_ptr<FileSystemDatasetWriter>(
+      new FileSystemDatasetWriter(std::move(options)));
+}
+
+Status FileSystemDatasetWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
+  return impl_->Write(batch);
+}
+
+Status FileSystemDatasetWriter::Finish() { return impl_->Finish(); }
+
+const std::vector<std::string>& FileSystemDatasetWriter::written_files() const {
+  return impl_->written_files_;
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -117,6 +117,47 @@ class ARROW_DS_EXPORT FileSource {
   Compression::type compression_ = Compression::UNCOMPRESSED;
 };
 
+/// \brief Summary of an independently skippable unit of a file, such as a Parquet
+/// RowGroup
+struct ARROW_DS_EXPORT RowGroupMetadata {
+  /// Index of the unit in the file
+  int id = -1;
+  int64_t num_rows = -1;
+  int64_t total_byte_size = -1;
+  /// Per column statistics, as in RowGroupInfo::statistics(). May be null.
+  std::shared_ptr<StructScalar> statistics;
+};
+
+/// \brief The metadata of a file from which its fragment can be recreated without IO.
+///
+/// See FileFormat::ReadMetadata and MetadataCache.
+struct ARROW_DS_EXPORT FileMetadata {
+  /// Path, size and modification time of the described file
+  fs::FileInfo info;
+  std::shared_ptr<Schema> physical_schema;
+  /// Empty if the format has no notion of row groups
+  std::vector<RowGroupMetadata> row_groups;
+};
+
+/// \brief Writes record batches of a fixed schema to a single file
+class ARROW_DS_EXPORT FileWriter {
+ public:
+  virtual ~FileWriter() = default;
+
+  /// \brief Append a batch to the file. The batch must match schema().
+  virtual Status Write(const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief Write any buffered data and footer, then close the destination.
+  virtual Status Finish() = 0;
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+ protected:
+  explicit FileWriter(std::shared_ptr<Schema> schema) : schema_(std::move(schema)) {}
+
+  std::shared_ptr<Schema> schema_;
+};
+
 /// \brief Base class for file format implementation
 class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileFormat> {
  public:
@@ -155,6 +196,31 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   /// FIXME(bkietz) make this pure virtual
   virtual Status WriteFragment(RecordBatchReader* batches,
                                io::OutputStream* destination) const = 0;
+
+  /// \brief Read the metadata of a file, such as the statistics of its row groups.
+  ///
+  /// The default implementation reads the physical schema only. FileMetadata::info is
+  /// left for the caller to fill.
+  virtual Result<FileMetadata> ReadMetadata(const FileSource& source) const;
+
+  /// \brief A fingerprint of the options which ReadMetadata depends on.
+  ///
+  /// Metadata cached by MetadataCache is only reused by formats with the same
+  /// type_name() and fingerprint. Formats whose metadata doesn't depend on their
+  /// options return an empty string.
+  virtual std::string metadata_fingerprint() const { return ""; }
+
+  /// \brief Open a fragment from metadata returned by ReadMetadata, without IO.
+  virtual Result<std::shared_ptr<FileFragment>> MakeFragmentFromMetadata(
+      FileSource source, std::shared_ptr<Expression> partition_expression,
+      const FileMetadata& metadata);
+
+  /// \brief Open a writer which appends batches to destination incrementally.
+  ///
+  /// The writer takes ownership of destination and closes it in Finish().
+  virtual Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const;
 };
 
 /// \brief A Fragment that is stored in a file with a known format
@@ -224,6 +290,14 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
                       std::shared_ptr<ScanContext> scan_context,
                       FragmentIterator fragments);
 
+  /// \brief Write a stream of batches, splitting rows across partitions.
+  ///
+  /// Unlike the overload above, the input need not be partitioned already: each
+  /// batch is grouped by the key columns of options.partitioning. See
+  /// FileSystemDatasetWriter.
+  static Status Write(const FileSystemDatasetWriteOptions& options,
+                      RecordBatchIterator batches);
+
   /// \brief Return the type name of the dataset.
   std::string type_name() const override { return "filesystem"; }
 
@@ -256,5 +330,62 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   std::vector<std::shared_ptr<FileFragment>> fragments_;
 };
 
+struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
+  /// FileFormat with which files will be written.
+  std::shared_ptr<FileFormat> format;
+
+  /// FileSystem into which the dataset will be written.
+  std::shared_ptr<fs::FileSystem> filesystem;
+
+  /// Root directory into which the dataset will be written.
+  std::string base_dir;
+
+  /// Partitioning used to split rows and generate directory paths. Key columns
+  /// are removed from the written batches.
+  std::shared_ptr<Partitioning> partitioning = Partitioning::Default();
+
+  /// Maximum number of files held open at once. When a batch must be routed to a
+  /// partition without an open file and the limit is reached, the least recently
+  /// written file is finished; later rows of that partition go to a new file.
+  int max_open_files = 1024;
+
+  /// Maximum number of rows written to a single file. 0 means unlimited.
+  int64_t max_rows_per_file = 0;
+
+  /// Written files are named {basename_prefix}{counter}.{format->type_name()}
+  std::string basename_prefix = "part-";
+};
+
+/// \brief Writes a stream of record batches into a partitioned directory tree in a
+/// single pass.
+///
+/// Each batch is grouped by the key columns of the partitioning and every group is
+/// appended to a writer opened for its partition directory. Open writers are pooled:
+/// at most max_open_files are held at once, evicting the least recently written.
+///
+/// Not thread safe; Write() and Finish() must be called serially.
+class ARROW_DS_EXPORT FileSystemDatasetWriter {
+ public:
+  static Result<std::unique_ptr<FileSystemDatasetWriter>> Make(
+      FileSystemDatasetWriteOptions options);
+
+  ~FileSystemDatasetWriter();
+
+  /// \brief Route the rows of a batch to the files of their partitions.
+  Status Write(const std::shared_ptr<RecordBatch>& batch);
+
+  /// \brief Finish all files which are still open.
+  Status Finish();
+
+  /// \brief Paths of every file written so far, in order of creation.
+  const std::vector<std::string>& written_files() const;
+
+ private:
+  explicit FileSystemDatasetWriter(FileSystemDatasetWriteOptions options);
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace dataset
 }  // namespace arrow
@@ -34,6 +34,7 @@
 #include "arrow/result.h"
 #include "arrow/type.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/string_builder.h"
 
 namespace arrow {
 namespace dataset {
@@ -167,6 +168,15 @@ Result<std::shared_ptr<Schema>> CsvFileFormat::Inspect(const FileSource& source)
   return reader->schema();
 }
 
+std::string CsvFileFormat::metadata_fingerprint() const {
+  // Inferred schemas depend on how files are parsed. Every option is a single
+  // character or boolean, so their concatenation is unambiguous.
+  const auto& p = parse_options;
+  return util::StringBuilder(p.delimiter, p.quoting, p.quote_char, p.double_quote,
+                             p.escaping, p.escape_char, p.newlines_in_values,
+                             p.ignore_empty_lines);
+}
+
 Result<ScanTaskIterator> CsvFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
                                                  std::shared_ptr<ScanContext> context,
                                                  FileFragment* fragment) const {
@@ -18,18 +18,34 @@
 #include "arrow/dataset/file_ipc.h"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
+#include <numeric>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
 static inline ipc::IpcReadOptions default_read_options() {
@@ -68,6 +84,184 @@ static inline Result<std::vector<int>> GetIncludedFields(
   return included_fields;
 }
 
+// Statistics of each record batch are stored in the file footer's custom metadata as a
+// base64 encoded IPC stream holding one single row batch per record batch in the file,
+// with a column of type struct<min, max, null_count> for each field with statistics.
+constexpr char kStatisticsKey[] = "ARROW:dataset:statistics";
+
+static bool HasStatistics(const DataType& type) {
+  return is_integer(type.id()) || type.id() == Type::FLOAT ||
+         type.id() == Type::DOUBLE || type.id() == Type::BOOL;
+}
+
+template <typename ArrayType>
+static bool HasNaN(const Array& column) {
+  const auto& values = checked_cast<const ArrayType&>(column);
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsValid(i) && std::isnan(values.Value(i))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Return the statistics of a column, or null if they can't be expressed as a range
+// containing every non null value (NaNs compare false to any bound).
+static Result<std::shared_ptr<Scalar>> ColumnStatistics(
+    const Array& column, const std::shared_ptr<DataType>& statistics_type) {
+  const auto& type = column.type();
+  std::shared_ptr<Scalar> min, max;
+  if (column.null_count() == column.length()) {
+    min = max = MakeNullScalar(type);
+  } else if ((type->id() == Type::FLOAT && HasNaN<FloatArray>(column)) ||
+             (type->id() == Type::DOUBLE && HasNaN<DoubleArray>(column))) {
+    return MakeNullScalar(statistics_type);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto min_max, compute::MinMax(column));
+    const auto& min_max_scalar = checked_cast<const StructScalar&>(*min_max.scalar());
+    min = min_max_scalar.value[0];
+    max = min_max_scalar.value[1];
+  }
+
+  ScalarVector values{std::move(min), std::move(max), MakeScalar(column.null_count())};
+  return std::make_shared<StructScalar>(std::move(values), statistics_type);
+}
+
+/// \brief Accumulate the statistics of each record batch written to an IPC file.
+class BatchStatisticsWriter {
+ public:
+  static Result<std::unique_ptr<BatchStatisticsWriter>> Make(const Schema& schema) {
+    std::unique_ptr<BatchStatisticsWriter> writer(new BatchStatisticsWriter);
+    FieldVector statistics_fields;
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      const auto& field = schema.field(i);
+      if (!HasStatistics(*field->type())) continue;
+
+      writer->field_indices_.push_back(i);
+      statistics_fields.push_back(::arrow::field(
+          field->name(), struct_({::arrow::field("min", field->type()),
+                                  ::arrow::field("max", field->type()),
+                                  ::arrow::field("null_count", int64())})));
+    }
+    writer->schema_ = ::arrow::schema(std::move(statistics_fields));
+
+    ARROW_ASSIGN_OR_RAISE(writer->sink_, io::BufferOutputStream::Create());
+    ARROW_ASSIGN_OR_RAISE(writer->writer_,
+                          ipc::MakeStreamWriter(writer->sink_, writer->schema_));
+    return std::move(writer);
+  }
+
+  Status Append(const RecordBatch& batch) {
+    ArrayVector columns;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto statistics,
+                            ColumnStatistics(*batch.column(field_indices_[i]),
+                                             schema_->field(i)->type()));
+      ARROW_ASSIGN_OR_RAISE(auto column, MakeArrayFromScalar(*statistics, 1));
+      columns.push_back(std::move(column));
+    }
+    return writer_->WriteRecordBatch(*RecordBatch::Make(schema_, 1, std::move(columns)));
+  }
+
+  /// Store the accumulated statistics in a file footer's custom metadata. This must be
+  /// called before the file writer is closed.
+  Status Finish(KeyValueMetadata* footer_metadata) {
+    RETURN_NOT_OK(writer_->Close());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, sink_->Finish());
+    auto size = static_cast<unsigned int>(buffer->size());
+    footer_metadata->Append(kStatisticsKey, util::base64_encode(buffer->data(), size));
+    return Status::OK();
+  }
+
+ private:
+  BatchStatisticsWriter() = default;
+
+  std::vector<int> field_indices_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<io::BufferOutputStream> sink_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+};
+
+/// \brief Read the statistics of each record batch in an IPC file, if any were written.
+static Result<std::vector<std::shared_ptr<StructScalar>>> ReadBatchStatistics(
+    const ipc::RecordBatchFileReader& reader) {
+  std::vector<std::shared_ptr<StructScalar>> statistics;
+  auto footer_metadata = reader.metadata();
+  int i = footer_metadata == nullptr ? -1 : footer_metadata->FindKey(kStatisticsKey);
+  if (i == -1) {
+    return statistics;
+  }
+
+  io::BufferReader stream(
+      Buffer::FromString(util::base64_decode(footer_metadata->value(i))));
+  ARROW_ASSIGN_OR_RAISE(auto statistics_reader,
+                        ipc::RecordBatchStreamReader::Open(&stream));
+  auto type = struct_(statistics_reader->schema()->fields());
+  for (;;) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, statistics_reader->Next());
+    if (batch == nullptr) break;
+    if (batch->num_rows() != 1) {
+      return Status::Invalid("Statistics of each IPC record batch must be a single row");
+    }
+
+    ScalarVector values;
+    for (const auto& column : batch->columns()) {
+      ARROW_ASSIGN_OR_RAISE(auto value, column->GetScalar(0));
+      values.push_back(std::move(value));
+    }
+    statistics.push_back(std::make_shared<StructScalar>(std::move(values), type));
+  }
+
+  if (static_cast<int>(statistics.size()) != reader.num_record_batches()) {
+    return Status::Invalid("IPC file holds ", reader.num_record_batches(),
+                           " record batches but statistics for ", statistics.size());
+  }
+  return statistics;
+}
+
+/// \brief Return an expression which is satisfied by every row of a record batch with
+/// the given statistics.
+static std::shared_ptr<Expression> StatisticsAsExpression(
+    const StructScalar& statistics) {
+  ExpressionVector expressions;
+  for (size_t i = 0; i < statistics.value.size(); ++i) {
+    if (!statistics.value[i]->is_valid) continue;
+
+    const auto& column_statistics =
+        checked_cast<const StructScalar&>(*statistics.value[i]);
+    auto field_expr = field_ref(statistics.type->field(static_cast<int>(i))->name());
+    const auto& min = column_statistics.value[0];
+    const auto& max = column_statistics.value[1];
+
+    // min and max are null when every value is null
+    expressions.push_back(min->is_valid ? and_(greater_equal(field_expr, scalar(min)),
+                                               less_equal(field_expr, scalar(max)))
+                                        : equal(std::move(field_expr), scalar(min)));
+  }
+  return expressions.empty() ? scalar(true) : and_(expressions);
+}
+
+/// \brief Select the record batches of an IPC file whose statistics can satisfy filter.
+static Result<std::vector<int>> SelectBatches(const ipc::RecordBatchFileReader& reader,
+                                              const Expression& filter) {
+  std::vector<int> batches(reader.num_record_batches());
+  std::iota(batches.begin(), batches.end(), 0);
+  if (filter.Equals(true)) {
+    return batches;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto statistics, ReadBatchStatistics(reader));
+  if (statistics.empty()) {
+    return batches;
+  }
+
+  auto end = std::remove_if(batches.begin(), batches.end(), [&](int i) {
+    return !filter.IsSatisfiableWith(StatisticsAsExpression(*statistics[i]));
+  });
+  batches.erase(end, batches.end());
+  return batches;
+}
+
 /// \brief A ScanTask backed by an Ipc file.
 class IpcScanTask : public ScanTask {
  public:
@@ -79,31 +273,40 @@ class IpcScanTask : public ScanTask {
     struct Impl {
       static Result<RecordBatchIterator> Make(
           const FileSource& source, std::vector<std::string> materialized_fields,
-          MemoryPool* pool) {
+          const Expression& filter, MemoryPool* pool) {
         ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
 
+        // Skip record batches (and the file itself) whose statistics can't satisfy
+        // the filter.
+        ARROW_ASSIGN_OR_RAISE(auto batches, SelectBatches(*reader, filter));
+        if (batches.empty()) {
+          return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+        }
+
         auto options = default_read_options();
         options.memory_pool = pool;
         ARROW_ASSIGN_OR_RAISE(options.included_fields,
                               GetIncludedFields(*reader->schema(), materialized_fields));
 
         ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options));
-        return RecordBatchIterator(Impl{std::move(reader), 0});
+        return RecordBatchIterator(Impl{std::move(reader), std::move(batches), 0});
       }
 
       Result<std::shared_ptr<RecordBatch>> Next() {
-        if (i_ == reader_->num_record_batches()) {
+        if (i_ == batches_.size()) {
           return nullptr;
         }
 
-        return reader_->ReadRecordBatch(i_++);
+        return reader_->ReadRecordBatch(batches_[i_++]);
       }
 
       std::shared_ptr<ipc::RecordBatchFileReader> reader_;
-      int i_;
+      std::vector<int> batches_;
+      size_t i_;
     };
 
-    return Impl::Make(source_, options_->MaterializedFields(), context_->pool);
+    return Impl::Make(source_, options_->MaterializedFields(), *options_->filter,
+                      context_->pool);
   }
 
  private:
@@ -161,16 +364,89 @@ Result<ScanTaskIterator> IpcFileFormat::ScanFile(std::shared_ptr<ScanOptions> op
 
 Status IpcFileFormat::WriteFragment(RecordBatchReader* batches,
                                     io::OutputStream* destination) const {
-  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(destination, batches->schema()));
+  // The footer's custom metadata is serialized when the writer is closed, so
+  // statistics appended to it until then are written (see ipc::MakeFileWriter).
+  std::shared_ptr<KeyValueMetadata> footer_metadata;
+  std::unique_ptr<BatchStatisticsWriter> statistics;
+  if (write_statistics) {
+    footer_metadata = std::make_shared<KeyValueMetadata>();
+    ARROW_ASSIGN_OR_RAISE(statistics, BatchStatisticsWriter::Make(*batches->schema()));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::MakeFileWriter(destination, batches->schema(),
+                                            ipc::IpcWriteOptions::Defaults(),
+                                            footer_metadata));
 
   for (;;) {
     ARROW_ASSIGN_OR_RAISE(auto batch, batches->Next());
     if (batch == nullptr) break;
     RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    if (statistics) {
+      RETURN_NOT_OK(statistics->Append(*batch));
+    }
   }
 
+  if (statistics) {
+    RETURN_NOT_OK(statistics->Finish(footer_metadata.get()));
+  }
   return writer->Close();
 }
 
+class IpcFileWriter : public FileWriter {
+ public:
+  IpcFileWriter(std::shared_ptr<Schema> schema,
+                std::shared_ptr<io::OutputStream> destination,
+                std::shared_ptr<ipc::RecordBatchWriter> writer,
+                std::shared_ptr<KeyValueMetadata> footer_metadata,
+                std::unique_ptr<BatchStatisticsWriter> statistics)
+      : FileWriter(std::move(schema)),
+        destination_(std::move(destination)),
+        writer_(std::move(writer)),
+        footer_metadata_(std::move(footer_metadata)),
+        statistics_(std::move(statistics)) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    RETURN_NOT_OK(writer_->WriteRecordBatch(*batch));
+    if (statistics_) {
+      RETURN_NOT_OK(statistics_->Append(*batch));
+    }
+    return Status::OK();
+  }
+
+  Status Finish() override {
+    if (statistics_) {
+      RETURN_NOT_OK(statistics_->Finish(footer_metadata_.get()));
+    }
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  std::shared_ptr<KeyValueMetadata> footer_metadata_;
+  std::unique_ptr<BatchStatisticsWriter> statistics_;
+};
+
+Result<std::shared_ptr<FileWriter>> IpcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema) const {
+  // see WriteFragment
+  std::shared_ptr<KeyValueMetadata> footer_metadata;
+  std::unique_ptr<BatchStatisticsWriter> statistics;
+  if (write_statistics) {
+    footer_metadata = std::make_shared<KeyValueMetadata>();
+    ARROW_ASSIGN_OR_RAISE(statistics, BatchStatisticsWriter::Make(*schema));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::MakeFileWriter(destination, schema,
+                                            ipc::IpcWriteOptions::Defaults(),
+                                            footer_metadata));
+  return std::make_shared<IpcFileWriter>(std::move(schema), std::move(destination),
+                                         std::move(writer), std::move(footer_metadata),
+                                         std::move(statistics));
+}
+
 }  // namespace dataset
 }  // namespace arrow
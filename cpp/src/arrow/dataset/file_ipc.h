@@ -35,6 +35,13 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
  public:
   std::string type_name() const override { return "ipc"; }
 
+  /// \brief Write the min, max and null count of every column of each record batch
+  /// (for columns of boolean and numeric types) into the custom metadata of written
+  /// files. Scans skip the record batches of such files whose statistics can't
+  /// satisfy ScanOptions::filter, and read nothing more than the footer of files none
+  /// of whose record batches can.
+  bool write_statistics = false;
+
   bool splittable() const override { return true; }
 
   Result<bool> IsSupported(const FileSource& source) const override;
@@ -49,6 +56,10 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
 
   Status WriteFragment(RecordBatchReader* batches,
                        io::OutputStream* destination) const override;
+
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const override;
 };
 
 }  // namespace dataset
@@ -17,7 +17,9 @@
 
 #include "arrow/dataset/file_ipc.h"
 
+#include <cmath>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -42,6 +44,7 @@ constexpr int64_t kBatchRepetitions = 1 << 5;
 constexpr int64_t kNumRows = kBatchSize * kBatchRepetitions;
 
 using internal::checked_pointer_cast;
+using string_literals::operator"" _;
 
 class ArrowIpcWriterMixin : public ::testing::Test {
  public:
@@ -188,6 +191,10 @@ TEST_F(TestIpcFileSystemDataset, WriteWithEmptyPartitioningSchema) {
   TestWriteWithEmptyPartitioningSchema();
 }
 
+TEST_F(TestIpcFileSystemDataset, WriteRowsWithPooledWriters) {
+  TestWriteRowsWithPooledWriters();
+}
+
 TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
   std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
   auto result = format_->Inspect(FileSource(buf));
@@ -278,6 +285,56 @@ TEST_F(TestIpcFileFormat, ScanRecordBatchReaderProjectedMissingCols) {
   }
 }
 
+TEST_F(TestIpcFileFormat, ScanSkipsBatchesByStatistics) {
+  schema_ = schema({field("i32", int32()), field("f64", float64())});
+
+  // batch i holds the values [10 * i, 10 * i + 10)
+  RecordBatchVector batches;
+  for (int i = 0; i < 4; ++i) {
+    std::vector<int32_t> i32_values(10);
+    std::iota(i32_values.begin(), i32_values.end(), 10 * i);
+    std::vector<double> f64_values(i32_values.begin(), i32_values.end());
+
+    std::shared_ptr<Array> i32, f64;
+    ArrayFromVector<Int32Type>(i32_values, &i32);
+    ArrayFromVector<DoubleType>(f64_values, &f64);
+    batches.push_back(RecordBatch::Make(schema_, 10, {i32, f64}));
+  }
+
+  // a batch whose i32 are all null and whose f64 have no statistics
+  std::shared_ptr<Array> i32, f64;
+  ArrayFromVector<Int32Type, int32_t>(std::vector<bool>(10, false),
+                                      std::vector<int32_t>(10), &i32);
+  ArrayFromVector<DoubleType>(std::vector<double>(10, std::nan("")), &f64);
+  batches.push_back(RecordBatch::Make(schema_, 10, {i32, f64}));
+
+  auto CountRows = [&](bool write_statistics, std::shared_ptr<Expression> filter) {
+    format_->write_statistics = write_statistics;
+    EXPECT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, schema_));
+    EXPECT_OK_AND_ASSIGN(auto sink, GetFileSink());
+    ARROW_EXPECT_OK(format_->WriteFragment(reader.get(), sink.get()));
+    EXPECT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+    EXPECT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+    opts_ = ScanOptions::Make(schema_);
+    opts_->filter = std::move(filter);
+
+    int64_t row_count = 0;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      row_count += batch->num_rows();
+    }
+    return row_count;
+  };
+
+  EXPECT_EQ(CountRows(true, scalar(true)), 50);
+  EXPECT_EQ(CountRows(true, ("i32"_ >= 15 and "i32"_ < 25).Copy()), 20);
+  EXPECT_EQ(CountRows(true, ("f64"_ < 5.0).Copy()), 20);
+  EXPECT_EQ(CountRows(true, ("i32"_ > 100).Copy()), 0);
+
+  EXPECT_EQ(CountRows(false, ("i32"_ > 100).Copy()), 50);
+}
+
 TEST_F(TestIpcFileFormat, Inspect) {
   auto reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
@@ -17,12 +17,16 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
@@ -35,7 +39,10 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -49,19 +56,62 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+/// \brief The columns of a projection split for late materialization: the
+/// columns referenced by the filter are read first, the others are then read
+/// for the rows satisfying the filter only.
+struct LateMaterializedColumns {
+  // The scan's filter, simplified with the fragment's partition expression
+  std::shared_ptr<Expression> filter;
+  std::vector<int> filter_columns;
+  std::vector<int> payload_columns;
+};
+
+/// Append the row group positions of the rows of a batch selected by a filter,
+/// given the position of the batch's first row.
+static Status AppendSelectedRows(const ExpressionEvaluator& evaluator,
+                                 const Datum& selection, int64_t offset, int64_t length,
+                                 MemoryPool* pool,
+                                 std::vector<parquet::RowRanges::Range>* out) {
+  // Filtering the positions themselves works whatever the kind of the selection
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                        AllocateBuffer(length * sizeof(int64_t), pool));
+  auto data = reinterpret_cast<int64_t*>(buffer->mutable_data());
+  std::iota(data, data + length, offset);
+  auto positions = RecordBatch::Make(schema({field("position", int64())}), length,
+                                     {std::make_shared<Int64Array>(length, buffer)});
+
+  ARROW_ASSIGN_OR_RAISE(auto selected, evaluator.Filter(selection, positions, pool));
+  const auto& selected_positions = checked_cast<const Int64Array&>(*selected->column(0));
+  for (int64_t i = 0; i < selected_positions.length(); ++i) {
+    const int64_t position = selected_positions.Value(i);
+    if (!out->empty() && out->back().last + 1 == position) {
+      out->back().last = position;
+    } else {
+      out->push_back({position, position});
+    }
+  }
+  return Status::OK();
+}
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(RowGroupInfo row_group, std::vector<int> column_projection,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<ScanOptions> options,
-                  std::shared_ptr<ScanContext> context)
+                  std::shared_ptr<ScanContext> context,
+                  std::shared_ptr<LateMaterializedColumns> late_materialized = nullptr)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(std::move(row_group)),
         column_projection_(std::move(column_projection)),
-        reader_(std::move(reader)) {}
+        reader_(std::move(reader)),
+        late_materialized_(std::move(late_materialized)) {}
 
   Result<RecordBatchIterator> Execute() override {
+    if (late_materialized_ != nullptr) {
+      return ExecuteLateMaterialized();
+    }
+
     // The construction of parquet's RecordBatchReader is deferred here to
     // control the memory usage of consumers who materialize all ScanTasks
     // before dispatching them, e.g. for scheduling purposes.
@@ -75,12 +125,69 @@ class ParquetScanTask : public ScanTask {
   }
 
  private:
+  // Read the filter's columns, evaluate the filter and read the remaining
+  // columns for the selected rows only
+  Result<RecordBatchIterator> ExecuteLateMaterialized() {
+    const auto& evaluator = *options_->evaluator;
+    const auto& filter = *late_materialized_->filter;
+    MemoryPool* pool = context_->pool;
+
+    std::shared_ptr<Table> filter_table;
+    RETURN_NOT_OK(reader_->ReadRowGroup(
+        row_group_.id(), late_materialized_->filter_columns, &filter_table));
+
+    std::vector<parquet::RowRanges::Range> selected_ranges;
+    RecordBatchVector filtered_batches;
+    TableBatchReader filter_batches(*filter_table);
+    int64_t offset = 0;
+    std::shared_ptr<RecordBatch> batch;
+    for (;;) {
+      RETURN_NOT_OK(filter_batches.ReadNext(&batch));
+      if (batch == nullptr) break;
+      ARROW_ASSIGN_OR_RAISE(auto selection, evaluator.Evaluate(filter, *batch, pool));
+      RETURN_NOT_OK(AppendSelectedRows(evaluator, selection, offset, batch->num_rows(),
+                                       pool, &selected_ranges));
+      ARROW_ASSIGN_OR_RAISE(auto filtered, evaluator.Filter(selection, batch, pool));
+      filtered_batches.push_back(std::move(filtered));
+      offset += batch->num_rows();
+    }
+
+    parquet::RowRanges rows(std::move(selected_ranges));
+    if (rows.empty()) {
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+
+    std::shared_ptr<Table> payload_table;
+    RETURN_NOT_OK(reader_->ReadRowGroup(
+        row_group_.id(), late_materialized_->payload_columns, rows, &payload_table));
+    ARROW_ASSIGN_OR_RAISE(auto filtered_table, Table::FromRecordBatches(
+                                                   filter_table->schema(),
+                                                   std::move(filtered_batches)));
+
+    FieldVector fields = filtered_table->schema()->fields();
+    ChunkedArrayVector columns = filtered_table->columns();
+    for (int i = 0; i < payload_table->num_columns(); ++i) {
+      fields.push_back(payload_table->schema()->field(i));
+      columns.push_back(payload_table->column(i));
+    }
+    auto table = Table::Make(schema(std::move(fields)), std::move(columns),
+                             filtered_table->num_rows());
+    RETURN_NOT_OK(table->Validate());
+
+    auto table_reader = std::make_shared<TableBatchReader>(*table);
+    table_reader->set_chunksize(options_->batch_size);
+    // NB: explicitly preserve table so that table_reader doesn't outlive it
+    return MakeFunctionIterator([table, table_reader] { return table_reader->Next(); });
+  }
+
   RowGroupInfo row_group_;
   std::vector<int> column_projection_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  // Null unless the columns are read in two passes
+  std::shared_ptr<LateMaterializedColumns> late_materialized_;
 };
 
 static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
@@ -189,17 +296,316 @@ static std::shared_ptr<StructScalar> RowGroupStatisticsAsStructScalar(
                                         struct_(std::move(fields)));
 }
 
+/// \brief A conjunct of a predicate which can only be satisfied by a row group
+/// containing one of the values in a field
+struct BloomFilterPredicate {
+  std::string name;
+  ScalarVector values;
+};
+
+/// Collect the `field == scalar` and `field IN set` conjuncts of a predicate.
+static void CollectBloomFilterPredicates(const Expression& expr,
+                                         std::vector<BloomFilterPredicate>* out) {
+  switch (expr.type()) {
+    case ExpressionType::AND: {
+      const auto& and_expr = checked_cast<const AndExpression&>(expr);
+      CollectBloomFilterPredicates(*and_expr.left_operand(), out);
+      CollectBloomFilterPredicates(*and_expr.right_operand(), out);
+      return;
+    }
+
+    case ExpressionType::COMPARISON: {
+      const auto& cmp = checked_cast<const ComparisonExpression&>(expr);
+      if (cmp.op() != CompareOperator::EQUAL) return;
+
+      const Expression* lhs = cmp.left_operand().get();
+      const Expression* rhs = cmp.right_operand().get();
+      if (lhs->type() == ExpressionType::SCALAR) std::swap(lhs, rhs);
+      if (lhs->type() != ExpressionType::FIELD || rhs->type() != ExpressionType::SCALAR) {
+        return;
+      }
+
+      const auto& value = checked_cast<const ScalarExpression&>(*rhs).value();
+      if (!value->is_valid) return;
+      out->push_back({checked_cast<const FieldExpression&>(*lhs).name(), {value}});
+      return;
+    }
+
+    case ExpressionType::IN: {
+      const auto& in = checked_cast<const InExpression&>(expr);
+      if (in.operand()->type() != ExpressionType::FIELD || in.set()->null_count() != 0) {
+        return;
+      }
+
+      BloomFilterPredicate predicate;
+      predicate.name = checked_cast<const FieldExpression&>(*in.operand()).name();
+      for (int64_t i = 0; i < in.set()->length(); ++i) {
+        auto maybe_value = in.set()->GetScalar(i);
+        if (!maybe_value.ok()) return;
+        predicate.values.push_back(maybe_value.MoveValueUnsafe());
+      }
+      out->push_back(std::move(predicate));
+      return;
+    }
+
+    default:
+      return;
+  }
+}
+
+template <typename ScalarType>
+static int64_t IntegerScalarValue(const Scalar& value) {
+  return static_cast<int64_t>(checked_cast<const ScalarType&>(value).value);
+}
+
+/// Hash a value of a column as the parquet writer hashed it into the column's bloom
+/// filter. Returns false for types whose stored representation may differ from their
+/// arrow representation (such as coerced timestamps) and for floating point types,
+/// which can't be looked up.
+static bool HashForBloomFilter(const parquet::BloomFilter& bloom_filter,
+                               const parquet::ColumnDescriptor& descr,
+                               const Scalar& value, uint64_t* out) {
+  int64_t integer;
+  switch (value.type->id()) {
+    case Type::INT8:
+      integer = IntegerScalarValue<Int8Scalar>(value);
+      break;
+    case Type::INT16:
+      integer = IntegerScalarValue<Int16Scalar>(value);
+      break;
+    case Type::INT32:
+      integer = IntegerScalarValue<Int32Scalar>(value);
+      break;
+    case Type::INT64:
+      integer = IntegerScalarValue<Int64Scalar>(value);
+      break;
+    case Type::UINT8:
+      integer = IntegerScalarValue<UInt8Scalar>(value);
+      break;
+    case Type::UINT16:
+      integer = IntegerScalarValue<UInt16Scalar>(value);
+      break;
+    case Type::UINT32:
+      integer = IntegerScalarValue<UInt32Scalar>(value);
+      break;
+    case Type::UINT64:
+      integer = IntegerScalarValue<UInt64Scalar>(value);
+      break;
+    case Type::DATE32:
+      integer = IntegerScalarValue<Date32Scalar>(value);
+      break;
+
+    case Type::FLOAT:
+    case Type::DOUBLE:
+      // Floating point values are hashed by their bit patterns, so values which
+      // compare equal (-0.0 and 0.0) hash differently and NaN has many hashes.
+      return false;
+
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY: {
+      if (descr.physical_type() != parquet::Type::BYTE_ARRAY) return false;
+      const auto& data = checked_cast<const BaseBinaryScalar&>(value).value;
+      parquet::ByteArray byte_array(static_cast<uint32_t>(data->size()), data->data());
+      *out = bloom_filter.Hash(&byte_array);
+      return true;
+    }
+
+    case Type::FIXED_SIZE_BINARY: {
+      if (descr.physical_type() != parquet::Type::FIXED_LEN_BYTE_ARRAY) return false;
+      const auto& data = checked_cast<const BaseBinaryScalar&>(value).value;
+      if (data->size() != descr.type_length()) return false;
+      parquet::FixedLenByteArray fixed(data->data());
+      *out = bloom_filter.Hash(&fixed, static_cast<uint32_t>(descr.type_length()));
+      return true;
+    }
+
+    default:
+      return false;
+  }
+
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+      *out = bloom_filter.Hash(static_cast<int32_t>(integer));
+      return true;
+    case parquet::Type::INT64:
+      *out = bloom_filter.Hash(integer);
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Return false if the bloom filters of a row group prove that it contains none
+/// of the values which one of the predicates requires.
+static bool RowGroupMayMatchBloomFilters(
+    parquet::RowGroupReader* row_group, const SchemaManifest& manifest,
+    const std::vector<BloomFilterPredicate>& predicates) {
+  for (const auto& predicate : predicates) {
+    auto schema_field = std::find_if(
+        manifest.schema_fields.begin(), manifest.schema_fields.end(),
+        [&](const SchemaField& f) { return f.field->name() == predicate.name; });
+    if (schema_field == manifest.schema_fields.end() || !schema_field->is_leaf()) {
+      continue;
+    }
+    const auto& type = schema_field->field->type();
+    const int column_index = schema_field->column_index;
+
+    // As with statistics, failing to use a bloom filter must not fail the scan
+    std::unique_ptr<parquet::BloomFilter> bloom_filter;
+    try {
+      bloom_filter = row_group->GetColumnBloomFilter(column_index);
+    } catch (const ::parquet::ParquetException&) {
+      continue;
+    }
+    if (bloom_filter == nullptr) continue;
+
+    const auto& descr = *row_group->metadata()->schema()->Column(column_index);
+    bool may_match = false;
+    for (const auto& value : predicate.values) {
+      std::shared_ptr<Scalar> cast_value = value;
+      if (!value->type->Equals(type)) {
+        auto maybe_cast = value->CastTo(type);
+        if (!maybe_cast.ok()) {
+          may_match = true;
+          break;
+        }
+        cast_value = maybe_cast.MoveValueUnsafe();
+      }
+
+      uint64_t hash;
+      if (!HashForBloomFilter(*bloom_filter, descr, *cast_value, &hash) ||
+          bloom_filter->FindHash(hash)) {
+        may_match = true;
+        break;
+      }
+    }
+
+    if (!may_match) return false;
+  }
+  return true;
+}
+
+/// Express the values of a page of a column chunk from its column index, or
+/// return null if they cannot be expressed.
+static std::shared_ptr<Expression> PageStatisticsAsExpression(
+    const SchemaField& schema_field, const parquet::ColumnDescriptor* descr,
+    const parquet::ColumnIndex& column_index, int page) {
+  const auto& field = schema_field.field;
+  auto field_expr = field_ref(field->name());
+  if (column_index.null_pages()[page]) {
+    return equal(std::move(field_expr), scalar(MakeNullScalar(field->type())));
+  }
+
+  auto statistics = parquet::Statistics::Make(
+      descr, column_index.encoded_min_values()[page],
+      column_index.encoded_max_values()[page], /*num_values=*/0, /*null_count=*/0,
+      /*distinct_count=*/0, /*has_min_max=*/true);
+  std::shared_ptr<Scalar> min, max;
+  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
+    return nullptr;
+  }
+  return and_(greater_equal(field_expr, scalar(std::move(min))),
+              less_equal(field_expr, scalar(std::move(max))));
+}
+
+/// Select the rows of a row group held by the pages which may satisfy a
+/// predicate according to the column index of each field the predicate
+/// references. Return false if no page of some column may satisfy it.
+static bool SelectRowsByPageIndex(const Expression& predicate,
+                                  const std::vector<const SchemaField*>& fields,
+                                  parquet::ParquetFileReader* reader, int row_group_id) {
+  auto row_group = reader->RowGroup(row_group_id);
+  const int64_t num_rows = row_group->metadata()->num_rows();
+  parquet::RowRanges selected = parquet::RowRanges::All(num_rows);
+  bool pruned = false;
+
+  for (const SchemaField* schema_field : fields) {
+    const int column_index = schema_field->column_index;
+    // As with statistics, failing to use the page index must not fail the scan
+    std::unique_ptr<parquet::ColumnIndex> page_statistics;
+    std::unique_ptr<parquet::OffsetIndex> page_locations;
+    try {
+      page_statistics = row_group->GetColumnIndex(column_index);
+      page_locations = row_group->GetOffsetIndex(column_index);
+    } catch (const ::parquet::ParquetException&) {
+      continue;
+    }
+    if (page_statistics == nullptr || page_locations == nullptr ||
+        static_cast<size_t>(page_statistics->num_pages()) !=
+            page_locations->page_locations().size()) {
+      continue;
+    }
+
+    const auto* descr = row_group->metadata()->schema()->Column(column_index);
+    std::vector<int> pages;
+    for (int page = 0; page < page_statistics->num_pages(); ++page) {
+      auto page_expr =
+          PageStatisticsAsExpression(*schema_field, descr, *page_statistics, page);
+      if (page_expr == nullptr || predicate.IsSatisfiableWith(*page_expr)) {
+        pages.push_back(page);
+      }
+    }
+    if (static_cast<int>(pages.size()) == page_statistics->num_pages()) {
+      continue;
+    }
+    selected = selected.Intersect(page_locations->PageRows(pages, num_rows));
+    pruned = true;
+  }
+
+  if (selected.empty()) {
+    return false;
+  }
+  if (pruned) {
+    try {
+      reader->SelectRows(row_group_id, selected);
+    } catch (const ::parquet::ParquetException&) {
+    }
+  }
+  return true;
+}
+
+static std::vector<RowGroupInfo> FilterRowGroupsByPageIndex(
+    const Expression& predicate, parquet::arrow::FileReader* reader,
+    std::vector<RowGroupInfo> row_groups) {
+  std::vector<const SchemaField*> fields;
+  for (const auto& name : FieldsInExpression(predicate)) {
+    for (const auto& schema_field : reader->manifest().schema_fields) {
+      if (schema_field.is_leaf() && schema_field.field->name() == name &&
+          std::find(fields.begin(), fields.end(), &schema_field) == fields.end()) {
+        fields.push_back(&schema_field);
+      }
+    }
+  }
+  if (fields.empty()) {
+    return row_groups;
+  }
+
+  auto end = std::remove_if(
+      row_groups.begin(), row_groups.end(), [&](const RowGroupInfo& info) {
+        return !SelectRowsByPageIndex(predicate, fields, reader->parquet_reader(),
+                                      info.id());
+      });
+  row_groups.erase(end, row_groups.end());
+  return row_groups;
+}
+
 class ParquetScanTaskIterator {
  public:
   static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
                                        std::shared_ptr<ScanContext> context,
                                        FileSource source,
                                        std::unique_ptr<parquet::arrow::FileReader> reader,
-                                       std::vector<RowGroupInfo> row_groups) {
+                                       std::vector<RowGroupInfo> row_groups,
+                                       std::shared_ptr<Expression> late_filter) {
     auto column_projection = InferColumnProjection(*reader, *options);
+    auto late_materialized =
+        InferLateMaterializedColumns(*reader, std::move(late_filter), column_projection);
     return static_cast<ScanTaskIterator>(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(source), std::move(reader),
-        std::move(column_projection), std::move(row_groups)));
+        std::move(column_projection), std::move(row_groups),
+        std::move(late_materialized)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -208,8 +614,8 @@ class ParquetScanTaskIterator {
     }
 
     auto row_group = row_groups_[idx_++];
-    return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+    return std::shared_ptr<ScanTask>(new ParquetScanTask(
+        row_group, column_projection_, reader_, options_, context_, late_materialized_));
   }
 
  private:
@@ -240,6 +646,54 @@ class ParquetScanTaskIterator {
     return columns_selection;
   }
 
+  // Split the column projection into the columns referenced by the filter and
+  // the others, or return null if the filter can't be evaluated on the former
+  // or the latter can't be read for selected rows.
+  static std::shared_ptr<LateMaterializedColumns> InferLateMaterializedColumns(
+      const parquet::arrow::FileReader& reader, std::shared_ptr<Expression> filter,
+      const std::vector<int>& column_projection) {
+    if (filter == nullptr || filter->Equals(true)) {
+      return nullptr;
+    }
+
+    const auto& schema_fields = reader.manifest().schema_fields;
+    auto columns = std::make_shared<LateMaterializedColumns>();
+    for (const auto& name : FieldsInExpression(*filter)) {
+      auto schema_field = std::find_if(
+          schema_fields.begin(), schema_fields.end(),
+          [&](const SchemaField& f) { return f.field->name() == name; });
+      if (schema_field == schema_fields.end()) {
+        return nullptr;
+      }
+      AddColumnIndices(*schema_field, &columns->filter_columns);
+    }
+    if (columns->filter_columns.empty()) {
+      return nullptr;
+    }
+    std::sort(columns->filter_columns.begin(), columns->filter_columns.end());
+    columns->filter_columns.erase(
+        std::unique(columns->filter_columns.begin(), columns->filter_columns.end()),
+        columns->filter_columns.end());
+
+    const auto* schema = reader.parquet_reader()->metadata()->schema();
+    for (int column : column_projection) {
+      if (std::binary_search(columns->filter_columns.begin(),
+                             columns->filter_columns.end(), column)) {
+        continue;
+      }
+      if (schema->Column(column)->max_repetition_level() > 0) {
+        return nullptr;
+      }
+      columns->payload_columns.push_back(column);
+    }
+    if (columns->payload_columns.empty()) {
+      return nullptr;
+    }
+
+    columns->filter = std::move(filter);
+    return columns;
+  }
+
   static void AddColumnIndices(const SchemaField& schema_field,
                                std::vector<int>* column_projection) {
     if (schema_field.is_leaf()) {
@@ -256,13 +710,15 @@ class ParquetScanTaskIterator {
                           std::shared_ptr<ScanContext> context, FileSource source,
                           std::unique_ptr<parquet::arrow::FileReader> reader,
                           std::vector<int> column_projection,
-                          std::vector<RowGroupInfo> row_groups)
+                          std::vector<RowGroupInfo> row_groups,
+                          std::shared_ptr<LateMaterializedColumns> late_materialized)
       : options_(std::move(options)),
         context_(std::move(context)),
         source_(std::move(source)),
         reader_(std::move(reader)),
         column_projection_(std::move(column_projection)),
-        row_groups_(std::move(row_groups)) {}
+        row_groups_(std::move(row_groups)),
+        late_materialized_(std::move(late_materialized)) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
@@ -272,6 +728,7 @@ class ParquetScanTaskIterator {
 
   std::vector<int> column_projection_;
   std::vector<RowGroupInfo> row_groups_;
+  std::shared_ptr<LateMaterializedColumns> late_materialized_;
 
   // row group index.
   size_t idx_ = 0;
@@ -344,6 +801,25 @@ static inline bool RowGroupInfosAreComplete(const std::vector<RowGroupInfo>& inf
                      [](const RowGroupInfo& i) { return i.HasStatistics(); });
 }
 
+static std::vector<RowGroupInfo> FilterRowGroupsByBloomFilters(
+    const Expression& predicate, parquet::arrow::FileReader* reader,
+    std::vector<RowGroupInfo> row_groups) {
+  std::vector<BloomFilterPredicate> bloom_filter_predicates;
+  CollectBloomFilterPredicates(predicate, &bloom_filter_predicates);
+  if (bloom_filter_predicates.empty()) {
+    return row_groups;
+  }
+
+  auto end = std::remove_if(
+      row_groups.begin(), row_groups.end(), [&](const RowGroupInfo& info) {
+        auto row_group = reader->parquet_reader()->RowGroup(info.id());
+        return !RowGroupMayMatchBloomFilters(row_group.get(), reader->manifest(),
+                                             bloom_filter_predicates);
+      });
+  row_groups.erase(end, row_groups.end());
+  return row_groups;
+}
+
 Status ParquetFileFormat::WriteFragment(RecordBatchReader* batches,
                                         io::OutputStream* destination) const {
   using parquet::arrow::FileWriter;
@@ -366,6 +842,116 @@ Status ParquetFileFormat::WriteFragment(RecordBatchReader* batches,
   return writer->Close();
 }
 
+Result<FileMetadata> ParquetFileFormat::ReadMetadata(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetReader(source));
+
+  FileMetadata out;
+  RETURN_NOT_OK(reader->GetSchema(&out.physical_schema));
+
+  std::shared_ptr<parquet::FileMetaData> metadata = reader->parquet_reader()->metadata();
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    auto row_group = metadata->RowGroup(i);
+    RowGroupMetadata row_group_metadata;
+    row_group_metadata.id = i;
+    row_group_metadata.num_rows = row_group->num_rows();
+    row_group_metadata.total_byte_size = row_group->total_byte_size();
+    row_group_metadata.statistics =
+        RowGroupStatisticsAsStructScalar(*row_group, reader->manifest());
+    out.row_groups.push_back(std::move(row_group_metadata));
+  }
+  return out;
+}
+
+std::string ParquetFileFormat::metadata_fingerprint() const {
+  // Columns read as dictionaries change the physical schema
+  std::vector<std::string> dict_columns(reader_options.dict_columns.begin(),
+                                        reader_options.dict_columns.end());
+  std::sort(dict_columns.begin(), dict_columns.end());
+  std::string fingerprint = "dict_columns=";
+  for (const auto& name : dict_columns) {
+    fingerprint += std::to_string(name.size()) + ":" + name;
+  }
+  return fingerprint;
+}
+
+Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragmentFromMetadata(
+    FileSource source, std::shared_ptr<Expression> partition_expression,
+    const FileMetadata& metadata) {
+  std::vector<RowGroupInfo> row_groups;
+  for (const auto& row_group : metadata.row_groups) {
+    row_groups.emplace_back(row_group.id, row_group.num_rows, row_group.total_byte_size,
+                            row_group.statistics);
+  }
+  return MakeFragment(std::move(source), std::move(partition_expression),
+                      std::move(row_groups), metadata.physical_schema);
+}
+
+/// Batches are buffered until they fill a row group, so that writing many small
+/// batches (such as the slices of each partition) doesn't yield tiny row groups.
+/// Fewer than row_group_length rows are buffered between calls.
+class ParquetFileWriter : public FileWriter {
+ public:
+  ParquetFileWriter(std::shared_ptr<Schema> schema,
+                    std::shared_ptr<io::OutputStream> destination,
+                    std::unique_ptr<parquet::arrow::FileWriter> writer,
+                    int64_t row_group_length)
+      : FileWriter(std::move(schema)),
+        destination_(std::move(destination)),
+        writer_(std::move(writer)),
+        row_group_length_(row_group_length) {}
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    pending_.push_back(batch);
+    pending_rows_ += batch->num_rows();
+    if (pending_rows_ < row_group_length_) {
+      return Status::OK();
+    }
+
+    // Write every complete row group and keep buffering the remainder
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, pending_));
+    const int64_t num_written = pending_rows_ - pending_rows_ % row_group_length_;
+    RETURN_NOT_OK(writer_->WriteTable(*table->Slice(0, num_written), row_group_length_));
+
+    pending_.clear();
+    pending_rows_ -= num_written;
+    TableBatchReader remainder(*table->Slice(num_written));
+    return remainder.ReadAll(&pending_);
+  }
+
+  Status Finish() override {
+    if (pending_rows_ > 0) {
+      ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, pending_));
+      RETURN_NOT_OK(writer_->WriteTable(*table, pending_rows_));
+      pending_.clear();
+      pending_rows_ = 0;
+    }
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> destination_;
+  std::unique_ptr<parquet::arrow::FileWriter> writer_;
+  const int64_t row_group_length_;
+  RecordBatchVector pending_;
+  int64_t pending_rows_ = 0;
+};
+
+Result<std::shared_ptr<FileWriter>> ParquetFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema) const {
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*schema, default_memory_pool(),
+                                                 destination, writer_properties,
+                                                 arrow_writer_properties, &writer));
+  const int64_t row_group_length =
+      std::min(writer_row_group_length, writer_properties->max_row_group_length());
+  return std::make_shared<ParquetFileWriter>(std::move(schema), std::move(destination),
+                                             std::move(writer), row_group_length);
+}
+
 Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
                                                      std::shared_ptr<ScanContext> context,
                                                      FileFragment* fragment) const {
@@ -411,9 +997,34 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions
     }
   }
 
+  // Statistics can't exclude row groups for values between their bounds; bloom
+  // filters read from the file may
+  if (reader_options.use_bloom_filters && !options->filter->Equals(true)) {
+    row_groups = FilterRowGroupsByBloomFilters(*options->filter, reader.get(),
+                                               std::move(row_groups));
+    if (row_groups.empty()) {
+      return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+    }
+  }
+
+  // The page index narrows the remaining row groups down to the pages whose
+  // statistics may satisfy the filter; the readers skip the other pages
+  if (reader_options.use_page_index && !options->filter->Equals(true)) {
+    row_groups = FilterRowGroupsByPageIndex(*options->filter, reader.get(),
+                                            std::move(row_groups));
+    if (row_groups.empty()) {
+      return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+    }
+  }
+
+  std::shared_ptr<Expression> late_filter;
+  if (reader_options.late_materialization && !options->filter->Equals(true)) {
+    late_filter = options->filter->Assume(fragment->partition_expression());
+  }
+
   return ParquetScanTaskIterator::Make(std::move(options), std::move(context),
                                        fragment->source(), std::move(reader),
-                                       std::move(row_groups));
+                                       std::move(row_groups), std::move(late_filter));
 }
 
 Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragment(
@@ -92,6 +92,24 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     std::unordered_set<std::string> dict_columns;
     /// @}
 
+    /// Skip row groups whose bloom filters rule out every value which an equality or
+    /// IN conjunct of the scan's filter requires of a column. The bloom filters of the
+    /// referenced columns are read from the file at scan time.
+    bool use_bloom_filters = true;
+
+    /// Skip row groups, and the data pages of the remaining ones, whose page index
+    /// statistics cannot satisfy the scan's filter. The page index of the referenced
+    /// columns is read from the file at scan time.
+    bool use_page_index = true;
+
+    /// Read the columns referenced by the scan's filter first, then read the other
+    /// projected columns for the rows satisfying the filter only, skipping the values
+    /// of the other rows instead of decoding them. This saves work when a selective
+    /// filter is followed by many projected columns, at the cost of reading the
+    /// filter's columns a row group at a time. Files whose projected columns have
+    /// repeated values are read as usual.
+    bool late_materialization = false;
+
     /// EXPERIMENTAL: Parallelize conversion across columns. This option is ignored if a
     /// scan is already parallelized across input files to avoid thread contention. This
     /// option will be removed after support is added for simultaneous parallelization
@@ -103,6 +121,12 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
 
   std::shared_ptr<parquet::ArrowWriterProperties> arrow_writer_properties;
 
+  /// The number of rows per row group written by the writers of MakeWriter(), if
+  /// smaller than writer_properties->max_row_group_length(). Those writers buffer
+  /// incoming batches until they fill a row group, so this bounds the memory held
+  /// by each open file.
+  int64_t writer_row_group_length = 64 * 1024;
+
   Result<bool> IsSupported(const FileSource& source) const override;
 
   /// \brief Return the schema of the file if possible.
@@ -126,12 +150,26 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
       FileSource source, std::shared_ptr<Expression> partition_expression,
       std::shared_ptr<Schema> physical_schema) override;
 
+  /// \brief Read the physical schema and the statistics of every RowGroup.
+  Result<FileMetadata> ReadMetadata(const FileSource& source) const override;
+
+  std::string metadata_fingerprint() const override;
+
+  /// \brief Create a Fragment with complete metadata, targeting all RowGroups.
+  Result<std::shared_ptr<FileFragment>> MakeFragmentFromMetadata(
+      FileSource source, std::shared_ptr<Expression> partition_expression,
+      const FileMetadata& metadata) override;
+
   /// \brief Return a FileReader on the given source.
   Result<std::unique_ptr<parquet::arrow::FileReader>> GetReader(
       const FileSource& source, ScanOptions* = NULLPTR, ScanContext* = NULLPTR) const;
 
   Status WriteFragment(RecordBatchReader* batches,
                        io::OutputStream* destination) const override;
+
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const override;
 };
 
 /// \brief Represents a parquet's RowGroup with extra information.
@@ -21,6 +21,8 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
@@ -32,6 +34,7 @@
 #include "arrow/type_fwd.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
 #include "parquet/metadata.h"
 
 namespace arrow {
@@ -48,7 +51,6 @@ using parquet::default_writer_properties;
 using parquet::WriterProperties;
 
 using parquet::CreateOutputStream;
-using parquet::arrow::FileWriter;
 using parquet::arrow::WriteTable;
 
 using testing::Pointee;
@@ -57,7 +59,8 @@ using internal::checked_pointer_cast;
 
 class ArrowParquetWriterMixin : public ::testing::Test {
  public:
-  Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
+  Status WriteRecordBatch(const RecordBatch& batch,
+                          parquet::arrow::FileWriter* writer) {
     auto schema = batch.schema();
     auto size = batch.num_rows();
 
@@ -75,7 +78,8 @@ class ArrowParquetWriterMixin : public ::testing::Test {
     return Status::OK();
   }
 
-  Status WriteRecordBatchReader(RecordBatchReader* reader, FileWriter* writer) {
+  Status WriteRecordBatchReader(RecordBatchReader* reader,
+                                parquet::arrow::FileWriter* writer) {
     auto schema = reader->schema();
 
     if (!schema->Equals(*writer->schema(), false)) {
@@ -96,9 +100,9 @@ class ArrowParquetWriterMixin : public ::testing::Test {
       const std::shared_ptr<WriterProperties>& properties = default_writer_properties(),
       const std::shared_ptr<ArrowWriterProperties>& arrow_properties =
           default_arrow_writer_properties()) {
-    std::unique_ptr<FileWriter> writer;
-    RETURN_NOT_OK(FileWriter::Open(*reader->schema(), pool, sink, properties,
-                                   arrow_properties, &writer));
+    std::unique_ptr<parquet::arrow::FileWriter> writer;
+    RETURN_NOT_OK(parquet::arrow::FileWriter::Open(
+        *reader->schema(), pool, sink, properties, arrow_properties, &writer));
     RETURN_NOT_OK(WriteRecordBatchReader(reader, writer.get()));
     return writer->Close();
   }
@@ -497,6 +501,155 @@ TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragmentsUsingStringColum
   // CountRowGroupsInFragment(fragment, {0, 3}, "x"_ == "a");
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilters) {
+  // Every row group spans almost the same range of keys, so statistics can't
+  // exclude any of them; row group i holds the keys equal to i modulo 4.
+  auto table = TableFromJSON(schema({field("id", int64()), field("name", utf8())}),
+                             {
+                                 R"([[0, "a"], [4, "e"], [8, "i"], [12, "m"]])",
+                                 R"([[1, "b"], [5, "f"], [9, "j"], [13, "n"]])",
+                                 R"([[2, "c"], [6, "g"], [10, "k"], [14, "o"]])",
+                                 R"([[3, "d"], [7, "h"], [11, "l"], [15, "p"]])",
+                             });
+  TableBatchReader reader(*table);
+  auto sink = CreateOutputStream();
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+  ASSERT_OK(WriteRecordBatchReader(&reader, default_memory_pool(), sink, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  opts_->filter = ("id"_ == int64_t(9)).Copy();
+  CountRowsAndBatchesInScan(fragment, 4, 1);
+  opts_->filter = ("name"_ == "g").Copy();
+  CountRowsAndBatchesInScan(fragment, 4, 1);
+  opts_->filter = ("id"_ == int64_t(9) and "name"_ == "g").Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  opts_->filter = ("id"_ == int64_t(9) or "name"_ == "g").Copy();
+  CountRowsAndBatchesInScan(fragment, 16, 4);
+  opts_->filter = "id"_.In(ArrayFromJSON(int64(), "[4, 7, 100]")).Copy();
+  CountRowsAndBatchesInScan(fragment, 8, 2);
+  opts_->filter = ("id"_ > int64_t(2) and "name"_ == "zzz").Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  format_->reader_options.use_bloom_filters = false;
+  opts_->filter = ("id"_ == int64_t(9)).Copy();
+  CountRowsAndBatchesInScan(fragment, 16, 4);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFiltersFloatingPoint) {
+  // -0.0 and 0.0 compare equal but have different bit patterns, so floating
+  // point bloom filters must not exclude the row group holding -0.0
+  auto table = TableFromJSON(schema({field("x", float64())}),
+                             {R"([[-0.0]])", R"([[1.5]])"});
+  TableBatchReader reader(*table);
+  auto sink = CreateOutputStream();
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+  ASSERT_OK(WriteRecordBatchReader(&reader, default_memory_pool(), sink, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  opts_->filter = ("x"_ == 0.0).Copy();
+  CountRowsAndBatchesInScan(fragment, 1, 1);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownPageIndex) {
+  // A single row group of sorted ids, written as pages of 100 rows
+  constexpr int64_t kNumRows = 1000;
+  Int64Builder builder;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    ASSERT_OK(builder.Append(i));
+  }
+  ASSERT_OK_AND_ASSIGN(auto ids, builder.Finish());
+  auto table = Table::Make(schema({field("id", int64())}), {ids});
+  TableBatchReader reader(*table);
+  auto sink = CreateOutputStream();
+  auto properties = WriterProperties::Builder()
+                        .enable_page_index()
+                        ->disable_dictionary()
+                        ->write_batch_size(100)
+                        ->data_pagesize(1)
+                        ->build();
+  ASSERT_OK(WriteRecordBatchReader(&reader, default_memory_pool(), sink, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  opts_->filter = ("id"_ == int64_t(512)).Copy();
+  CountRowsAndBatchesInScan(fragment, 100, 1);
+  opts_->filter = ("id"_ >= int64_t(250) and "id"_ < int64_t(420)).Copy();
+  CountRowsAndBatchesInScan(fragment, 300, 1);
+  opts_->filter = ("id"_ < int64_t(50) or "id"_ > int64_t(950)).Copy();
+  CountRowsAndBatchesInScan(fragment, 200, 1);
+
+  format_->reader_options.use_page_index = false;
+  opts_->filter = ("id"_ == int64_t(512)).Copy();
+  CountRowsAndBatchesInScan(fragment, kNumRows, 1);
+}
+
+TEST_F(TestParquetFileFormat, LateMaterialization) {
+  // Small pages let the payload columns skip both whole and partial pages
+  constexpr int64_t kNumRows = 1000;
+  Int64Builder id_builder;
+  StringBuilder name_builder;
+  DoubleBuilder value_builder;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    ASSERT_OK(id_builder.Append(i));
+    ASSERT_OK(name_builder.Append("name" + std::to_string(i % 37)));
+    if (i % 7 == 0) {
+      ASSERT_OK(value_builder.AppendNull());
+    } else {
+      ASSERT_OK(value_builder.Append(i / 2.0));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto ids, id_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto names, name_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto values, value_builder.Finish());
+  auto table = Table::Make(
+      schema({field("id", int64()), field("name", utf8()), field("value", float64())}),
+      {ids, names, values});
+  TableBatchReader reader(*table);
+  reader.set_chunksize(kNumRows / 2);
+  auto sink = CreateOutputStream();
+  auto properties =
+      WriterProperties::Builder().write_batch_size(50)->data_pagesize(1)->build();
+  ASSERT_OK(WriteRecordBatchReader(&reader, default_memory_pool(), sink, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table->schema());
+  opts_->evaluator = std::make_shared<TreeEvaluator>();
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  auto filter = ("id"_ >= int64_t(120) and "id"_ < int64_t(135)) or
+                "id"_ == int64_t(499) or "id"_ == int64_t(777) or "id"_ > int64_t(990);
+  opts_->filter = filter.Copy();
+  format_->reader_options.late_materialization = true;
+
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(
+                                        table->schema(),
+                                        IteratorToVector(Batches(fragment.get()))));
+  ASSERT_OK_AND_ASSIGN(auto all_rows, TableBatchReader(*table).Next());
+  ASSERT_OK_AND_ASSIGN(auto selection, opts_->evaluator->Evaluate(filter, *all_rows));
+  ASSERT_OK_AND_ASSIGN(auto expected, opts_->evaluator->Filter(selection, all_rows));
+  ASSERT_EQ(15 + 1 + 1 + 9, actual->num_rows());
+  ASSERT_OK_AND_ASSIGN(auto expected_table, Table::FromRecordBatches({expected}));
+  AssertTablesEqual(*expected_table, *actual, /*same_chunk_layout=*/false);
+
+  // Without columns besides the filter's, row groups are read as usual
+  opts_ = ScanOptions::Make(schema({field("id", int64())}));
+  opts_->evaluator = std::make_shared<TreeEvaluator>();
+  opts_->filter = filter.Copy();
+  CountRowsAndBatchesInScan(fragment, kNumRows, 2);
+}
+
 TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
   constexpr int64_t kNumRowGroups = 16;
   constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
@@ -591,6 +744,75 @@ TEST_F(TestParquetFileFormat, WriteRecordBatchReaderCustomOptions) {
                     *actual_schema);
 }
 
+TEST_F(TestParquetFileFormat, MetadataFingerprint) {
+  // Reading columns as dictionaries changes the physical schema
+  auto fingerprint = format_->metadata_fingerprint();
+  format_->reader_options.dict_columns = {"a", "b"};
+  ASSERT_NE(format_->metadata_fingerprint(), fingerprint);
+  fingerprint = format_->metadata_fingerprint();
+  format_->reader_options.dict_columns = {"b", "a"};
+  ASSERT_EQ(format_->metadata_fingerprint(), fingerprint);
+  format_->reader_options.dict_columns = {"ab"};
+  ASSERT_NE(format_->metadata_fingerprint(), fingerprint);
+}
+
+TEST_F(TestParquetFileFormat, WriterBuffersRowGroups) {
+  format_->writer_properties =
+      parquet::WriterProperties::Builder().max_row_group_length(4)->build();
+
+  auto schema = ::arrow::schema({field("i64", int64())});
+  EXPECT_OK_AND_ASSIGN(auto sink, GetFileSink());
+  ASSERT_OK_AND_ASSIGN(auto writer, format_->MakeWriter(sink, schema));
+
+  // Rows written one at a time are gathered into full row groups
+  for (int64_t i = 0; i < 10; ++i) {
+    Int64Builder builder;
+    ASSERT_OK(builder.Append(i));
+    ASSERT_OK_AND_ASSIGN(auto column, builder.Finish());
+    ASSERT_OK(writer->Write(RecordBatch::Make(schema, 1, {column})));
+  }
+  ASSERT_OK(writer->Finish());
+  EXPECT_OK_AND_ASSIGN(auto written, sink->Finish());
+
+  auto metadata = parquet::ReadMetaData(std::make_shared<io::BufferReader>(written));
+  ASSERT_EQ(3, metadata->num_row_groups());
+  ASSERT_EQ(4, metadata->RowGroup(0)->num_rows());
+  ASSERT_EQ(4, metadata->RowGroup(1)->num_rows());
+  ASSERT_EQ(2, metadata->RowGroup(2)->num_rows());
+}
+
+TEST_F(TestParquetFileFormat, WriterBuffersBoundedRows) {
+  // Whatever the maximum row group length, writers only buffer up to
+  // writer_row_group_length rows
+  format_->writer_row_group_length = 4096;
+  constexpr int64_t kBatchLength = 1000;
+
+  auto schema = ::arrow::schema({field("i64", int64())});
+  EXPECT_OK_AND_ASSIGN(auto sink, GetFileSink());
+  ASSERT_OK_AND_ASSIGN(auto writer, format_->MakeWriter(sink, schema));
+
+  // The written batches are allocated from a pool of their own, so the pool's
+  // allocations are those still buffered by the writer
+  ProxyMemoryPool pool(default_memory_pool());
+  for (int64_t i = 0; i < 100; ++i) {
+    Int64Builder builder(&pool);
+    for (int64_t j = 0; j < kBatchLength; ++j) {
+      ASSERT_OK(builder.Append(i * kBatchLength + j));
+    }
+    ASSERT_OK_AND_ASSIGN(auto column, builder.Finish());
+    ASSERT_OK(writer->Write(RecordBatch::Make(schema, kBatchLength, {column})));
+    ASSERT_LE(pool.bytes_allocated(), 2 * format_->writer_row_group_length *
+                                          static_cast<int64_t>(sizeof(int64_t)));
+  }
+  ASSERT_OK(writer->Finish());
+  ASSERT_EQ(pool.bytes_allocated(), 0);
+  EXPECT_OK_AND_ASSIGN(auto written, sink->Finish());
+
+  auto metadata = parquet::ReadMetaData(std::make_shared<io::BufferReader>(written));
+  ASSERT_EQ(25, metadata->num_row_groups());
+  ASSERT_EQ(4096, metadata->RowGroup(0)->num_rows());
+}
+
 class TestParquetFileSystemDataset : public WriteFileSystemDatasetMixin,
                                      public testing::Test {
  public:
@@ -617,5 +839,9 @@ TEST_F(TestParquetFileSystemDataset, WriteWithEmptyPartitioningSchema) {
   TestWriteWithEmptyPartitioningSchema();
 }
 
+TEST_F(TestParquetFileSystemDataset, WriteRowsWithPooledWriters) {
+  TestWriteRowsWithPooledWriters();
+}
+
 }  // namespace dataset
 }  // namespace arrow
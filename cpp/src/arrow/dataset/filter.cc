@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -38,6 +39,9 @@
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/iterator.h"
@@ -1309,6 +1313,194 @@ Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
   return batch->Slice(0, 0);
 }
 
+namespace {
+
+// Rows of a batch, in increasing order
+using RowSelection = std::vector<int32_t>;
+
+// Once no more than this fraction of a batch's rows survive, the remaining conjuncts are
+// evaluated against only the surviving rows rather than against the whole batch.
+constexpr int64_t kCompactionRatio = 4;
+
+// Append to `selection` the row of each set bit in `values` whose bit in `validity` is
+// also set. `validity` may be null.
+template <typename RowOf>
+void SelectRows(const uint8_t* values, const uint8_t* validity, int64_t offset,
+                int64_t length, RowOf&& row_of, RowSelection* selection) {
+  internal::OptionalBinaryBitBlockCounter counter(values, offset, validity, offset,
+                                                  length);
+  int64_t position = 0;
+  while (position < length) {
+    internal::BitBlockCount block = counter.NextAndBlock();
+    if (block.AllSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        selection->push_back(row_of(i));
+      }
+    } else if (!block.NoneSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        if (BitUtil::GetBit(values, offset + i) &&
+            (validity == nullptr || BitUtil::GetBit(validity, offset + i))) {
+          selection->push_back(row_of(i));
+        }
+      }
+    }
+    position += block.length;
+  }
+}
+
+const uint8_t* GetValidity(const ArrayData& mask) {
+  return mask.GetNullCount() > 0 ? mask.buffers[0]->data() : nullptr;
+}
+
+// Clear the bits of `bitmap` whose slots in `mask` are false or null.
+Status Intersect(const ArrayData& mask, MemoryPool* pool,
+                 std::shared_ptr<Buffer>* bitmap) {
+  for (const uint8_t* other : {mask.buffers[1]->data(), GetValidity(mask)}) {
+    if (other == nullptr) {
+      continue;
+    }
+    if (mask.offset % 8 == 0) {
+      // byte aligned operands can safely be combined in place
+      internal::BitmapAnd((*bitmap)->data(), 0, other, mask.offset, mask.length, 0,
+                          (*bitmap)->mutable_data());
+    } else {
+      ARROW_ASSIGN_OR_RAISE(*bitmap, internal::BitmapAnd(pool, (*bitmap)->data(), 0,
+                                                         other, mask.offset,
+                                                         mask.length, 0));
+    }
+  }
+  return Status::OK();
+}
+
+// Gather the selected rows of the columns referenced by expr.
+Result<std::shared_ptr<RecordBatch>> TakeReferencedColumns(const Expression& expr,
+                                                           const RecordBatch& batch,
+                                                           const RowSelection& selection,
+                                                           MemoryPool* pool) {
+  Int32Array indices(static_cast<int64_t>(selection.size()), Buffer::Wrap(selection));
+  compute::ExecContext ctx(pool);
+
+  FieldVector fields;
+  ArrayVector columns;
+  for (const auto& name : FieldsInExpression(expr)) {
+    int i = batch.schema()->GetFieldIndex(name);
+    if (i == -1) {
+      // missing fields evaluate to null, whether or not rows were taken
+      continue;
+    }
+    if (std::any_of(fields.begin(), fields.end(),
+                    [&](const std::shared_ptr<Field>& f) { return f->name() == name; })) {
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto column,
+                          compute::Take(*batch.column(i), indices,
+                                        compute::TakeOptions::NoBoundsCheck(), &ctx));
+    fields.push_back(batch.schema()->field(i));
+    columns.push_back(std::move(column));
+  }
+  return RecordBatch::Make(schema(std::move(fields)), indices.length(),
+                           std::move(columns));
+}
+
+bool IsTrueScalar(const Datum& mask) {
+  return BooleanScalar(true).Equals(*mask.scalar());
+}
+
+}  // namespace
+
+Result<Datum> FusedEvaluator::Evaluate(const Expression& expr, const RecordBatch& batch,
+                                       MemoryPool* pool) const {
+  const int64_t num_rows = batch.num_rows();
+  if (expr.type() != ExpressionType::AND ||
+      num_rows > std::numeric_limits<int32_t>::max()) {
+    return tree_.Evaluate(expr, batch, pool);
+  }
+
+  std::vector<const Expression*> conjuncts;
+  RETURN_NOT_OK(VisitConjunctionMembers(expr, [&](const Expression& conjunct) {
+    conjuncts.push_back(&conjunct);
+    return Status::OK();
+  }));
+
+  // The rows which satisfy every conjunct evaluated so far are tracked in a bitmap
+  // (which is null while every row is selected) until few enough survive to compact
+  // the batch, after which they are tracked as a selection vector.
+  int64_t num_selected = num_rows;
+  std::shared_ptr<Buffer> bitmap;
+  bool compacted = false;
+  RowSelection selection, narrowed;
+
+  for (const Expression* conjunct : conjuncts) {
+    if (num_selected == 0) {
+      break;
+    }
+
+    if (!compacted && num_selected * kCompactionRatio <= num_rows) {
+      SelectRows(
+          bitmap->data(), nullptr, 0, num_rows,
+          [](int64_t i) { return static_cast<int32_t>(i); }, &selection);
+      compacted = true;
+    }
+
+    Datum mask;
+    if (compacted) {
+      ARROW_ASSIGN_OR_RAISE(auto rows,
+                            TakeReferencedColumns(*conjunct, batch, selection, pool));
+      ARROW_ASSIGN_OR_RAISE(mask, tree_.Evaluate(*conjunct, *rows, pool));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(mask, tree_.Evaluate(*conjunct, batch, pool));
+    }
+
+    if ((!mask.is_scalar() && !mask.is_array()) || mask.type()->id() != Type::BOOL) {
+      return Status::TypeError("conjunction member ", conjunct->ToString(),
+                               " did not evaluate to a boolean selection");
+    }
+
+    if (mask.is_scalar()) {
+      if (!IsTrueScalar(mask)) {
+        num_selected = 0;
+      }
+      continue;
+    }
+
+    const ArrayData& mask_data = *mask.array();
+    if (compacted) {
+      narrowed.clear();
+      SelectRows(
+          mask_data.buffers[1]->data(), GetValidity(mask_data), mask_data.offset,
+          mask_data.length, [&](int64_t i) { return selection[i]; }, &narrowed);
+      selection.swap(narrowed);
+      num_selected = static_cast<int64_t>(selection.size());
+      continue;
+    }
+
+    if (bitmap == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(bitmap, AllocateBitmap(num_rows, pool));
+      std::memset(bitmap->mutable_data(), 0xff, bitmap->size());
+    }
+    RETURN_NOT_OK(Intersect(mask_data, pool, &bitmap));
+    num_selected = internal::CountSetBits(bitmap->data(), 0, num_rows);
+  }
+
+  if (num_selected == 0 || num_selected == num_rows) {
+    return Datum(std::make_shared<BooleanScalar>(num_selected == num_rows));
+  }
+
+  if (compacted) {
+    ARROW_ASSIGN_OR_RAISE(bitmap, AllocateEmptyBitmap(num_rows, pool));
+    for (int32_t row : selection) {
+      BitUtil::SetBit(bitmap->mutable_data(), row);
+    }
+  }
+  return Datum(ArrayData::Make(boolean(), num_rows, {nullptr, std::move(bitmap)}, 0));
+}
+
+Result<std::shared_ptr<RecordBatch>> FusedEvaluator::Filter(
+    const Datum& selection, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  return tree_.Filter(selection, batch, pool);
+}
+
 std::shared_ptr<Expression> scalar(bool value) { return scalar(MakeScalar(value)); }
 
 // Serialization is accomplished by converting expressions to single element StructArrays
@@ -1538,23 +1730,6 @@ Result<std::shared_ptr<Expression>> Expression::Deserialize(const Buffer& serial
 
 // Transform an array of counts to offsets which will divide a ListArray
 // into an equal number of slices with corresponding lengths.
-inline Result<std::shared_ptr<Array>> CountsToOffsets(
-    std::shared_ptr<Int64Array> counts) {
-  Int32Builder offset_builder;
-  RETURN_NOT_OK(offset_builder.Resize(counts->length() + 1));
-  offset_builder.UnsafeAppend(0);
-
-  for (int64_t i = 0; i < counts->length(); ++i) {
-    DCHECK_NE(counts->Value(i), 0);
-    auto next_offset = static_cast<int32_t>(offset_builder[i] + counts->Value(i));
-    offset_builder.UnsafeAppend(next_offset);
-  }
-
-  std::shared_ptr<Array> offsets;
-  RETURN_NOT_OK(offset_builder.Finish(&offsets));
-  return offsets;
-}
-
 // Helper for simultaneous dictionary encoding of multiple arrays.
 //
 // The fused dictionary is the Cartesian product of the individual dictionaries.
@@ -1671,26 +1846,48 @@ Result<std::shared_ptr<StructArray>> MakeGroupings(const StructArray& by) {
 
   ARROW_ASSIGN_OR_RAISE(auto fused, StructDictionary::Encode(by.fields()));
 
-  ARROW_ASSIGN_OR_RAISE(auto sort_indices, compute::SortToIndices(*fused.indices));
-  ARROW_ASSIGN_OR_RAISE(Datum sorted, compute::Take(fused.indices, *sort_indices));
-  fused.indices = checked_pointer_cast<Int32Array>(sorted.make_array());
-
-  ARROW_ASSIGN_OR_RAISE(auto fused_counts_and_values,
-                        compute::ValueCounts(fused.indices));
+  // Hash the fused codes to dense group ids, numbered in order of first appearance
+  ARROW_ASSIGN_OR_RAISE(Datum encoded, compute::DictionaryEncode(fused.indices));
   fused.indices.reset();
-
+  const ArrayData& group_ids = *encoded.array();
   auto unique_fused_indices =
-      checked_pointer_cast<Int32Array>(fused_counts_and_values->GetFieldByName("values"));
+      checked_pointer_cast<Int32Array>(MakeArray(group_ids.dictionary));
+  const int32_t num_groups = static_cast<int32_t>(unique_fused_indices->length());
+
   ARROW_ASSIGN_OR_RAISE(
       auto unique_rows,
       fused.dictionary->Decode(std::move(unique_fused_indices), by.type()->fields()));
 
-  auto counts =
-      checked_pointer_cast<Int64Array>(fused_counts_and_values->GetFieldByName("counts"));
-  ARROW_ASSIGN_OR_RAISE(auto offsets, CountsToOffsets(std::move(counts)));
+  // Counting sort of row indices by group id: linear and stable, so rows keep their
+  // relative order within each group
+  const int32_t* ids = group_ids.GetValues<int32_t>(1);
+  const int64_t length = group_ids.length;
+  if (length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Grouping more than 2^31 - 1 rows");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto offsets_buffer,
+                        AllocateBuffer((num_groups + 1) * sizeof(int32_t)));
+  auto offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+  std::fill(offsets, offsets + num_groups + 1, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    ++offsets[ids[i] + 1];
+  }
+  for (int32_t g = 0; g < num_groups; ++g) {
+    offsets[g + 1] += offsets[g];
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto sort_indices_buffer,
+                        AllocateBuffer(length * sizeof(int32_t)));
+  auto sort_indices = reinterpret_cast<int32_t*>(sort_indices_buffer->mutable_data());
+  std::vector<int32_t> cursors(offsets, offsets + num_groups);
+  for (int64_t i = 0; i < length; ++i) {
+    sort_indices[cursors[ids[i]]++] = static_cast<int32_t>(i);
+  }
 
-  ARROW_ASSIGN_OR_RAISE(auto grouped_sort_indices,
-                        ListArray::FromArrays(*offsets, *sort_indices));
+  auto grouped_sort_indices = std::make_shared<ListArray>(
+      list(int32()), num_groups, std::move(offsets_buffer),
+      std::make_shared<Int32Array>(length, std::move(sort_indices_buffer)));
 
   return StructArray::Make(
       ArrayVector{std::move(unique_rows), std::move(grouped_sort_indices)},
@@ -651,6 +651,27 @@ class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
   struct Impl;
 };
 
+/// construct an Evaluator which evaluates the members of a top level conjunction in a
+/// single pass over a selection vector of the rows which satisfy every member evaluated
+/// so far. Once few rows survive, later members are evaluated against only those rows
+/// and evaluation stops as soon as none survive.
+///
+/// Selections produced for conjunctions contain no nulls: rows for which the
+/// conjunction would evaluate to null are not selected, as is the case when filtering.
+/// Other expressions are evaluated identically to TreeEvaluator.
+class ARROW_DS_EXPORT FusedEvaluator : public ExpressionEvaluator {
+ public:
+  Result<Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                         MemoryPool* pool) const override;
+
+  Result<std::shared_ptr<RecordBatch>> Filter(const Datum& selection,
+                                              const std::shared_ptr<RecordBatch>& batch,
+                                              MemoryPool* pool) const override;
+
+ private:
+  TreeEvaluator tree_;
+};
+
 /// \brief Assemble lists of indices of identical rows.
 ///
 /// \param[in] by A StructArray whose columns will be used as grouping criteria.
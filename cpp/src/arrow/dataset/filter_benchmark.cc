@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr auto kSeed = 0x0ff1ce;
+constexpr int64_t kNumRows = 1 << 16;
+constexpr int kNumColumns = 8;
+
+// Every column holds integers uniformly distributed in [0, 1000) with 1% nulls.
+static std::shared_ptr<RecordBatch> MakeBatch() {
+  random::RandomArrayGenerator rng(kSeed);
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(field("c" + std::to_string(i), int32()));
+    columns.push_back(rng.Int32(kNumRows, 0, 999, /*null_probability=*/0.01));
+  }
+  return RecordBatch::Make(schema(std::move(fields)), kNumRows, std::move(columns));
+}
+
+// A conjunction with one member per column, the first of which selects
+// first_selectivity of rows and the rest rest_selectivity of rows.
+static std::shared_ptr<Expression> Conjunction(double first_selectivity,
+                                               double rest_selectivity) {
+  ExpressionVector members;
+  for (int i = 0; i < kNumColumns; ++i) {
+    double selectivity = i == 0 ? first_selectivity : rest_selectivity;
+    members.push_back(less(field_ref("c" + std::to_string(i)),
+                           scalar(static_cast<int32_t>(selectivity * 1000))));
+  }
+  return and_(members);
+}
+
+// Args: 0 to evaluate with TreeEvaluator, 1 to evaluate with FusedEvaluator
+static void EvaluateFilter(benchmark::State& state,
+                           const std::shared_ptr<Expression>& predicate) {
+  auto batch = MakeBatch();
+  ABORT_NOT_OK(predicate->Validate(*batch->schema()).status());
+
+  std::shared_ptr<ExpressionEvaluator> evaluator;
+  if (state.range(0) == 0) {
+    evaluator = std::make_shared<TreeEvaluator>();
+  } else {
+    evaluator = std::make_shared<FusedEvaluator>();
+  }
+
+  for (auto _ : state) {
+    ASSIGN_OR_ABORT(auto selection, evaluator->Evaluate(*predicate, *batch));
+    ABORT_NOT_OK(evaluator->Filter(selection, batch).status());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+// Each member selects 90% of rows, about 43% of rows satisfy all of them
+static void FilterWideConjunction(benchmark::State& state) {
+  EvaluateFilter(state, Conjunction(0.9, 0.9));
+}
+
+// The first member selects 1% of rows
+static void FilterSelectiveConjunction(benchmark::State& state) {
+  EvaluateFilter(state, Conjunction(0.01, 0.9));
+}
+
+// The first member selects no rows
+static void FilterEmptyConjunction(benchmark::State& state) {
+  EvaluateFilter(state, Conjunction(0.0, 0.9));
+}
+
+// Each member selects half of the remaining rows
+static void FilterHalvingConjunction(benchmark::State& state) {
+  EvaluateFilter(state, Conjunction(0.5, 0.5));
+}
+
+// A disjunction of conjunctions, which is not fused
+static void FilterDisjunction(benchmark::State& state) {
+  EvaluateFilter(state, or_(Conjunction(0.1, 0.9), Conjunction(0.9, 0.1)));
+}
+
+BENCHMARK(FilterWideConjunction)->ArgName("fused")->Arg(0)->Arg(1);
+BENCHMARK(FilterSelectiveConjunction)->ArgName("fused")->Arg(0)->Arg(1);
+BENCHMARK(FilterEmptyConjunction)->ArgName("fused")->Arg(0)->Arg(1);
+BENCHMARK(FilterHalvingConjunction)->ArgName("fused")->Arg(0)->Arg(1);
+BENCHMARK(FilterDisjunction)->ArgName("fused")->Arg(0)->Arg(1);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -30,6 +30,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/checked_cast.h"
@@ -555,6 +556,66 @@ TEST_F(FilterTest, EvaluateTakeExpression) {
   ])");
 }
 
+class FusedEvaluatorTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    constexpr int64_t kLength = 1 << 12;
+    random::RandomArrayGenerator rng(/*seed=*/0);
+    batch_ = RecordBatch::Make(
+        schema({field("a", int32()), field("b", float64()), field("c", int32())}),
+        kLength,
+        {rng.Int32(kLength, 0, 100, /*null_probability=*/0.1),
+         rng.Float64(kLength, 0.0, 1.0, /*null_probability=*/0.1),
+         rng.Int32(kLength, 0, 9, /*null_probability=*/0.1)});
+  }
+
+  void AssertFiltersLikeTreeEvaluator(const Expression& expr) {
+    ASSERT_OK(expr.Validate(*batch_->schema()).status());
+
+    ASSERT_OK_AND_ASSIGN(auto expected_mask, tree_->Evaluate(expr, *batch_));
+    ASSERT_OK_AND_ASSIGN(auto expected, tree_->Filter(expected_mask, batch_));
+
+    ASSERT_OK_AND_ASSIGN(auto mask, fused_->Evaluate(expr, *batch_));
+    ASSERT_TRUE(mask.type()->Equals(expected_mask.type()));
+    ASSERT_OK_AND_ASSIGN(auto actual, fused_->Filter(mask, batch_));
+
+    AssertBatchesEqual(*expected, *actual);
+  }
+
+ protected:
+  std::shared_ptr<ExpressionEvaluator> tree_ = std::make_shared<TreeEvaluator>();
+  std::shared_ptr<ExpressionEvaluator> fused_ = std::make_shared<FusedEvaluator>();
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(FusedEvaluatorTest, Conjunctions) {
+  AssertFiltersLikeTreeEvaluator("a"_ > 10 and "b"_ < 0.9);
+
+  // the first member is selective enough that later members see only surviving rows
+  AssertFiltersLikeTreeEvaluator("a"_ < 10 and "b"_ < 0.5 and "c"_ != 3);
+  AssertFiltersLikeTreeEvaluator(("a"_ == 5 and "c"_ > 2) and ("b"_ > 0.25 or "c"_ < 5));
+
+  // no rows survive the second member
+  AssertFiltersLikeTreeEvaluator("a"_ < 50 and "a"_ > 60 and "b"_ < 0.5);
+}
+
+TEST_F(FusedEvaluatorTest, ScalarMembers) {
+  AssertFiltersLikeTreeEvaluator(*scalar(true) and *scalar(true));
+  AssertFiltersLikeTreeEvaluator("a"_ > 10 and *scalar(true));
+  AssertFiltersLikeTreeEvaluator("a"_ > 10 and *scalar(false));
+  AssertFiltersLikeTreeEvaluator(
+      "a"_ > 10 and *scalar(std::shared_ptr<Scalar>(new BooleanScalar)));
+  AssertFiltersLikeTreeEvaluator("a"_ > 10 and "absent"_ == 0);
+}
+
+TEST_F(FusedEvaluatorTest, NonConjunctions) {
+  AssertFiltersLikeTreeEvaluator("a"_ > 10);
+  AssertFiltersLikeTreeEvaluator("a"_ < 10 or "b"_ < 0.5);
+
+  // nulls must be propagated through nested conjunctions
+  AssertFiltersLikeTreeEvaluator(!("a"_ < 50 and "b"_ < 0.5));
+}
+
 void AssertFieldsInExpression(std::shared_ptr<Expression> expr,
                               std::vector<std::string> expected) {
   EXPECT_THAT(FieldsInExpression(expr), testing::ContainerEq(expected));
@@ -0,0 +1,284 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/metadata_cache.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/util.h"
+#include "arrow/builder.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace dataset {
+
+namespace {
+
+constexpr char kFormatKey[] = "format";
+constexpr char kFingerprintKey[] = "format_fingerprint";
+constexpr char kVersionKey[] = "version";
+constexpr char kVersion[] = "1";
+
+std::shared_ptr<DataType> RowGroupType() {
+  return struct_({field("id", int32()), field("num_rows", int64()),
+                  field("total_byte_size", int64()), field("statistics", binary())});
+}
+
+std::shared_ptr<Schema> CacheSchema(const std::string& format_type_name,
+                                    const std::string& format_fingerprint) {
+  return schema({field("path", utf8(), /*nullable=*/false), field("size", int64()),
+                 field("mtime", timestamp(TimeUnit::NANO)),
+                 field("physical_schema", binary()),
+                 field("row_groups", list(RowGroupType()))},
+                key_value_metadata({kFormatKey, kFingerprintKey, kVersionKey},
+                                   {format_type_name, format_fingerprint, kVersion}));
+}
+
+std::shared_ptr<Buffer> ValueBuffer(const BinaryArray& array, int64_t i) {
+  return SliceBuffer(array.value_data(), array.value_offset(i), array.value_length(i));
+}
+
+// Statistics are StructScalars whose type differs from file to file, so each is
+// stored as a one row IPC stream.
+Result<std::shared_ptr<Buffer>> SerializeStatistics(const StructScalar& statistics) {
+  ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(statistics, 1));
+  ARROW_ASSIGN_OR_RAISE(auto batch, RecordBatch::FromStructArray(array));
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeStreamWriter(sink, batch->schema()));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return sink->Finish();
+}
+
+Result<std::shared_ptr<StructScalar>> DeserializeStatistics(
+    std::shared_ptr<Buffer> buffer) {
+  io::BufferReader stream(std::move(buffer));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchStreamReader::Open(&stream));
+  ARROW_ASSIGN_OR_RAISE(auto batch, reader->Next());
+  if (batch == nullptr || batch->num_rows() != 1) {
+    return Status::Invalid("Cached statistics must hold exactly one row");
+  }
+
+  ScalarVector values;
+  for (const auto& column : batch->columns()) {
+    ARROW_ASSIGN_OR_RAISE(auto value, column->GetScalar(0));
+    values.push_back(std::move(value));
+  }
+  return std::make_shared<StructScalar>(std::move(values),
+                                        struct_(batch->schema()->fields()));
+}
+
+Status AppendRowGroups(const std::vector<RowGroupMetadata>& row_groups,
+                       ListBuilder* builder) {
+  RETURN_NOT_OK(builder->Append());
+  auto struct_builder = checked_cast<StructBuilder*>(builder->value_builder());
+  auto id_builder = checked_cast<Int32Builder*>(struct_builder->field_builder(0));
+  auto num_rows_builder = checked_cast<Int64Builder*>(struct_builder->field_builder(1));
+  auto byte_size_builder = checked_cast<Int64Builder*>(struct_builder->field_builder(2));
+  auto statistics_builder =
+      checked_cast<BinaryBuilder*>(struct_builder->field_builder(3));
+
+  for (const auto& row_group : row_groups) {
+    RETURN_NOT_OK(struct_builder->Append());
+    RETURN_NOT_OK(id_builder->Append(row_group.id));
+    RETURN_NOT_OK(num_rows_builder->Append(row_group.num_rows));
+    RETURN_NOT_OK(byte_size_builder->Append(row_group.total_byte_size));
+    if (row_group.statistics == nullptr) {
+      RETURN_NOT_OK(statistics_builder->AppendNull());
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto statistics, SerializeStatistics(*row_group.statistics));
+    RETURN_NOT_OK(statistics_builder->Append(statistics->data(), statistics->size()));
+  }
+  return Status::OK();
+}
+
+Result<std::vector<RowGroupMetadata>> ReadRowGroups(const ListArray& row_groups,
+                                                    int64_t i) {
+  const auto& structs = checked_cast<const StructArray&>(*row_groups.values());
+  const auto& ids = checked_cast<const Int32Array&>(*structs.field(0));
+  const auto& num_rows = checked_cast<const Int64Array&>(*structs.field(1));
+  const auto& byte_sizes = checked_cast<const Int64Array&>(*structs.field(2));
+  const auto& statistics = checked_cast<const BinaryArray&>(*structs.field(3));
+
+  std::vector<RowGroupMetadata> out;
+  for (int64_t j = row_groups.value_offset(i); j < row_groups.value_offset(i + 1); ++j) {
+    RowGroupMetadata row_group;
+    row_group.id = ids.Value(j);
+    row_group.num_rows = num_rows.Value(j);
+    row_group.total_byte_size = byte_sizes.Value(j);
+    if (statistics.IsValid(j)) {
+      ARROW_ASSIGN_OR_RAISE(row_group.statistics,
+                            DeserializeStatistics(ValueBuffer(statistics, j)));
+    }
+    out.push_back(std::move(row_group));
+  }
+  return out;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<MetadataCache>> MetadataCache::Read(
+    fs::FileSystem* filesystem, const std::string& path, std::string format_type_name,
+    std::string format_fingerprint) {
+  auto cache = std::make_shared<MetadataCache>(std::move(format_type_name),
+                                               std::move(format_fingerprint));
+  if (!cache->ReadEntries(filesystem, path).ok()) {
+    // The cache is only an optimization: rather than failing, start over from an
+    // empty cache, which the next Write() replaces
+    cache->entries_.clear();
+  }
+  return cache;
+}
+
+Status MetadataCache::ReadEntries(fs::FileSystem* filesystem, const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, filesystem->GetFileInfo(path));
+  if (info.type() == fs::FileType::NotFound) {
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto file, filesystem->OpenInputFile(info));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(file));
+
+  auto expected_schema = CacheSchema(format_type_name_, format_fingerprint_);
+  const auto& schema = *reader->schema();
+  if (!schema.Equals(*expected_schema, /*check_metadata=*/false)) {
+    return Status::Invalid("Metadata cache at ", path, " has unexpected schema ",
+                           schema);
+  }
+  if (schema.metadata() == nullptr ||
+      !schema.metadata()->Equals(*expected_schema->metadata())) {
+    // Written for another format, other format options or by another version:
+    // start over
+    return Status::OK();
+  }
+
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    RETURN_NOT_OK(batch->ValidateFull());
+    const auto& paths = checked_cast<const StringArray&>(*batch->column(0));
+    const auto& sizes = checked_cast<const Int64Array&>(*batch->column(1));
+    const auto& mtimes = checked_cast<const TimestampArray&>(*batch->column(2));
+    const auto& schemas = checked_cast<const BinaryArray&>(*batch->column(3));
+    const auto& row_groups = checked_cast<const ListArray&>(*batch->column(4));
+
+    for (int64_t j = 0; j < batch->num_rows(); ++j) {
+      FileMetadata metadata;
+      metadata.info = fs::FileInfo(paths.GetString(j), fs::FileType::File);
+      metadata.info.set_size(sizes.Value(j));
+      metadata.info.set_mtime(fs::TimePoint(fs::TimePoint::duration(mtimes.Value(j))));
+
+      io::BufferReader schema_stream(ValueBuffer(schemas, j));
+      ipc::DictionaryMemo memo;
+      ARROW_ASSIGN_OR_RAISE(metadata.physical_schema,
+                            ipc::ReadSchema(&schema_stream, &memo));
+
+      ARROW_ASSIGN_OR_RAISE(metadata.row_groups, ReadRowGroups(row_groups, j));
+      Insert(std::move(metadata));
+    }
+  }
+  return Status::OK();
+}
+
+Status MetadataCache::Write(fs::FileSystem* filesystem, const std::string& path) const {
+  auto pool = default_memory_pool();
+  StringBuilder paths(pool);
+  Int64Builder sizes(pool);
+  TimestampBuilder mtimes(timestamp(TimeUnit::NANO), pool);
+  BinaryBuilder schemas(pool);
+  std::unique_ptr<ArrayBuilder> row_groups;
+  RETURN_NOT_OK(MakeBuilder(pool, list(RowGroupType()), &row_groups));
+
+  for (const auto& info : files()) {
+    const FileMetadata& metadata = entries_.at(info.path());
+    RETURN_NOT_OK(paths.Append(info.path()));
+    RETURN_NOT_OK(sizes.Append(info.size()));
+    RETURN_NOT_OK(mtimes.Append(info.mtime().time_since_epoch().count()));
+    ARROW_ASSIGN_OR_RAISE(auto schema, ipc::SerializeSchema(*metadata.physical_schema));
+    RETURN_NOT_OK(schemas.Append(schema->data(), schema->size()));
+    RETURN_NOT_OK(AppendRowGroups(metadata.row_groups,
+                                  checked_cast<ListBuilder*>(row_groups.get())));
+  }
+
+  ArrayVector columns(5);
+  RETURN_NOT_OK(paths.Finish(&columns[0]));
+  RETURN_NOT_OK(sizes.Finish(&columns[1]));
+  RETURN_NOT_OK(mtimes.Finish(&columns[2]));
+  RETURN_NOT_OK(schemas.Finish(&columns[3]));
+  RETURN_NOT_OK(row_groups->Finish(&columns[4]));
+
+  auto schema = CacheSchema(format_type_name_, format_fingerprint_);
+  auto batch = RecordBatch::Make(schema, static_cast<int64_t>(entries_.size()),
+                                 std::move(columns));
+
+  auto parent = fs::internal::GetAbstractPathParent(path).first;
+  if (!parent.empty()) {
+    RETURN_NOT_OK(filesystem->CreateDir(parent, /*recursive=*/true));
+  }
+
+  // Write next to the cache then move over it, so that readers never see a
+  // partially written cache
+  const auto temp_path = path + ".tmp";
+  ARROW_ASSIGN_OR_RAISE(auto destination, filesystem->OpenOutputStream(temp_path));
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(destination, schema));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  RETURN_NOT_OK(destination->Close());
+  return filesystem->Move(temp_path, path);
+}
+
+const FileMetadata* MetadataCache::Find(const fs::FileInfo& info) const {
+  auto it = entries_.find(info.path());
+  if (it == entries_.end() || it->second.info.size() != info.size() ||
+      it->second.info.mtime() != info.mtime()) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+void MetadataCache::Insert(FileMetadata metadata) {
+  auto path = metadata.info.path();
+  entries_[std::move(path)] = std::move(metadata);
+}
+
+std::vector<fs::FileInfo> MetadataCache::files() const {
+  std::vector<fs::FileInfo> files;
+  for (const auto& entry : entries_) {
+    files.push_back(entry.second.info);
+  }
+  std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
+  return files;
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A persistent cache of the metadata of a dataset's files.
+///
+/// The cache maps file paths to FileMetadata: size, modification time, physical
+/// schema and row group statistics. An entry is only used while the size and
+/// modification time of its file are unchanged, so a dataset can be re-opened by
+/// reading metadata only for files which are new or were rewritten.
+///
+/// The cache is stored as an Arrow IPC file with one row per file, so it can be
+/// read from any filesystem the dataset itself lives on.
+class ARROW_DS_EXPORT MetadataCache {
+ public:
+  /// \brief Create a cache for the files of a FileFormat.
+  ///
+  /// Entries are only meaningful to the format which read them, with the same
+  /// options: see FileFormat::type_name() and FileFormat::metadata_fingerprint().
+  explicit MetadataCache(std::string format_type_name,
+                         std::string format_fingerprint = "")
+      : format_type_name_(std::move(format_type_name)),
+        format_fingerprint_(std::move(format_fingerprint)) {}
+
+  /// \brief Read a cache written by Write().
+  ///
+  /// If no file exists at path, it can't be read (for example because it is
+  /// truncated or corrupt) or it holds metadata of a different format or format
+  /// options, an empty cache is returned.
+  static Result<std::shared_ptr<MetadataCache>> Read(
+      fs::FileSystem* filesystem, const std::string& path, std::string format_type_name,
+      std::string format_fingerprint = "");
+
+  /// \brief Write the cache to path, replacing any previous file.
+  ///
+  /// The cache is written to a temporary file next to path, then moved to path.
+  Status Write(fs::FileSystem* filesystem, const std::string& path) const;
+
+  /// \brief Return the entry for a file, or nullptr if there is none or the file's
+  /// size or modification time differ from those cached.
+  const FileMetadata* Find(const fs::FileInfo& info) const;
+
+  /// \brief Add an entry, replacing any previous entry with the same path.
+  void Insert(FileMetadata metadata);
+
+  /// \brief The cached files, sorted by path.
+  std::vector<fs::FileInfo> files() const;
+
+  size_t size() const { return entries_.size(); }
+
+  const std::string& format_type_name() const { return format_type_name_; }
+
+  const std::string& format_fingerprint() const { return format_fingerprint_; }
+
+ private:
+  Status ReadEntries(fs::FileSystem* filesystem, const std::string& path);
+
+  std::string format_type_name_;
+  std::string format_fingerprint_;
+  std::unordered_map<std::string, FileMetadata> entries_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
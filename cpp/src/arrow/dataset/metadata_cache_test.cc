@@ -0,0 +1,296 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/metadata_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+std::shared_ptr<StructScalar> MinMax(std::shared_ptr<Scalar> min,
+                                     std::shared_ptr<Scalar> max) {
+  auto type = struct_({field("min", min->type), field("max", max->type)});
+  return std::make_shared<StructScalar>(ScalarVector{std::move(min), std::move(max)},
+                                        std::move(type));
+}
+
+std::shared_ptr<StructScalar> Statistics(
+    std::vector<std::string> names, std::vector<std::shared_ptr<StructScalar>> cols) {
+  FieldVector fields;
+  ScalarVector values;
+  for (size_t i = 0; i < names.size(); ++i) {
+    fields.push_back(field(names[i], cols[i]->type));
+    values.push_back(cols[i]);
+  }
+  return std::make_shared<StructScalar>(std::move(values), struct_(std::move(fields)));
+}
+
+RowGroupMetadata MakeRowGroup(int id, int64_t num_rows, int64_t total_byte_size,
+                              std::shared_ptr<StructScalar> statistics) {
+  RowGroupMetadata row_group;
+  row_group.id = id;
+  row_group.num_rows = num_rows;
+  row_group.total_byte_size = total_byte_size;
+  row_group.statistics = std::move(statistics);
+  return row_group;
+}
+
+FileMetadata MakeFileMetadata(std::string path, int64_t size) {
+  FileMetadata metadata;
+  metadata.info = fs::FileInfo(std::move(path), fs::FileType::File);
+  metadata.info.set_size(size);
+  metadata.info.set_mtime(fs::TimePoint(fs::TimePoint::duration(42)));
+  metadata.physical_schema = schema({field("i32", int32()), field("str", utf8())});
+  return metadata;
+}
+
+void AssertMetadataEqual(const FileMetadata& expected, const FileMetadata& actual) {
+  ASSERT_EQ(expected.info, actual.info);
+  AssertSchemaEqual(*expected.physical_schema, *actual.physical_schema);
+  ASSERT_EQ(expected.row_groups.size(), actual.row_groups.size());
+  for (size_t i = 0; i < expected.row_groups.size(); ++i) {
+    const auto& expected_row_group = expected.row_groups[i];
+    const auto& actual_row_group = actual.row_groups[i];
+    ASSERT_EQ(expected_row_group.id, actual_row_group.id);
+    ASSERT_EQ(expected_row_group.num_rows, actual_row_group.num_rows);
+    ASSERT_EQ(expected_row_group.total_byte_size, actual_row_group.total_byte_size);
+    if (expected_row_group.statistics == nullptr) {
+      ASSERT_EQ(actual_row_group.statistics, nullptr);
+    } else {
+      ASSERT_NE(actual_row_group.statistics, nullptr);
+      AssertScalarsEqual(*expected_row_group.statistics, *actual_row_group.statistics,
+                         /*verbose=*/true);
+    }
+  }
+}
+
+class TestMetadataCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  }
+
+ protected:
+  std::shared_ptr<fs::FileSystem> fs_;
+};
+
+TEST_F(TestMetadataCache, RoundTrip) {
+  MetadataCache cache("ipc");
+
+  auto a = MakeFileMetadata("dataset/a", 100);
+  a.row_groups = {
+      MakeRowGroup(0, 10, 1000,
+                   Statistics({"i32", "str"},
+                              {MinMax(MakeScalar(1), MakeScalar(7)),
+                               MinMax(MakeScalar("ex"), MakeScalar("why"))})),
+      // Statistics for some columns only, or none at all
+      MakeRowGroup(1, 20, 2000,
+                   Statistics({"i32"}, {MinMax(MakeScalar(-3), MakeScalar(3))})),
+      MakeRowGroup(2, 30, 3000, nullptr)};
+  cache.Insert(a);
+
+  // No row groups
+  auto b = MakeFileMetadata("dataset/b", 200);
+  cache.Insert(b);
+
+  const std::string path = "cache/_metadata_cache.arrow";
+  ASSERT_OK(cache.Write(fs_.get(), path));
+  ASSERT_OK_AND_ASSIGN(auto read, MetadataCache::Read(fs_.get(), path, "ipc"));
+
+  ASSERT_EQ(read->size(), 2);
+  ASSERT_EQ(read->files(), (std::vector<fs::FileInfo>{a.info, b.info}));
+  for (const auto& expected : {a, b}) {
+    auto actual = read->Find(expected.info);
+    ASSERT_NE(actual, nullptr);
+    AssertMetadataEqual(expected, *actual);
+  }
+}
+
+TEST_F(TestMetadataCache, FindRequiresUnchangedFile) {
+  MetadataCache cache("ipc");
+  auto a = MakeFileMetadata("dataset/a", 100);
+  cache.Insert(a);
+
+  ASSERT_NE(cache.Find(a.info), nullptr);
+
+  auto resized = a.info;
+  resized.set_size(101);
+  ASSERT_EQ(cache.Find(resized), nullptr);
+
+  auto touched = a.info;
+  touched.set_mtime(a.info.mtime() + std::chrono::seconds(1));
+  ASSERT_EQ(cache.Find(touched), nullptr);
+
+  ASSERT_EQ(cache.Find(fs::FileInfo("dataset/b", fs::FileType::File)), nullptr);
+}
+
+TEST_F(TestMetadataCache, ReadMissingOrForeign) {
+  ASSERT_OK_AND_ASSIGN(auto read, MetadataCache::Read(fs_.get(), "missing", "ipc"));
+  ASSERT_EQ(read->size(), 0);
+
+  MetadataCache cache("ipc");
+  cache.Insert(MakeFileMetadata("dataset/a", 100));
+  ASSERT_OK(cache.Write(fs_.get(), "cache"));
+
+  // Entries of another format are not reused
+  ASSERT_OK_AND_ASSIGN(read, MetadataCache::Read(fs_.get(), "cache", "parquet"));
+  ASSERT_EQ(read->size(), 0);
+  ASSERT_EQ(read->format_type_name(), "parquet");
+
+  // Nor are entries read with other format options
+  MetadataCache with_options("ipc", "options");
+  with_options.Insert(MakeFileMetadata("dataset/a", 100));
+  ASSERT_OK(with_options.Write(fs_.get(), "cache"));
+  ASSERT_OK_AND_ASSIGN(read, MetadataCache::Read(fs_.get(), "cache", "ipc"));
+  ASSERT_EQ(read->size(), 0);
+  ASSERT_OK_AND_ASSIGN(read, MetadataCache::Read(fs_.get(), "cache", "ipc", "other"));
+  ASSERT_EQ(read->size(), 0);
+  ASSERT_OK_AND_ASSIGN(read, MetadataCache::Read(fs_.get(), "cache", "ipc", "options"));
+  ASSERT_EQ(read->size(), 1);
+  ASSERT_EQ(read->format_fingerprint(), "options");
+}
+
+TEST_F(TestMetadataCache, ReadCorrupt) {
+  MetadataCache cache("ipc");
+  cache.Insert(MakeFileMetadata("dataset/a", 100));
+  ASSERT_OK(cache.Write(fs_.get(), "cache"));
+  ASSERT_OK_AND_ASSIGN(auto info, fs_->GetFileInfo("cache"));
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(info));
+  ASSERT_OK_AND_ASSIGN(auto contents, file->Read(info.size()));
+
+  // Truncated or garbled caches read as empty
+  for (auto corrupt : {SliceBuffer(contents, 0, contents->size() / 2),
+                       Buffer::FromString(std::string(contents->size(), 'x'))}) {
+    ASSERT_OK_AND_ASSIGN(auto out, fs_->OpenOutputStream("cache"));
+    ASSERT_OK(out->Write(corrupt));
+    ASSERT_OK(out->Close());
+    ASSERT_OK_AND_ASSIGN(auto read, MetadataCache::Read(fs_.get(), "cache", "ipc"));
+    ASSERT_EQ(read->size(), 0);
+  }
+
+  // Writing replaces the corrupt cache, leaving no temporary file behind
+  ASSERT_OK(cache.Write(fs_.get(), "cache"));
+  ASSERT_OK_AND_ASSIGN(auto read, MetadataCache::Read(fs_.get(), "cache", "ipc"));
+  ASSERT_EQ(read->size(), 1);
+  ASSERT_OK_AND_ASSIGN(info, fs_->GetFileInfo("cache.tmp"));
+  ASSERT_EQ(info.type(), fs::FileType::NotFound);
+}
+
+class CountingIpcFileFormat : public IpcFileFormat {
+ public:
+  Result<FileMetadata> ReadMetadata(const FileSource& source) const override {
+    ++num_reads;
+    return IpcFileFormat::ReadMetadata(source);
+  }
+
+  mutable std::atomic<int> num_reads{0};
+};
+
+class TestMetadataCacheDiscovery : public TestMetadataCache {
+ public:
+  void WriteFile(const std::string& path, int64_t num_rows) {
+    auto batch = ConstantArrayGenerator::Zeroes(num_rows, schema_);
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, schema_));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    ASSERT_OK_AND_ASSIGN(auto out, fs_->OpenOutputStream(path));
+    ASSERT_OK(out->Write(buffer));
+    ASSERT_OK(out->Close());
+  }
+
+  // Discover and finish a dataset, returning the number of files whose metadata
+  // was read rather than taken from the cache
+  int Open(std::shared_ptr<Dataset>* dataset) {
+    fs::FileSelector selector;
+    selector.base_dir = "dataset";
+    selector.recursive = true;
+
+    FileSystemFactoryOptions options;
+    options.metadata_cache_path = "dataset/_metadata_cache.arrow";
+
+    auto format = std::make_shared<CountingIpcFileFormat>();
+    EXPECT_OK_AND_ASSIGN(auto factory,
+                         FileSystemDatasetFactory::Make(fs_, selector, format, options));
+    EXPECT_OK_AND_ASSIGN(*dataset, factory->Finish());
+    return format->num_reads;
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("i32", int32()), field("f64", float64())});
+};
+
+TEST_F(TestMetadataCacheDiscovery, ReopenReadsOnlyChangedFiles) {
+  ASSERT_OK(fs_->CreateDir("dataset/x"));
+  WriteFile("dataset/x/a", 10);
+  WriteFile("dataset/x/b", 10);
+  WriteFile("dataset/c", 10);
+
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_EQ(Open(&dataset), 3);
+  AssertSchemaEqual(*schema_, *dataset->schema());
+
+  ASSERT_EQ(Open(&dataset), 0);
+  AssertSchemaEqual(*schema_, *dataset->schema());
+  EXPECT_THAT(checked_pointer_cast<FileSystemDataset>(dataset)->files(),
+              testing::ElementsAre("dataset/c", "dataset/x/a", "dataset/x/b"));
+
+  // A rewritten and a new file are read, the others still come from the cache
+  WriteFile("dataset/x/b", 20);
+  WriteFile("dataset/d", 10);
+  ASSERT_EQ(Open(&dataset), 2);
+  ASSERT_EQ(Open(&dataset), 0);
+
+  // Removing a file rewrites the cache without reading the remaining ones
+  ASSERT_OK(fs_->DeleteFile("dataset/c"));
+  ASSERT_EQ(Open(&dataset), 0);
+  EXPECT_THAT(checked_pointer_cast<FileSystemDataset>(dataset)->files(),
+              testing::ElementsAre("dataset/d", "dataset/x/a", "dataset/x/b"));
+  ASSERT_OK_AND_ASSIGN(
+      auto cache, MetadataCache::Read(fs_.get(), "dataset/_metadata_cache.arrow", "ipc"));
+  ASSERT_EQ(cache->size(), 3);
+
+  // Fragments carry the cached physical schema
+  ASSERT_OK_AND_ASSIGN(auto fragments, dataset->GetFragments().ToVector());
+  for (const auto& fragment : fragments) {
+    ASSERT_OK_AND_ASSIGN(auto physical_schema, fragment->ReadPhysicalSchema());
+    AssertSchemaEqual(*schema_, *physical_schema);
+  }
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <deque>
 #include <memory>
 #include <mutex>
 
@@ -60,10 +61,33 @@ std::vector<std::string> ScanOptions::MaterializedFields() const {
   return fields;
 }
 
+Future<RecordBatchIterator> ScanTask::ExecuteAsync(const io::AsyncContext& ctx) {
+  auto self = shared_from_this();
+  arrow::internal::TaskHints hints;
+  hints.external_id = ctx.external_id;
+  auto maybe_fut =
+      ctx.executor->Submit(std::move(hints), [self]() -> Result<RecordBatchIterator> {
+        // Materialize the batches on the executor, the Future completes once
+        // the reads are done.
+        ARROW_ASSIGN_OR_RAISE(auto batch_it, self->Execute());
+        ARROW_ASSIGN_OR_RAISE(auto batches, batch_it.ToVector());
+        return MakeVectorIterator(std::move(batches));
+      });
+  if (!maybe_fut.ok()) {
+    return Future<RecordBatchIterator>::MakeFinished(maybe_fut.status());
+  }
+  return *std::move(maybe_fut);
+}
+
 Result<RecordBatchIterator> InMemoryScanTask::Execute() {
   return MakeVectorIterator(record_batches_);
 }
 
+Future<RecordBatchIterator> InMemoryScanTask::ExecuteAsync(const io::AsyncContext&) {
+  // Nothing to read
+  return Future<RecordBatchIterator>::MakeFinished(MakeVectorIterator(record_batches_));
+}
+
 FragmentIterator Scanner::GetFragments() {
   if (fragment_ != nullptr) {
     return MakeVectorIterator(FragmentVector{fragment_});
@@ -82,6 +106,72 @@ Result<ScanTaskIterator> Scanner::Scan() {
   return GetScanTaskIterator(GetFragments(), scan_options_, scan_context_);
 }
 
+namespace {
+
+/// Keeps up to `readahead` ScanTasks executing ahead of the consumer.
+class ScanTaskReadaheadGenerator {
+ public:
+  ScanTaskReadaheadGenerator(ScanTaskIterator scan_tasks, io::AsyncContext ctx,
+                             int readahead)
+      : state_(std::make_shared<State>(std::move(scan_tasks), std::move(ctx),
+                                       readahead)) {}
+
+  Future<RecordBatchIterator> operator()() {
+    Status st = state_->Pump();
+    if (!st.ok()) {
+      return Future<RecordBatchIterator>::MakeFinished(std::move(st));
+    }
+    if (state_->in_flight.empty()) {
+      return Future<RecordBatchIterator>::MakeFinished(
+          IterationTraits<RecordBatchIterator>::End());
+    }
+    auto next = std::move(state_->in_flight.front());
+    state_->in_flight.pop_front();
+    return next;
+  }
+
+ private:
+  struct State {
+    State(ScanTaskIterator scan_tasks, io::AsyncContext ctx, int readahead)
+        : scan_tasks(std::move(scan_tasks)), ctx(std::move(ctx)), readahead(readahead) {}
+
+    // Start ScanTasks until `readahead` of them are in flight
+    Status Pump() {
+      while (!exhausted && static_cast<int>(in_flight.size()) < readahead) {
+        ARROW_ASSIGN_OR_RAISE(auto scan_task, scan_tasks.Next());
+        if (scan_task == nullptr) {
+          exhausted = true;
+          break;
+        }
+        in_flight.push_back(scan_task->ExecuteAsync(ctx));
+      }
+      return Status::OK();
+    }
+
+    ScanTaskIterator scan_tasks;
+    io::AsyncContext ctx;
+    const int readahead;
+    bool exhausted = false;
+    std::deque<Future<RecordBatchIterator>> in_flight;
+  };
+
+  // AsyncGenerator must be copyable
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace
+
+Result<AsyncGenerator<RecordBatchIterator>> Scanner::ScanAsync(io::AsyncContext ctx,
+                                                              int readahead) {
+  if (readahead <= 0) {
+    return Status::Invalid("ScanAsync readahead must be greater than 0, got ",
+                           readahead);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto scan_task_it, Scan());
+  return AsyncGenerator<RecordBatchIterator>(
+      ScanTaskReadaheadGenerator(std::move(scan_task_it), std::move(ctx), readahead));
+}
+
 Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
     std::vector<std::shared_ptr<RecordBatch>> batches,
     std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context) {
@@ -144,7 +234,7 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   }
 
   if (!scan_options->filter->Equals(true)) {
-    scan_options->evaluator = std::make_shared<TreeEvaluator>();
+    scan_options->evaluator = std::make_shared<FusedEvaluator>();
   }
 
   if (dataset_ == nullptr) {
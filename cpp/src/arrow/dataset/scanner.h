@@ -29,14 +29,17 @@
 #include "arrow/dataset/projector.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/future_iterator.h"
 #include "arrow/util/type_fwd.h"
 
 namespace arrow {
 namespace dataset {
 
 constexpr int64_t kDefaultBatchSize = 1 << 20;
+constexpr int kDefaultScanReadahead = 16;
 
 /// \brief Shared state for a Scan operation
 struct ARROW_DS_EXPORT ScanContext {
@@ -100,13 +103,21 @@ class ARROW_DS_EXPORT ScanOptions {
 /// \brief Read record batches from a range of a single data fragment. A
 /// ScanTask is meant to be a unit of work to be dispatched. The implementation
 /// must be thread and concurrent safe.
-class ARROW_DS_EXPORT ScanTask {
+class ARROW_DS_EXPORT ScanTask : public std::enable_shared_from_this<ScanTask> {
  public:
   /// \brief Iterate through sequence of materialized record batches
   /// resulting from the Scan. Execution semantics are encapsulated in the
   /// particular ScanTask implementation
   virtual Result<RecordBatchIterator> Execute() = 0;
 
+  /// \brief Materialize the record batches of this ScanTask asynchronously.
+  ///
+  /// The returned Future completes once every batch is in memory. The default
+  /// implementation runs Execute() on the executor of the AsyncContext (the
+  /// I/O thread pool unless specified), so that blocking reads do not
+  /// occupy CPU threads.
+  virtual Future<RecordBatchIterator> ExecuteAsync(const io::AsyncContext& ctx);
+
   virtual ~ScanTask() = default;
 
   const std::shared_ptr<ScanOptions>& options() const { return options_; }
@@ -131,6 +142,8 @@ class ARROW_DS_EXPORT InMemoryScanTask : public ScanTask {
 
   Result<RecordBatchIterator> Execute() override;
 
+  Future<RecordBatchIterator> ExecuteAsync(const io::AsyncContext& ctx) override;
+
  protected:
   std::vector<std::shared_ptr<RecordBatch>> record_batches_;
 };
@@ -166,6 +179,17 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Scan asynchronously.
+  ///
+  /// Each call to the returned generator yields a Future for the record
+  /// batches of the next ScanTask, in the order of Scan(). Up to `readahead`
+  /// ScanTasks are executed concurrently on the executor of `ctx`, which
+  /// keeps many fragments in flight while their consumer decodes or
+  /// computes. The sequence ends with a null RecordBatchIterator.
+  Result<AsyncGenerator<RecordBatchIterator>> ScanAsync(
+      io::AsyncContext ctx = io::AsyncContext(),
+      int readahead = kDefaultScanReadahead);
+
   /// \brief Convert a Scanner into a Table.
   ///
   /// Use this convenience utility with care. This will serially materialize the
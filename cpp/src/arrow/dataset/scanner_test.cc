@@ -147,6 +147,27 @@ TEST_F(TestScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST_F(TestScanner, ScanAsync) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  auto scanner = MakeScanner(batch);
+
+  for (int readahead : {1, kDefaultScanReadahead}) {
+    ASSERT_OK_AND_ASSIGN(auto generator, scanner.ScanAsync(io::AsyncContext(), readahead));
+    auto batch_it = MakeFlattenIterator(MakeGeneratorIterator(std::move(generator)));
+
+    int64_t num_batches = 0;
+    ASSERT_OK(batch_it.Visit([&](std::shared_ptr<RecordBatch> actual) {
+      AssertBatchesEqual(*batch, *actual);
+      ++num_batches;
+      return Status::OK();
+    }));
+    ASSERT_EQ(num_batches, kNumberChildDatasets * kNumberBatches);
+  }
+
+  ASSERT_RAISES(Invalid, scanner.ScanAsync(io::AsyncContext(), 0));
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     DatasetVector sources;
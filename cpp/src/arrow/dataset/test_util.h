@@ -763,6 +763,78 @@ class WriteFileSystemDatasetMixin : public MakeFileSystemDatasetMixin {
     AssertWrittenAsExpected();
   }
 
+  void TestWriteRowsWithPooledWriters() {
+    auto desired_partitioning = std::make_shared<DirectoryPartitioning>(
+        SchemaFromColumnNames(source_schema_, {"country"}));
+
+    // The source is not partitioned on country, so rows of each input batch are split
+    // between partitions. With a single open file, switching partition closes the
+    // current file; files are also closed once they hold two rows.
+    FileSystemDatasetWriteOptions write_options;
+    write_options.format = format_;
+    write_options.filesystem = fs_;
+    write_options.base_dir = "new_root/";
+    write_options.partitioning = desired_partitioning;
+    write_options.max_open_files = 1;
+    write_options.max_rows_per_file = 2;
+
+    ASSERT_OK_AND_ASSIGN(
+        auto scanner,
+        ScannerBuilder(dataset_, std::make_shared<ScanContext>()).Finish());
+    ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+    ASSERT_OK(FileSystemDataset::Write(
+        write_options, IteratorFromReader(std::make_shared<TableBatchReader>(*table))));
+
+    fs::FileSelector s;
+    s.recursive = true;
+    s.base_dir = "/new_root";
+
+    FileSystemFactoryOptions options;
+    options.partitioning = desired_partitioning;
+    ASSERT_OK_AND_ASSIGN(auto factory,
+                         FileSystemDatasetFactory::Make(fs_, s, format_, options));
+    ASSERT_OK_AND_ASSIGN(written_, factory->Finish());
+
+    expected_files_["/new_root/US/part-0." + format_->type_name()] = R"([
+        {"region": "NY", "model": "3", "sales": 742.0, "year": 2018, "month": 1},
+        {"region": "NY", "model": "S", "sales": 304.125, "year": 2018, "month": 1}
+  ])";
+    expected_files_["/new_root/US/part-1." + format_->type_name()] = R"([
+        {"region": "NY", "model": "Y", "sales": 27.5, "year": 2018, "month": 1}
+  ])";
+    expected_files_["/new_root/CA/part-2." + format_->type_name()] = R"([
+        {"region": "QC", "model": "3", "sales": 512, "year": 2018, "month": 1},
+        {"region": "QC", "model": "S", "sales": 978, "year": 2018, "month": 1}
+  ])";
+    expected_files_["/new_root/CA/part-3." + format_->type_name()] = R"([
+        {"region": "QC", "model": "X", "sales": 1.0, "year": 2018, "month": 1},
+        {"region": "QC", "model": "Y", "sales": 69, "year": 2018, "month": 1}
+  ])";
+    expected_files_["/new_root/US/part-4." + format_->type_name()] = R"([
+        {"region": "NY", "model": "X", "sales": 136.25, "year": 2018, "month": 1},
+        {"region": "CA", "model": "3", "sales": 273.5, "year": 2019, "month": 1}
+  ])";
+    expected_files_["/new_root/US/part-5." + format_->type_name()] = R"([
+        {"region": "CA", "model": "S", "sales": 13, "year": 2019, "month": 1},
+        {"region": "CA", "model": "X", "sales": 54, "year": 2019, "month": 1}
+  ])";
+    expected_files_["/new_root/US/part-6." + format_->type_name()] = R"([
+        {"region": "CA", "model": "Y", "sales": 21, "year": 2019, "month": 1}
+  ])";
+    expected_files_["/new_root/CA/part-7." + format_->type_name()] = R"([
+        {"region": "QC", "model": "S", "sales": 10, "year": 2019, "month": 1},
+        {"region": "QC", "model": "3", "sales": 152.25, "year": 2019, "month": 1}
+  ])";
+    expected_files_["/new_root/CA/part-8." + format_->type_name()] = R"([
+        {"region": "QC", "model": "X", "sales": 42, "year": 2019, "month": 1},
+        {"region": "QC", "model": "Y", "sales": 37, "year": 2019, "month": 1}
+  ])";
+    expected_physical_schema_ = SchemaFromColumnNames(
+        source_schema_, {"region", "model", "sales", "year", "month"});
+
+    AssertWrittenAsExpected();
+  }
+
   void AssertWrittenAsExpected() {
     std::vector<std::string> files;
     for (const auto& file_contents : expected_files_) {
@@ -48,7 +48,12 @@ using FragmentVector = std::vector<std::shared_ptr<Fragment>>;
 class FileSource;
 class FileFormat;
 class FileFragment;
+class FileWriter;
+struct FileMetadata;
+struct RowGroupMetadata;
 class FileSystemDataset;
+class FileSystemDatasetWriter;
+struct FileSystemDatasetWriteOptions;
 
 class InMemoryDataset;
 
@@ -24,6 +24,7 @@
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <string>
 #include <typeinfo>
 #include <utility>
 
@@ -33,10 +34,12 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/value_parsing.h"
 
 namespace arrow {
 
@@ -322,8 +325,27 @@ void SharedExclusiveChecker::UnlockExclusive() {}
 
 #endif
 
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+static int DefaultIOThreadPoolCapacity() {
+  auto maybe_value = ::arrow::internal::GetEnvVar("ARROW_IO_THREADS");
+  if (maybe_value.ok()) {
+    const auto& value = *maybe_value;
+    int32_t capacity = 0;
+    if (::arrow::internal::ParseValue<Int32Type>(value.data(), value.size(),
+                                                 &capacity) &&
+        capacity > 0) {
+      return capacity;
+    }
+    ARROW_LOG(WARNING) << "ARROW_IO_THREADS does not contain a valid number of "
+                          "threads, using the default of "
+                       << kDefaultIOThreadPoolCapacity;
+  }
+  return kDefaultIOThreadPoolCapacity;
+}
+
 static std::shared_ptr<ThreadPool> MakeIOThreadPool() {
-  auto maybe_pool = ThreadPool::MakeEternal(/*threads=*/8);
+  auto maybe_pool = ThreadPool::MakeEternal(DefaultIOThreadPoolCapacity());
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global IO thread pool");
   }
@@ -429,5 +451,12 @@ std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
 }
 
 }  // namespace internal
+
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -48,6 +48,27 @@ struct ReadRange {
   }
 };
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches blocking I/O, such as ReadAsync() calls and readahead of
+/// input streams.  It is sized independently of the CPU thread pool, since
+/// I/O-bound tasks mostly wait on storage rather than compute.
+///
+/// The default is 8, or the value of the ARROW_IO_THREADS environment
+/// variable.  You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches blocking I/O.  High-latency filesystems (such as object
+/// stores) generally benefit from many more concurrent requests than there
+/// are CPU cores.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 // EXPERIMENTAL
 struct ARROW_EXPORT AsyncContext {
   ::arrow::internal::Executor* executor;
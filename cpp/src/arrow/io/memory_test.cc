@@ -44,6 +44,7 @@
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -280,6 +281,20 @@ TEST(TestBufferReader, WillNeed) {
   }
 }
 
+TEST(TestIOThreadPool, Capacity) {
+  int capacity = GetIOThreadPoolCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_EQ(internal::GetIOThreadPool()->GetCapacity(), capacity);
+  // The default AsyncContext dispatches to the I/O pool, not the CPU pool
+  ASSERT_EQ(AsyncContext().executor, internal::GetIOThreadPool());
+  ASSERT_NE(AsyncContext().executor, ::arrow::internal::GetCpuThreadPool());
+
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 5));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 5);
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+  ASSERT_RAISES(Invalid, SetIOThreadPoolCapacity(0));
+}
+
 TEST(TestRandomAccessFile, GetStream) {
   std::string data = "data1data2data3data4data5";
 
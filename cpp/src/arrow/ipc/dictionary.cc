@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -146,6 +147,8 @@ struct DictionaryMemo::Impl {
   // Map of dictionary id to dictionary array(s) (several in case of deltas)
   std::unordered_map<int64_t, ArrayDataVector> id_to_dictionary_;
   std::unordered_map<int64_t, std::shared_ptr<DataType>> id_to_type_;
+  // Ids whose first dictionary array is the (validated) result of combining deltas
+  std::unordered_set<int64_t> combined_ids_;
   DictionaryFieldMapper mapper_;
 
   Result<decltype(id_to_dictionary_)::iterator> FindDictionary(int64_t id) {
@@ -170,12 +173,17 @@ struct DictionaryMemo::Impl {
       // corrupted data.  Full validation is necessary for certain types
       // (for example nested dictionaries).
       // XXX: this won't work if there are unresolved nested dictionaries.
+      // A previously combined dictionary doesn't need validating again.
+      const bool first_validated = combined_ids_.count(id) != 0;
       for (const auto& data : *data_vector) {
         to_combine.push_back(MakeArray(data));
-        RETURN_NOT_OK(to_combine.back()->ValidateFull());
+        if (to_combine.size() > 1 || !first_validated) {
+          RETURN_NOT_OK(to_combine.back()->ValidateFull());
+        }
       }
       ARROW_ASSIGN_OR_RAISE(auto combined_dict, Concatenate(to_combine, pool));
       *data_vector = {combined_dict->data()};
+      combined_ids_.insert(id);
     }
 
     return data_vector->back();
@@ -239,6 +247,7 @@ Status DictionaryMemo::AddDictionaryDelta(int64_t id,
 Status DictionaryMemo::AddOrReplaceDictionary(
     int64_t id, const std::shared_ptr<ArrayData>& dictionary) {
   impl_->id_to_dictionary_[id] = {dictionary};
+  impl_->combined_ids_.erase(id);
   return Status::OK();
 }
 
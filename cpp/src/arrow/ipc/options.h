@@ -24,6 +24,7 @@
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -62,10 +63,37 @@ struct ARROW_EXPORT IpcWriteOptions {
   Compression::type compression = Compression::UNCOMPRESSED;
   int compression_level = Compression::kUseDefaultCompressionLevel;
 
+  /// \brief Minimum space savings required to write a buffer compressed
+  ///
+  /// If set, body buffers whose compressed size would exceed
+  /// `(1 - min_space_savings)` times their uncompressed size are written
+  /// uncompressed instead.  Older readers do not support such buffers.  Must be
+  /// between 0 and 1.
+  util::optional<double> min_space_savings;
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
 
+  /// \brief Let record batch writers compress a batch while the previous one is
+  /// being written out
+  ///
+  /// Only applies when compressing with `use_threads`.  Each record batch is
+  /// then only written by the following call to WriteRecordBatch() or by
+  /// Close(), so this must not be enabled when a peer waits for each batch or
+  /// when metadata is attached to the next written payload (as in Flight).
+  bool pipeline_record_batches = false;
+
+  /// \brief Whether to emit dictionary deltas
+  ///
+  /// If a dictionary-encoded column's dictionary changes between record
+  /// batches and the new dictionary extends the previously written one, only
+  /// the appended entries are written, as a delta dictionary batch.
+  /// Otherwise, the whole new dictionary is written again (which the IPC file
+  /// format does not support).  This is off by default, as readers which don't
+  /// support dictionary deltas fail on them.
+  bool emit_dictionary_deltas = false;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
@@ -94,6 +122,15 @@ struct ARROW_EXPORT IpcReadOptions {
   /// like decompression
   bool use_threads = true;
 
+  /// \brief EXPERIMENTAL: Only read the data of included fields
+  ///
+  /// Only applies to RecordBatchFileReader on files supporting zero-copy reads,
+  /// such as io::MemoryMappedFile.  Each included field's buffers are sliced
+  /// from the file on their own, so that the pages of other fields are never
+  /// touched.  Compressed columns of included fields are decompressed when the
+  /// record batch is read.
+  bool lazy = false;
+
   static IpcReadOptions Defaults();
 };
 
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "arrow/api.h"
 #include "arrow/io/memory.h"
@@ -187,10 +188,60 @@ static void DecodeStream(benchmark::State& state) {  // NOLINT non-const referen
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Write then read back a stream whose string dictionary grows by a fixed
+// number of entries with every batch, as when dictionary-encoding a stream
+// incrementally.  The "stream_size" counter shows the bytes on the wire.
+static void GrowingDictionary(benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int64_t kNumBatches = 64;
+  constexpr int64_t kNewEntriesPerBatch = 1 << 12;
+  constexpr int64_t kRowsPerBatch = 1 << 14;
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = state.range(0) != 0;
+
+  random::RandomArrayGenerator rand(0x4f32a908);
+  auto type = dictionary(int32(), utf8());
+  auto schema = ::arrow::schema({field("f0", type)});
+  auto values = rand.String(kNumBatches * kNewEntriesPerBatch, /*min_length=*/8,
+                            /*max_length=*/24);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t i = 0; i < kNumBatches; ++i) {
+    const int64_t dictionary_length = (i + 1) * kNewEntriesPerBatch;
+    auto indices =
+        rand.Int32(kRowsPerBatch, 0, static_cast<int32_t>(dictionary_length - 1));
+    auto array =
+        *DictionaryArray::FromArrays(type, indices, values->Slice(0, dictionary_length));
+    batches.push_back(RecordBatch::Make(schema, kRowsPerBatch, {array}));
+  }
+
+  std::shared_ptr<ResizableBuffer> buffer = *AllocateResizableBuffer(1024);
+  int64_t stream_size = 0;
+  while (state.KeepRunning()) {
+    io::BufferOutputStream stream(buffer);
+    auto writer = *ipc::MakeStreamWriter(&stream, schema, options);
+    for (const auto& batch : batches) {
+      ABORT_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ABORT_NOT_OK(writer->Close());
+    stream_size = *stream.Tell();
+    ABORT_NOT_OK(stream.Close());
+
+    io::BufferReader input(buffer);
+    auto reader = *ipc::RecordBatchStreamReader::Open(&input);
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      ABORT_NOT_OK(reader->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+  state.counters["stream_size"] = static_cast<double>(stream_size);
+  state.SetBytesProcessed(int64_t(state.iterations()) * stream_size);
+  state.SetItemsProcessed(int64_t(state.iterations()) * kNumBatches * kRowsPerBatch);
+}
+
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadFile)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(DecodeStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(GrowingDictionary)->ArgName("deltas")->Arg(0)->Arg(1)->UseRealTime();
 
 }  // namespace arrow
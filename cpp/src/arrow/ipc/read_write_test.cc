@@ -592,6 +592,20 @@ TEST_P(TestIpcRoundTrip, ZeroLengthArrays) {
   CheckRoundtrip(bin_array2);
 }
 
+// The uncompressed length prefixes of a compressed batch's non empty body buffers
+Result<std::vector<int64_t>> BodyBufferPrefixes(const RecordBatch& batch,
+                                                const IpcWriteOptions& options) {
+  IpcPayload payload;
+  RETURN_NOT_OK(GetRecordBatchPayload(batch, options, &payload));
+  std::vector<int64_t> prefixes;
+  for (const auto& buffer : payload.body_buffers) {
+    if (buffer->size() == 0) continue;
+    prefixes.push_back(BitUtil::FromLittleEndian(
+        *reinterpret_cast<const int64_t*>(buffer->data())));
+  }
+  return prefixes;
+}
+
 TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   random::RandomArrayGenerator rg(/*seed=*/0);
 
@@ -629,6 +643,25 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
     write_options.use_threads = false;
     read_options.use_threads = false;
     CheckRoundtrip(*batch, write_options, read_options);
+
+    // Check buffers left uncompressed
+    write_options = IpcWriteOptions::Defaults();
+    write_options.compression = codec;
+    ASSERT_OK_AND_ASSIGN(auto prefixes, BodyBufferPrefixes(*batch, write_options));
+    for (int64_t prefix : prefixes) {
+      ASSERT_GE(prefix, 0);
+    }
+
+    write_options.min_space_savings = 0.99;
+    ASSERT_OK_AND_ASSIGN(prefixes, BodyBufferPrefixes(*batch, write_options));
+    ASSERT_FALSE(prefixes.empty());
+    for (int64_t prefix : prefixes) {
+      ASSERT_EQ(prefix, -1);
+    }
+    CheckRoundtrip(*batch, write_options);
+
+    write_options.min_space_savings = 1.5;
+    ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, write_options));
   }
 
   std::vector<Compression::type> disallowed_codecs = {
@@ -644,6 +677,71 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, LazyFileRead) {
+  random::RandomArrayGenerator rg(/*seed=*/0);
+
+  int64_t length = 500;
+
+  int dict_size = 50;
+  std::shared_ptr<Array> dict = rg.String(dict_size, /*min_length=*/5, /*max_length=*/5,
+                                          /*null_probability=*/0);
+  std::shared_ptr<Array> indices = rg.Int32(length, /*min=*/0, /*max=*/dict_size - 1,
+                                            /*null_probability=*/0.1);
+
+  auto dict_type = dictionary(int32(), utf8());
+  auto dict_field = field("f1", dict_type);
+  ASSERT_OK_AND_ASSIGN(auto dict_array,
+                       DictionaryArray::FromArrays(dict_type, indices, dict));
+  auto f2 = rg.Int64(length, /*min=*/0, /*max=*/100, /*null_probability=*/0.1);
+
+  auto schema = ::arrow::schema({field("f0", utf8()), dict_field, field("f2", int64())});
+  auto batch =
+      RecordBatch::Make(schema, length, {rg.String(length, 0, 10, 0.1), dict_array, f2});
+  auto expected = RecordBatch::Make(::arrow::schema({dict_field, field("f2", int64())}),
+                                    length, {dict_array, f2});
+
+  std::vector<Compression::type> codecs = {Compression::UNCOMPRESSED,
+                                           Compression::LZ4_FRAME, Compression::ZSTD};
+  for (auto codec : codecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    std::stringstream ss;
+    ss << "test-lazy-file-read-" << g_file_number++;
+    ASSERT_OK_AND_ASSIGN(mmap_, io::MemoryMapFixture::InitMemoryMap(
+                                    /*buffer_size=*/1 << 20, TempFile(ss.str())));
+
+    IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+    write_options.compression = codec;
+    ASSERT_OK_AND_ASSIGN(auto file_writer,
+                         MakeFileWriter(mmap_, batch->schema(), write_options));
+    ASSERT_OK(file_writer->WriteRecordBatch(*batch));
+    ASSERT_OK(file_writer->Close());
+    ASSERT_OK_AND_ASSIGN(int64_t footer_offset, mmap_->Tell());
+
+    IpcReadOptions read_options = IpcReadOptions::Defaults();
+    read_options.lazy = true;
+    read_options.included_fields = {1, 2};
+    ASSERT_OK_AND_ASSIGN(auto file_reader, RecordBatchFileReader::Open(
+                                               mmap_.get(), footer_offset, read_options));
+    ASSERT_OK_AND_ASSIGN(auto result, file_reader->ReadRecordBatch(0));
+
+    if (codec == Compression::UNCOMPRESSED) {
+      // Buffers are slices of the memory map
+      ASSERT_OK_AND_ASSIGN(auto file_data, mmap_->ReadAt(0, footer_offset));
+      const uint8_t* values = result->column_data(1)->buffers[1]->data();
+      ASSERT_GE(values, file_data->data());
+      ASSERT_LT(values, file_data->data() + file_data->size());
+    } else {
+      AssertArraysEqual(*f2, *result->column(1));
+      AssertArraysEqual(*dict_array, *result->column(0));
+    }
+    ASSERT_OK(result->ValidateFull());
+    AssertBatchesEqual(*expected, *result);
+    AssertBatchesEqual(*expected->Slice(10, 20), *result->Slice(10, 20));
+  }
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -1470,6 +1568,175 @@ TEST(TestDictionaryBatch, DictionaryReplacement) {
   ASSERT_BATCHES_EQUAL(*in_batch, *out_batch);
 }
 
+class TestDictionaryDeltas : public ::testing::Test {
+ public:
+  void SetUp() override {
+    type_ = dictionary(int8(), utf8());
+    schema_ = schema({field("f0", type_)});
+    dict1_ = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+    dict2_ = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux"])");
+    options_.emit_dictionary_deltas = true;
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::string& indices,
+                                         const std::shared_ptr<Array>& dictionary) {
+    auto indices_array = ArrayFromJSON(int8(), indices);
+    auto array = std::make_shared<DictionaryArray>(type_, indices_array, dictionary);
+    return RecordBatch::Make(schema_, array->length(), {array});
+  }
+
+  Result<std::shared_ptr<Buffer>> WriteStream(const BatchVector& batches,
+                                              const IpcWriteOptions& options) {
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+    ARROW_ASSIGN_OR_RAISE(auto writer, MakeStreamWriter(sink, schema_, options));
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    return sink->Finish();
+  }
+
+  // Check the isDelta flag of every dictionary batch in the stream
+  void CheckDictionaryDeltaFlags(const std::shared_ptr<Buffer>& stream,
+                                 const std::vector<bool>& expected) {
+    std::vector<bool> flags;
+    io::BufferReader buffer_reader(stream);
+    auto message_reader = MessageReader::Open(&buffer_reader);
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto message, message_reader->ReadNextMessage());
+      if (message == nullptr) {
+        break;
+      }
+      if (message->type() == MessageType::DICTIONARY_BATCH) {
+        const flatbuf::Message* fb_message;
+        ASSERT_OK(internal::VerifyMessage(message->metadata()->data(),
+                                          message->metadata()->size(), &fb_message));
+        flags.push_back(fb_message->header_as_DictionaryBatch()->isDelta());
+      }
+    }
+    ASSERT_EQ(flags, expected);
+  }
+
+  void CheckStreamRoundTrip(const std::shared_ptr<Buffer>& stream,
+                            const BatchVector& batches) {
+    auto buffer_reader = std::make_shared<io::BufferReader>(stream);
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(buffer_reader));
+    BatchVector out_batches;
+    ASSERT_OK(reader->ReadAll(&out_batches));
+    ASSERT_EQ(out_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      AssertBatchesEqual(*batches[i], *out_batches[i]);
+    }
+  }
+
+ protected:
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Array> dict1_, dict2_;
+  IpcWriteOptions options_ = IpcWriteOptions::Defaults();
+};
+
+TEST_F(TestDictionaryDeltas, StreamDeltas) {
+  // The same dictionary contents in a different array are not resent
+  auto dict2_copy = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux"])");
+  BatchVector batches = {MakeBatch("[0, 1, null]", dict1_),
+                         MakeBatch("[2, 3, 0]", dict2_), MakeBatch("[1]", dict2_),
+                         MakeBatch("[3]", dict2_copy)};
+
+  ASSERT_OK_AND_ASSIGN(auto stream, WriteStream(batches, options_));
+  CheckDictionaryDeltaFlags(stream, {false, true});
+  CheckStreamRoundTrip(stream, batches);
+
+  // Without deltas (the default), the whole dictionary is resent
+  ASSERT_OK_AND_ASSIGN(auto replaced_stream,
+                       WriteStream(batches, IpcWriteOptions::Defaults()));
+  CheckDictionaryDeltaFlags(replaced_stream, {false, false});
+  ASSERT_GT(replaced_stream->size(), stream->size());
+  CheckStreamRoundTrip(replaced_stream, batches);
+}
+
+TEST_F(TestDictionaryDeltas, CompressedStream) {
+  // Compressed batches are written after the dictionaries they refer to
+  BatchVector batches = {MakeBatch("[0, 1, null]", dict1_),
+                         MakeBatch("[2, 3, 0]", dict2_), MakeBatch("[1]", dict2_)};
+
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    for (bool use_threads : {false, true}) {
+      for (bool pipeline : {false, true}) {
+        auto options = options_;
+        options.compression = codec;
+        options.use_threads = use_threads;
+        options.pipeline_record_batches = pipeline;
+        ASSERT_OK_AND_ASSIGN(auto stream, WriteStream(batches, options));
+        CheckDictionaryDeltaFlags(stream, {false, true});
+        CheckStreamRoundTrip(stream, batches);
+      }
+    }
+  }
+}
+
+TEST_F(TestDictionaryDeltas, CompressedBatchesWrittenImmediately) {
+  // Unless pipelining is requested, a batch is written out before WriteRecordBatch
+  // returns, so that a peer waiting for it is not blocked
+  auto batch = MakeBatch("[0, 1, null]", dict1_);
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    auto options = IpcWriteOptions::Defaults();
+    options.compression = codec;
+    ASSERT_OK_AND_ASSIGN(auto complete, WriteStream({batch}, options));
+
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink, schema_, options));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    // everything but the 8 byte end of stream marker has been written
+    ASSERT_OK_AND_ASSIGN(int64_t position, sink->Tell());
+    ASSERT_EQ(position, complete->size() - 8);
+    ASSERT_OK(writer->Close());
+  }
+}
+
+TEST_F(TestDictionaryDeltas, StreamReplacement) {
+  // The new dictionary doesn't extend the previous one
+  auto dict3 = ArrayFromJSON(utf8(), R"(["bar", "foo", "baz"])");
+  BatchVector batches = {MakeBatch("[0, 1]", dict1_), MakeBatch("[2, 0]", dict3),
+                         MakeBatch("[2, 3]", dict2_)};
+
+  ASSERT_OK_AND_ASSIGN(auto stream, WriteStream(batches, options_));
+  CheckDictionaryDeltaFlags(stream, {false, false, false});
+  CheckStreamRoundTrip(stream, batches);
+}
+
+TEST_F(TestDictionaryDeltas, FileFormat) {
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, schema_, options_));
+  ASSERT_OK(writer->WriteRecordBatch(*MakeBatch("[0, 1]", dict1_)));
+  auto last_batch = MakeBatch("[3, 2, 0]", dict2_);
+  ASSERT_OK(writer->WriteRecordBatch(*last_batch));
+
+  // Replacing a dictionary is not supported by the file format
+  auto dict3 = ArrayFromJSON(utf8(), R"(["bar"])");
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*MakeBatch("[0]", dict3)));
+
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto buffer_reader = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(buffer_reader));
+  ASSERT_EQ(reader->num_record_batches(), 2);
+  ASSERT_OK_AND_ASSIGN(auto out_batch, reader->ReadRecordBatch(1));
+  AssertBatchesEqual(*last_batch, *out_batch);
+
+  // Without deltas (the default), extending a dictionary is a replacement
+  ASSERT_OK_AND_ASSIGN(sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(writer, MakeFileWriter(sink, schema_));
+  ASSERT_OK(writer->WriteRecordBatch(*MakeBatch("[0, 1]", dict1_)));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*last_batch));
+}
+
 TEST_P(TestStreamFormat, RoundTrip) {
   TestRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
   TestZeroLengthRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
@@ -1552,6 +1819,23 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+TEST(TestIpcFileFormat, FooterMetaDataChangedBeforeClose) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  // The footer metadata is serialized on Close(), so it may describe the batches
+  auto metadata = key_value_metadata({"ARROW:example"}, {"something something"});
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults(), metadata));
+  ASSERT_OK(helper.WriteBatch(batch));
+  metadata->Append("ARROW:example:num_rows", std::to_string(batch->num_rows()));
+  ASSERT_OK(helper.Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto out_metadata, helper.ReadFooterMetadata());
+  ASSERT_TRUE(out_metadata->Equals(*metadata));
+  ASSERT_EQ(out_metadata->size(), 2);
+}
+
 // This test uses uninitialized memory
 
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
@@ -117,6 +117,17 @@ class ArrayLoader {
         file_(file),
         max_recursion_depth_(options.max_recursion_depth) {}
 
+  /// Read buffers directly from a message body spanning `body_length` bytes
+  /// at `body_offset` in `file`, rather than from a body-sized file
+  explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
+                       MetadataVersion metadata_version, const IpcReadOptions& options,
+                       io::RandomAccessFile* file, int64_t body_offset,
+                       int64_t body_length)
+      : ArrayLoader(metadata, metadata_version, options, file) {
+    body_offset_ = body_offset;
+    body_length_ = body_length;
+  }
+
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
     if (skip_io_) {
       return Status::OK();
@@ -132,7 +143,11 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
-    return file_->ReadAt(offset, length).Value(out);
+    if (body_length_ >= 0 && length > body_length_ - offset) {
+      return Status::Invalid("Buffer ", buffer_index_, " exceeds message body length ",
+                             body_length_);
+    }
+    return file_->ReadAt(body_offset_ + offset, length).Value(out);
   }
 
   Status LoadType(const DataType& type) { return VisitTypeInline(type, this); }
@@ -356,6 +371,9 @@ class ArrayLoader {
   const flatbuf::RecordBatch* metadata_;
   const MetadataVersion metadata_version_;
   io::RandomAccessFile* file_;
+  int64_t body_offset_ = 0;
+  // Negative if unbounded
+  int64_t body_length_ = -1;
   int max_recursion_depth_;
   int buffer_index_ = 0;
   int field_index_ = 0;
@@ -381,6 +399,10 @@ Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>&
   const uint8_t* data = buf->data();
   int64_t compressed_size = buf->size() - sizeof(int64_t);
   int64_t uncompressed_size = BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+  if (uncompressed_size == -1) {
+    // The buffer was left uncompressed by the writer
+    return SliceBuffer(buf, sizeof(int64_t), compressed_size);
+  }
 
   ARROW_ASSIGN_OR_RAISE(auto uncompressed,
                         AllocateBuffer(uncompressed_size, options.memory_pool));
@@ -437,10 +459,8 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>* inclusion_mask, const DictionaryMemo* dictionary_memo,
-    const IpcReadOptions& options, MetadataVersion metadata_version,
-    Compression::type compression, io::RandomAccessFile* file) {
-  ArrayLoader loader(metadata, metadata_version, options, file);
-
+    const IpcReadOptions& options, Compression::type compression,
+    ArrayLoader* loader) {
   ArrayDataVector columns(schema->num_fields());
   ArrayDataVector filtered_columns;
   FieldVector filtered_fields;
@@ -451,7 +471,7 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     if (!inclusion_mask || (*inclusion_mask)[i]) {
       // Read field
       auto column = std::make_shared<ArrayData>();
-      RETURN_NOT_OK(loader.Load(&field, column.get()));
+      RETURN_NOT_OK(loader->Load(&field, column.get()));
       if (metadata->length() != column->length) {
         return Status::IOError("Array length did not match record batch length");
       }
@@ -463,7 +483,7 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     } else {
       // Skip field. This logic must be executed to advance the state of the
       // loader to the next field
-      RETURN_NOT_OK(loader.SkipField(&field));
+      RETURN_NOT_OK(loader->SkipField(&field));
     }
   }
 
@@ -489,14 +509,14 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
-    const IpcReadOptions& options, MetadataVersion metadata_version,
-    Compression::type compression, io::RandomAccessFile* file) {
+    const IpcReadOptions& options, Compression::type compression,
+    ArrayLoader* loader) {
   if (inclusion_mask.size() > 0) {
     return LoadRecordBatchSubset(metadata, schema, &inclusion_mask, dictionary_memo,
-                                 options, metadata_version, compression, file);
+                                 options, compression, loader);
   } else {
     return LoadRecordBatchSubset(metadata, schema, nullptr, dictionary_memo, options,
-                                 metadata_version, compression, file);
+                                 compression, loader);
   }
 }
 
@@ -571,29 +591,57 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
                          reader.get());
 }
 
-Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
-    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-    const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
-    const IpcReadOptions& options, io::RandomAccessFile* file) {
-  const flatbuf::Message* message = nullptr;
-  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
-  auto batch = message->header_as_RecordBatch();
-  if (batch == nullptr) {
+Status GetRecordBatchMetadata(const Buffer& metadata, const flatbuf::Message** message,
+                              const flatbuf::RecordBatch** batch,
+                              Compression::type* compression) {
+  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), message));
+  *batch = (*message)->header_as_RecordBatch();
+  if (*batch == nullptr) {
     return Status::IOError(
         "Header-type of flatbuffer-encoded Message is not RecordBatch.");
   }
 
-  Compression::type compression;
-  RETURN_NOT_OK(GetCompression(batch, &compression));
-  if (compression == Compression::UNCOMPRESSED &&
-      message->version() == flatbuf::MetadataVersion::V4) {
+  RETURN_NOT_OK(GetCompression(*batch, compression));
+  if (*compression == Compression::UNCOMPRESSED &&
+      (*message)->version() == flatbuf::MetadataVersion::V4) {
     // Possibly obtain codec information from experimental serialization format
     // in 0.17.x
-    RETURN_NOT_OK(GetCompressionExperimental(message, &compression));
+    RETURN_NOT_OK(GetCompressionExperimental(*message, compression));
   }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
+    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+    const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
+    const IpcReadOptions& options, io::RandomAccessFile* file) {
+  const flatbuf::Message* message = nullptr;
+  const flatbuf::RecordBatch* batch = nullptr;
+  Compression::type compression;
+  RETURN_NOT_OK(GetRecordBatchMetadata(metadata, &message, &batch, &compression));
+
+  ArrayLoader loader(batch, internal::GetMetadataVersion(message->version()), options,
+                     file);
+  return LoadRecordBatch(batch, schema, inclusion_mask, dictionary_memo, options,
+                         compression, &loader);
+}
+
+// Read a record batch whose body spans `body_length` bytes at `body_offset` in
+// `file`.  Only the selected fields' buffers are read (and decompressed).
+Result<std::shared_ptr<RecordBatch>> ReadRecordBatchLazily(
+    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+    const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
+    const IpcReadOptions& options, io::RandomAccessFile* file, int64_t body_offset,
+    int64_t body_length) {
+  const flatbuf::Message* message = nullptr;
+  const flatbuf::RecordBatch* batch = nullptr;
+  Compression::type compression;
+  RETURN_NOT_OK(GetRecordBatchMetadata(metadata, &message, &batch, &compression));
+
+  ArrayLoader loader(batch, internal::GetMetadataVersion(message->version()), options,
+                     file, body_offset, body_length);
   return LoadRecordBatch(batch, schema, inclusion_mask, dictionary_memo, options,
-                         internal::GetMetadataVersion(message->version()), compression,
-                         file);
+                         compression, &loader);
 }
 
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
@@ -885,6 +933,15 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     }
 
     std::unique_ptr<Message> message;
+    if (options_.lazy && file_->supports_zero_copy()) {
+      const FileBlock block = GetRecordBatchBlock(i);
+      RETURN_NOT_OK(ReadMessageMetadataFromBlock(block, &message));
+      CHECK_MESSAGE_TYPE(MessageType::RECORD_BATCH, message->type());
+      return ReadRecordBatchLazily(*message->metadata(), schema_, field_inclusion_mask_,
+                                   &dictionary_memo_, options_, file_,
+                                   block.offset + block.metadata_length,
+                                   message->body_length());
+    }
     RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
 
     CHECK_HAS_BODY(*message);
@@ -924,12 +981,17 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
-  Status ReadMessageFromBlock(const FileBlock& block, std::unique_ptr<Message>* out) {
+  static Status CheckAligned(const FileBlock& block) {
     if (!BitUtil::IsMultipleOf8(block.offset) ||
         !BitUtil::IsMultipleOf8(block.metadata_length) ||
         !BitUtil::IsMultipleOf8(block.body_length)) {
       return Status::Invalid("Unaligned block in IPC file");
     }
+    return Status::OK();
+  }
+
+  Status ReadMessageFromBlock(const FileBlock& block, std::unique_ptr<Message>* out) {
+    RETURN_NOT_OK(CheckAligned(block));
 
     // TODO(wesm): this breaks integration tests, see ARROW-3256
     // DCHECK_EQ((*out)->body_length(), block.body_length);
@@ -937,6 +999,35 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return ReadMessage(block.offset, block.metadata_length, file_).Value(out);
   }
 
+  // Like ReadMessageFromBlock, but leave the message body unread
+  Status ReadMessageMetadataFromBlock(const FileBlock& block,
+                                      std::unique_ptr<Message>* out) {
+    RETURN_NOT_OK(CheckAligned(block));
+
+    ARROW_ASSIGN_OR_RAISE(auto buffer,
+                          file_->ReadAt(block.offset, block.metadata_length));
+    // The metadata is prefixed by its length, which is itself preceded by a
+    // continuation token except in pre-0.15.0 files
+    int64_t prefix_length = sizeof(int32_t);
+    int32_t flatbuffer_length = -1;
+    if (buffer->size() >= prefix_length) {
+      flatbuffer_length = BitUtil::FromLittleEndian(
+          util::SafeLoadAs<int32_t>(buffer->data()));
+    }
+    if (flatbuffer_length == internal::kIpcContinuationToken &&
+        buffer->size() >= 2 * prefix_length) {
+      flatbuffer_length = BitUtil::FromLittleEndian(
+          util::SafeLoadAs<int32_t>(buffer->data() + prefix_length));
+      prefix_length *= 2;
+    }
+    if (flatbuffer_length <= 0 || flatbuffer_length > buffer->size() - prefix_length) {
+      return Status::Invalid("Invalid metadata in IPC file block at offset ",
+                             block.offset);
+    }
+    return Message::Open(SliceBuffer(buffer, prefix_length, flatbuffer_length), nullptr)
+        .Value(out);
+  }
+
   Status ReadDictionaries() {
     // Read all the dictionaries
     for (int i = 0; i < num_dictionaries(); ++i) {
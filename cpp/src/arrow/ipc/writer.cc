@@ -24,6 +24,7 @@
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -51,7 +52,9 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -102,6 +105,43 @@ Status GetTruncatedBuffer(int64_t offset, int64_t length, int32_t byte_width,
   return Status::OK();
 }
 
+// Convert buffer to uncompressed-length-prefixed compressed buffer, or to a
+// -1-prefixed copy of the buffer if compression saves too little space
+Result<std::shared_ptr<Buffer>> CompressBuffer(const Buffer& buffer, util::Codec* codec,
+                                               util::optional<double> min_space_savings) {
+  int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
+  ARROW_ASSIGN_OR_RAISE(auto result, AllocateBuffer(maximum_length + sizeof(int64_t)));
+
+  int64_t actual_length;
+  ARROW_ASSIGN_OR_RAISE(actual_length,
+                        codec->Compress(buffer.size(), buffer.data(), maximum_length,
+                                        result->mutable_data() + sizeof(int64_t)));
+  if (min_space_savings.has_value() &&
+      1.0 - static_cast<double>(actual_length) / static_cast<double>(buffer.size()) <
+          *min_space_savings) {
+    ARROW_ASSIGN_OR_RAISE(result, AllocateBuffer(buffer.size() + sizeof(int64_t)));
+    *reinterpret_cast<int64_t*>(result->mutable_data()) =
+        BitUtil::ToLittleEndian(static_cast<int64_t>(-1));
+    std::memcpy(result->mutable_data() + sizeof(int64_t), buffer.data(),
+                static_cast<size_t>(buffer.size()));
+    return std::move(result);
+  }
+  *reinterpret_cast<int64_t*>(result->mutable_data()) =
+      BitUtil::ToLittleEndian(buffer.size());
+  return SliceBuffer(std::move(result), /*offset=*/0, actual_length + sizeof(int64_t));
+}
+
+Result<std::unique_ptr<util::Codec>> MakeCompressionCodec(
+    const IpcWriteOptions& options) {
+  RETURN_NOT_OK(internal::CheckCompressionSupported(options.compression));
+  if (options.min_space_savings.has_value() &&
+      !(*options.min_space_savings >= 0 && *options.min_space_savings <= 1)) {
+    return Status::Invalid("min_space_savings must be between 0 and 1, got ",
+                           *options.min_space_savings);
+  }
+  return util::Codec::Create(options.compression, options.compression_level);
+}
+
 static inline bool NeedTruncate(int64_t offset, const Buffer* buffer,
                                 int64_t min_length) {
   // buffer can be NULL
@@ -167,34 +207,14 @@ class RecordBatchSerializer {
     custom_metadata_->Append(key, value);
   }
 
-  Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
-                        std::shared_ptr<Buffer>* out) {
-    // Convert buffer to uncompressed-length-prefixed compressed buffer
-    int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
-    ARROW_ASSIGN_OR_RAISE(auto result, AllocateBuffer(maximum_length + sizeof(int64_t)));
-
-    int64_t actual_length;
-    ARROW_ASSIGN_OR_RAISE(actual_length,
-                          codec->Compress(buffer.size(), buffer.data(), maximum_length,
-                                          result->mutable_data() + sizeof(int64_t)));
-    *reinterpret_cast<int64_t*>(result->mutable_data()) =
-        BitUtil::ToLittleEndian(buffer.size());
-    *out = SliceBuffer(std::move(result), /*offset=*/0, actual_length + sizeof(int64_t));
-    return Status::OK();
-  }
-
   Status CompressBodyBuffers() {
-    std::unique_ptr<util::Codec> codec;
-
-    RETURN_NOT_OK(internal::CheckCompressionSupported(options_.compression));
-
-    ARROW_ASSIGN_OR_RAISE(
-        codec, util::Codec::Create(options_.compression, options_.compression_level));
+    ARROW_ASSIGN_OR_RAISE(auto codec, MakeCompressionCodec(options_));
 
     auto CompressOne = [&](size_t i) {
       if (out_->body_buffers[i]->size() > 0) {
-        RETURN_NOT_OK(
-            CompressBuffer(*out_->body_buffers[i], codec.get(), &out_->body_buffers[i]));
+        ARROW_ASSIGN_OR_RAISE(out_->body_buffers[i],
+                              CompressBuffer(*out_->body_buffers[i], codec.get(),
+                                             options_.min_space_savings));
       }
       return Status::OK();
     };
@@ -203,7 +223,38 @@ class RecordBatchSerializer {
         options_.use_threads, static_cast<int>(out_->body_buffers.size()), CompressOne);
   }
 
+  /// \brief Launch compression of the body buffers on the CPU thread pool
+  ///
+  /// The returned futures must be waited for before FinishAssemble() is called.
+  Result<std::vector<Future<Status>>> CompressBodyBuffersAsync() {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<util::Codec> codec,
+                          MakeCompressionCodec(options_));
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    std::vector<Future<Status>> futures;
+    for (auto& buffer : out_->body_buffers) {
+      if (buffer->size() == 0) {
+        continue;
+      }
+      std::shared_ptr<Buffer>* slot = &buffer;
+      auto min_space_savings = options_.min_space_savings;
+      ARROW_ASSIGN_OR_RAISE(auto future, pool->Submit([slot, codec, min_space_savings] {
+        return CompressBuffer(**slot, codec.get(), min_space_savings).Value(slot);
+      }));
+      futures.push_back(std::move(future));
+    }
+    return std::move(futures);
+  }
+
   Status Assemble(const RecordBatch& batch) {
+    RETURN_NOT_OK(AssembleBodyBuffers(batch));
+    if (options_.compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+    return FinishAssemble(batch.num_rows());
+  }
+
+  /// \brief Collect the field nodes and uncompressed body buffers of `batch`
+  Status AssembleBodyBuffers(const RecordBatch& batch) {
     if (field_nodes_.size() > 0) {
       field_nodes_.clear();
       buffer_meta_.clear();
@@ -214,11 +265,11 @@ class RecordBatchSerializer {
     for (int i = 0; i < batch.num_columns(); ++i) {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
+    return Status::OK();
+  }
 
-    if (options_.compression != Compression::UNCOMPRESSED) {
-      RETURN_NOT_OK(CompressBodyBuffers());
-    }
-
+  /// \brief Lay out the final body buffers and serialize the metadata
+  Status FinishAssemble(int64_t num_rows) {
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -249,7 +300,7 @@ class RecordBatchSerializer {
     //
     // Note: The memory written here is prefixed by the size of the flatbuffer
     // itself as an int32_t.
-    return SerializeMetadata(batch.num_rows());
+    return SerializeMetadata(num_rows);
   }
 
   template <typename ArrayType>
@@ -958,20 +1009,60 @@ IpcPayloadWriter::~IpcPayloadWriter() {}
 
 Status IpcPayloadWriter::Start() { return Status::OK(); }
 
+namespace {
+
+bool HasNestedDictionary(const ArrayData& data) {
+  if (data.type->id() == Type::DICTIONARY) {
+    return true;
+  }
+  for (const auto& child : data.child_data) {
+    if (HasNestedDictionary(*child)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Whether the first values of `array` are equal to `prefix`
+bool StartsWith(const Array& array, const Array& prefix) {
+  const ArrayData& data = *array.data();
+  const ArrayData& prefix_data = *prefix.data();
+  // Fast path: a longer view over the same memory, such as successive slices
+  // of a growing dictionary
+  bool same_memory = data.offset == prefix_data.offset && data.child_data.empty() &&
+                     prefix_data.child_data.empty() &&
+                     data.buffers.size() == prefix_data.buffers.size();
+  for (size_t i = 0; same_memory && i < data.buffers.size(); ++i) {
+    const auto& buffer = data.buffers[i];
+    const auto& prefix_buffer = prefix_data.buffers[i];
+    if (buffer == nullptr || prefix_buffer == nullptr) {
+      same_memory = buffer == prefix_buffer;
+    } else {
+      same_memory = buffer->data() == prefix_buffer->data();
+    }
+  }
+  return same_memory || array.RangeEquals(prefix, 0, prefix.length(), 0);
+}
+
+}  // namespace
+
 class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
  public:
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
-                  const Schema& schema, const IpcWriteOptions& options)
+                  const Schema& schema, const IpcWriteOptions& options,
+                  bool is_file_format = false)
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
         mapper_(schema),
+        is_file_format_(is_file_format),
         options_(options) {}
 
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
-                  const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options) {
+                  const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
+                  bool is_file_format = false)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format) {
     shared_schema_ = schema;
   }
 
@@ -982,13 +1073,20 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(CheckStarted());
 
-    if (!wrote_dictionaries_) {
+    if (options_.compression != Compression::UNCOMPRESSED && options_.use_threads &&
+        options_.pipeline_record_batches) {
+      // Compress this batch in the background while the previous one is written
+      auto pending = std::make_shared<PendingBatch>(options_, batch.num_rows());
+      RETURN_NOT_OK(pending->serializer.AssembleBodyBuffers(batch));
+      ARROW_ASSIGN_OR_RAISE(pending->compressed,
+                            pending->serializer.CompressBodyBuffersAsync());
+      RETURN_NOT_OK(WritePendingBatch());
       RETURN_NOT_OK(WriteDictionaries(batch));
-      wrote_dictionaries_ = true;
+      pending_batch_ = std::move(pending);
+      return Status::OK();
     }
 
-    // TODO: Check for delta dictionaries. Can we scan for deltas while computing
-    // the RecordBatch payload to save time?
+    RETURN_NOT_OK(WriteDictionaries(batch));
 
     IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, &payload));
@@ -997,6 +1095,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
   Status Close() override {
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(WritePendingBatch());
     return payload_writer_->Close();
   }
 
@@ -1017,26 +1116,107 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Write the dictionaries of `batch` that differ from the last ones written
   Status WriteDictionaries(const RecordBatch& batch) {
     ARROW_ASSIGN_OR_RAISE(const auto dictionaries, CollectDictionaries(batch, mapper_));
 
     for (const auto& pair : dictionaries) {
-      IpcPayload payload;
       int64_t dictionary_id = pair.first;
       const auto& dictionary = pair.second;
 
-      RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, dictionary, options_, &payload));
-      RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      auto it = last_dictionaries_.find(dictionary_id);
+      if (it == last_dictionaries_.end()) {
+        RETURN_NOT_OK(WriteDictionary(dictionary_id, /*is_delta=*/false, dictionary));
+        last_dictionaries_.emplace(dictionary_id, dictionary);
+        continue;
+      }
+
+      const auto& last_dictionary = it->second;
+      if (dictionary->data() == last_dictionary->data()) {
+        continue;
+      }
+      const int64_t last_length = last_dictionary->length();
+      const int64_t length = dictionary->length();
+      // Only compare the dictionaries if the new one can be skipped or sent
+      // as a delta
+      const bool can_extend_last =
+          length == last_length ||
+          (length > last_length && options_.emit_dictionary_deltas &&
+           !HasNestedDictionary(*dictionary->data()));
+      const bool extends_last =
+          can_extend_last && StartsWith(*dictionary, *last_dictionary);
+
+      if (extends_last && length == last_length) {
+        // Unchanged
+      } else if (extends_last) {
+        // Only send the new entries; slicing is zero-copy
+        RETURN_NOT_OK(WriteDictionary(dictionary_id, /*is_delta=*/true,
+                                      dictionary->Slice(last_length)));
+      } else if (is_file_format_) {
+        return Status::Invalid(
+            "Dictionary replacement detected when writing IPC file format. "
+            "Arrow IPC files only support a single non-delta dictionary for "
+            "a given field across all batches.");
+      } else {
+        RETURN_NOT_OK(WriteDictionary(dictionary_id, /*is_delta=*/false, dictionary));
+      }
+      it->second = dictionary;
     }
     return Status::OK();
   }
 
+  Status WriteDictionary(int64_t dictionary_id, bool is_delta,
+                         const std::shared_ptr<Array>& dictionary) {
+    IpcPayload payload;
+    RETURN_NOT_OK(
+        GetDictionaryPayload(dictionary_id, is_delta, dictionary, options_, &payload));
+    return payload_writer_->WritePayload(payload);
+  }
+
+  // A record batch whose body buffers are being compressed on the CPU thread pool
+  struct PendingBatch {
+    PendingBatch(const IpcWriteOptions& options, int64_t num_rows)
+        : serializer(/*buffer_start_offset=*/0, options, &payload), num_rows(num_rows) {
+      payload.type = MessageType::RECORD_BATCH;
+    }
+
+    ~PendingBatch() {
+      // The compression tasks write to the payload's body buffers
+      for (const auto& future : compressed) {
+        future.Wait();
+      }
+    }
+
+    IpcPayload payload;
+    RecordBatchSerializer serializer;
+    int64_t num_rows;
+    std::vector<Future<Status>> compressed;
+  };
+
+  Status WritePendingBatch() {
+    if (pending_batch_ == nullptr) {
+      return Status::OK();
+    }
+    auto pending = std::move(pending_batch_);
+    Status st;
+    for (const auto& future : pending->compressed) {
+      st &= future.status();
+    }
+    RETURN_NOT_OK(st);
+    RETURN_NOT_OK(pending->serializer.FinishAssemble(pending->num_rows));
+    return payload_writer_->WritePayload(pending->payload);
+  }
+
   std::unique_ptr<IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
   const DictionaryFieldMapper mapper_;
+  const bool is_file_format_;
   bool started_ = false;
-  bool wrote_dictionaries_ = false;
+  // The dictionaries the reader will have after what was written so far
+  std::unordered_map<int64_t, std::shared_ptr<Array>> last_dictionaries_;
+  // The last record batch written, if still being compressed
+  std::shared_ptr<PendingBatch> pending_batch_;
   IpcWriteOptions options_;
 };
 
@@ -1202,6 +1382,8 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
 
  protected:
   std::shared_ptr<Schema> schema_;
+  // Not copied: changes made by the caller until Close() are written (see
+  // MakeFileWriter)
   std::shared_ptr<const KeyValueMetadata> metadata_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
@@ -1239,7 +1421,7 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
                                                                   metadata, sink),
-      schema, options);
+      schema, options, /*is_file_format=*/true);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
@@ -1249,7 +1431,7 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(
           options, schema, metadata, std::move(sink)),
-      schema, options);
+      schema, options, /*is_file_format=*/true);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
@@ -124,7 +124,9 @@ Result<std::shared_ptr<RecordBatchWriter>> NewStreamWriter(
 /// \param[in] sink output stream to write to
 /// \param[in] schema the schema of the record batches to be written
 /// \param[in] options options for serialization, optional
-/// \param[in] metadata custom metadata for File Footer, optional
+/// \param[in] metadata custom metadata for File Footer, optional. It is serialized
+/// when the writer is closed, so changes made to it until then (for example to
+/// describe the written batches) are part of the footer.
 /// \return Result<std::shared_ptr<RecordBatchWriter>>
 ARROW_EXPORT
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
@@ -137,7 +139,9 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
 /// \param[in] sink output stream to write to
 /// \param[in] schema the schema of the record batches to be written
 /// \param[in] options options for serialization, optional
-/// \param[in] metadata custom metadata for File Footer, optional
+/// \param[in] metadata custom metadata for File Footer, optional. It is serialized
+/// when the writer is closed, so changes made to it until then (for example to
+/// describe the written batches) are part of the footer.
 /// \return Result<std::shared_ptr<RecordBatchWriter>>
 ARROW_EXPORT
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
@@ -404,7 +408,8 @@ Result<std::unique_ptr<IpcPayloadWriter>> MakePayloadStreamWriter(
 /// \param[in] sink output stream to write to
 /// \param[in] schema the schema of the record batches to be written
 /// \param[in] options options for serialization, optional
-/// \param[in] metadata custom metadata for File Footer, optional
+/// \param[in] metadata custom metadata for File Footer, optional. It is serialized
+/// when the writer is closed, as with MakeFileWriter().
 /// \return Status
 ARROW_EXPORT
 Result<std::unique_ptr<IpcPayloadWriter>> MakePayloadFileWriter(
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -29,6 +31,7 @@
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
@@ -45,6 +48,55 @@ using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+// The initial conversion type, before any field is inferred
+std::shared_ptr<DataType> InitialType(const ParseOptions& parse_options) {
+  return parse_options.explicit_schema ? struct_(parse_options.explicit_schema->fields())
+                                       : struct_({});
+}
+
+const PromotionGraph* PromotionGraphFor(const ParseOptions& parse_options) {
+  return parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+             ? GetPromotionGraph()
+             : nullptr;
+}
+
+// Parse a block made of an object straddling from the previous block
+// (`partial` + `completion`) and the whole objects following it
+Result<std::shared_ptr<Array>> ParseBlock(MemoryPool* pool,
+                                          const ParseOptions& parse_options,
+                                          const std::shared_ptr<Buffer>& partial,
+                                          const std::shared_ptr<Buffer>& completion,
+                                          const std::shared_ptr<Buffer>& whole) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling, ConcatenateBuffers({partial, completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -113,56 +165,217 @@ class TableReaderImpl : public TableReader,
 
  private:
   Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
-
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
-
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
+    return MakeChunkedArrayBuilder(task_group_, pool_, PromotionGraphFor(parse_options_),
+                                   InitialType(parse_options_), &builder_);
   }
 
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(straddling,
-                              ConcatenateBuffers({partial, completion}, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto parsed,
+                          ParseBlock(pool_, parse_options_, partial, completion, whole));
+    builder_->Insert(block_index, field("", parsed->type()), parsed);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<TaskGroup> task_group_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<ChunkedArrayBuilder> builder_;
+};
+
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        chunker_(MakeChunker(parse_options_)),
+        thread_pool_(thread_pool) {}
+
+  ~StreamingReaderImpl() override {
+    // Make sure no pending task refers to this reader anymore
+    for (const auto& batch : pending_batches_) {
+      batch.Wait();
+    }
+  }
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    // Convert up to one block per thread ahead of the consumer
+    readahead_ = thread_pool_ != nullptr ? std::max(thread_pool_->GetCapacity(), 1) : 1;
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          MakeReadaheadIterator(std::move(it), readahead_));
+
+    ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    if (block_ == nullptr) {
+      return Status::Invalid("Empty JSON file");
+    }
+    partial_ = std::make_shared<Buffer>("");
+    return ReadFirstBatch();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    out->reset();
+    if (first_batch_ != nullptr) {
+      *out = std::move(first_batch_);
+      return Status::OK();
+    }
+    while (!eof_) {
+      Status st = LaunchBlocks();
+      if (!st.ok()) {
+        // Read or chunking error => bail out
+        eof_ = true;
+        return st;
+      }
+      if (pending_batches_.empty()) {
+        eof_ = true;
+        break;
+      }
+      auto maybe_batch = std::move(pending_batches_.front()).result();
+      pending_batches_.pop_front();
+      if (!maybe_batch.ok()) {
+        // Parse or conversion error => bail out
+        eof_ = true;
+        return maybe_batch.status();
+      }
+      // Skip blocks without any object (e.g. only whitespace)
+      if ((*maybe_batch)->num_rows() > 0) {
+        *out = std::move(maybe_batch).ValueOrDie();
+        break;
       }
-      RETURN_NOT_OK(parser->Parse(straddling));
     }
+    return Status::OK();
+  }
 
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
+ private:
+  struct Block {
+    std::shared_ptr<Buffer> partial, completion, whole;
+  };
+
+  // Cut the next block of objects off the input; return false at end of input
+  Result<bool> NextBlock(Block* out) {
+    if (block_ == nullptr) {
+      return false;
+    }
+    std::shared_ptr<Buffer> next_block, next_partial;
+    ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+
+    out->partial = std::move(partial_);
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(
+          chunker_->ProcessFinal(out->partial, block_, &out->completion, &out->whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(out->partial, block_, &out->completion,
+                                                 &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &out->whole, &next_partial));
     }
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return true;
+  }
 
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
-    builder_->Insert(block_index, field("", parsed->type()), parsed);
+  // Infer the schema from the first non-empty block, then fix it for the
+  // following blocks
+  Status ReadFirstBatch() {
+    auto type = InitialType(parse_options_);
+    Block block;
+    while (first_batch_ == nullptr || first_batch_->num_rows() == 0) {
+      ARROW_ASSIGN_OR_RAISE(bool has_block, NextBlock(&block));
+      if (!has_block) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool_, parse_options_, block.partial,
+                                                    block.completion, block.whole));
+      ARROW_ASSIGN_OR_RAISE(first_batch_, ConvertBlock(PromotionGraphFor(parse_options_),
+                                                       type, parsed));
+    }
+    DCHECK_NE(first_batch_, nullptr);
+    schema_ = first_batch_->schema();
+    if (first_batch_->num_rows() == 0) {
+      first_batch_.reset();
+    }
+
+    block_parse_options_ = parse_options_;
+    block_parse_options_.explicit_schema = schema_;
+    if (parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      block_parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    block_type_ = struct_(schema_->fields());
     return Status::OK();
   }
 
+  // Launch conversion of blocks until `readahead_` of them are pending
+  Status LaunchBlocks() {
+    while (static_cast<int>(pending_batches_.size()) < readahead_) {
+      Block block;
+      ARROW_ASSIGN_OR_RAISE(bool has_block, NextBlock(&block));
+      if (!has_block) {
+        break;
+      }
+      if (thread_pool_ == nullptr) {
+        pending_batches_.push_back(
+            Future<std::shared_ptr<RecordBatch>>::MakeFinished(ProcessBlock(block)));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto batch, thread_pool_->Submit([this, block] {
+          return ProcessBlock(block);
+        }));
+        pending_batches_.push_back(std::move(batch));
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> ProcessBlock(const Block& block) {
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool_, block_parse_options_,
+                                                  block.partial, block.completion,
+                                                  block.whole));
+    return ConvertBlock(/*promotion_graph=*/nullptr, block_type_, parsed);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> ConvertBlock(
+      const PromotionGraph* promotion_graph, const std::shared_ptr<DataType>& type,
+      const std::shared_ptr<Array>& parsed) {
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool_,
+                                          promotion_graph, type, &builder));
+    builder->Insert(0, field("", parsed->type()), parsed);
+    std::shared_ptr<ChunkedArray> converted;
+    RETURN_NOT_OK(builder->Finish(&converted));
+    return RecordBatch::FromStructArray(converted->chunk(0));
+  }
+
   MemoryPool* pool_;
   ReadOptions read_options_;
   ParseOptions parse_options_;
   std::unique_ptr<Chunker> chunker_;
-  std::shared_ptr<TaskGroup> task_group_;
+  ThreadPool* thread_pool_;
+  int readahead_ = 1;
+
   Iterator<std::shared_ptr<Buffer>> block_iterator_;
-  std::shared_ptr<ChunkedArrayBuilder> builder_;
+  // The current input block and the partial object left from the previous one
+  std::shared_ptr<Buffer> block_, partial_;
+  bool eof_ = false;
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> first_batch_;
+  // Options and conversion type for the blocks following the first one
+  ParseOptions block_parse_options_;
+  std::shared_ptr<DataType> block_type_;
+  // Conversion results of launched blocks, in file order
+  std::deque<Future<std::shared_ptr<RecordBatch>>> pending_batches_;
 };
 
 Status TableReader::Read(std::shared_ptr<Table>* out) { return Read().Value(out); }
@@ -189,6 +402,16 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return TableReader::Make(pool, input, read_options, parse_options).Value(out);
 }
 
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto ptr = std::make_shared<StreamingReaderImpl>(
+      pool, read_options, parse_options,
+      read_options.use_threads ? GetCpuThreadPool() : nullptr);
+  RETURN_NOT_OK(ptr->Init(std::move(input)));
+  return ptr;
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
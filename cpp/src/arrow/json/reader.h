@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -65,6 +66,29 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// A class that reads a JSON file incrementally, one block at a time
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// The schema is inferred from the first non-empty block (completing
+/// ParseOptions::explicit_schema, if given) and then fixed: later blocks are
+/// converted to that schema, and fields missing from it are an error unless
+/// ParseOptions::unexpected_field_behavior is Ignore.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// The first block is read and converted before this returns, so as to
+  /// determine the schema.  If ReadOptions::use_threads is true, later blocks
+  /// are parsed and converted in parallel on the CPU thread pool, up to one
+  /// block per thread ahead of the consumer.  Batches are always yielded in
+  /// file order.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
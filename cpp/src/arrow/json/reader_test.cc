@@ -284,5 +284,134 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUpReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    ASSERT_OK(MakeStream(input, &input_));
+    ASSERT_OK_AND_ASSIGN(reader_, StreamingReader::Make(default_memory_pool(), input_,
+                                                        read_options_, parse_options_));
+  }
+
+  void ReadAll(RecordBatchVector* out) {
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader_->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ASSERT_OK(batch->ValidateFull());
+      AssertSchemaEqual(*reader_->schema(), *batch->schema());
+      out->push_back(batch);
+    }
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<io::InputStream> input_;
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) {
+  read_options_.use_threads = GetParam();
+  ASSERT_OK(MakeStream("", &input_));
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), input_,
+                                               read_options_, parse_options_));
+}
+
+TEST_P(StreamingReaderTest, Basics) {
+  SetUpReader(scalars_only_src());
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  AssertSchemaEqual(*schema, *reader_->schema());
+
+  RecordBatchVector batches;
+  ASSERT_NO_FATAL_FAILURE(ReadAll(&batches));
+  ASSERT_EQ(batches.size(), 1);
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(schema,
+                           "[[3.5, false, \"thing\"], [3.25, null, null], "
+                           "[3.125, null, \"\xe5\xbf\x8d\"], [0.0, true, null]]"),
+      *batches[0]);
+}
+
+TEST_P(StreamingReaderTest, MultipleChunks) {
+  auto src = scalars_only_src();
+  read_options_.block_size = static_cast<int>(src.length() / 3);
+  SetUpReader(src);
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  AssertSchemaEqual(*schema, *reader_->schema());
+
+  // The trailing whitespace-only block yields no batch
+  RecordBatchVector batches;
+  ASSERT_NO_FATAL_FAILURE(ReadAll(&batches));
+  ASSERT_EQ(batches.size(), 3);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([[3.5, false, "thing"]])"),
+                     *batches[0]);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([[3.25, null, null]])"),
+                     *batches[1]);
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(schema,
+                           "[[3.125, null, \"\xe5\xbf\x8d\"], [0.0, true, null]]"),
+      *batches[2]);
+}
+
+TEST_P(StreamingReaderTest, ManyBlocks) {
+  int64_t count = 1 << 10;
+  std::string json;
+  for (int i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + ", \"b\":\"" + std::to_string(i) + "\"}\n";
+  }
+  read_options_.block_size = 256;
+  SetUpReader(json);
+
+  RecordBatchVector batches;
+  ASSERT_NO_FATAL_FAILURE(ReadAll(&batches));
+  ASSERT_GT(batches.size(), 10);
+  int64_t expected = 0;
+  for (const auto& batch : batches) {
+    ASSERT_EQ(batch->column(0)->type_id(), Type::INT64);
+    const auto& a = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < a.length(); ++i) {
+      ASSERT_EQ(a.Value(i), expected) << " at index " << i;
+      ++expected;
+    }
+  }
+  ASSERT_EQ(expected, count);
+}
+
+TEST_P(StreamingReaderTest, FixedSchema) {
+  // "b" only appears after the first block, which fixes the schema
+  std::string src = "{\"a\": 1}\n{\"a\": 2}\n{\"a\": 3, \"b\": true}\n";
+  read_options_.block_size = 16;
+
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  SetUpReader(src);
+  AssertSchemaEqual(*::arrow::schema({field("a", int64())}), *reader_->schema());
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  do {
+    st = reader_->ReadNext(&batch);
+  } while (st.ok() && batch != nullptr);
+  ASSERT_RAISES(Invalid, st);
+  // The reader is exhausted after an error
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+
+  parse_options_.explicit_schema = ::arrow::schema({field("a", int32())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  SetUpReader(src);
+  RecordBatchVector batches;
+  ASSERT_NO_FATAL_FAILURE(ReadAll(&batches));
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+  ASSERT_OK_AND_ASSIGN(table, table->CombineChunks());
+  AssertTablesEqual(*TableFromJSON(parse_options_.explicit_schema, {"[[1], [2], [3]]"}),
+                    *table);
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -17,9 +17,12 @@
 
 #include "arrow/util/compression.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -231,5 +234,77 @@ bool Codec::IsAvailable(Compression::type codec_type) {
   }
 }
 
+CodecSelectionOptions CodecSelectionOptions::Defaults() {
+  return CodecSelectionOptions();
+}
+
+namespace {
+
+// Number of evenly spaced chunks making up the sample of larger data
+constexpr int64_t kNumSampleChunks = 8;
+
+std::vector<uint8_t> SampleData(const uint8_t* data, int64_t size, int64_t sample_size) {
+  if (size <= sample_size) {
+    return std::vector<uint8_t>(data, data + size);
+  }
+  const int64_t chunk_size = std::max<int64_t>(sample_size / kNumSampleChunks, 1);
+  const int64_t num_chunks = sample_size / chunk_size;
+  const int64_t stride = (size - chunk_size) / std::max<int64_t>(num_chunks - 1, 1);
+  std::vector<uint8_t> sample;
+  sample.reserve(num_chunks * chunk_size);
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    const uint8_t* chunk = data + i * stride;
+    sample.insert(sample.end(), chunk, chunk + chunk_size);
+  }
+  return sample;
+}
+
+}  // namespace
+
+Result<CodecSelection> SelectCodec(const uint8_t* data, int64_t size,
+                                   const CodecSelectionOptions& options) {
+  CodecSelection best;
+  const auto sample = SampleData(data, size, options.sample_size);
+  if (sample.empty()) {
+    return best;
+  }
+  const auto sample_size = static_cast<int64_t>(sample.size());
+
+  std::vector<uint8_t> compressed;
+  for (const auto& candidate : options.candidates) {
+    if (candidate.compression == Compression::UNCOMPRESSED ||
+        !Codec::IsAvailable(candidate.compression)) {
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto codec, Codec::Create(candidate.compression,
+                                                    candidate.compression_level));
+    compressed.resize(codec->MaxCompressedLen(sample_size, sample.data()));
+
+    const auto start = std::chrono::steady_clock::now();
+    auto maybe_compressed_size = codec->Compress(
+        sample_size, sample.data(), static_cast<int64_t>(compressed.size()),
+        compressed.data());
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (maybe_compressed_size.status().IsNotImplemented()) {
+      // No one-shot compression (e.g. BZ2)
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t compressed_size, maybe_compressed_size);
+
+    const double ratio =
+        static_cast<double>(sample_size) / std::max<double>(compressed_size, 1);
+    const double speed = sample_size / std::max(elapsed.count(), 1e-9);
+    if (speed >= options.min_compression_speed && ratio >= options.min_ratio &&
+        ratio > best.ratio) {
+      best.compression = candidate.compression;
+      best.compression_level = candidate.compression_level;
+      best.ratio = ratio;
+      best.compression_speed = speed;
+    }
+  }
+  return best;
+}
+
 }  // namespace util
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -185,5 +186,60 @@ class ARROW_EXPORT Codec {
   virtual Status Init();
 };
 
+/// \brief Options for SelectCodec()
+struct ARROW_EXPORT CodecSelectionOptions {
+  struct Candidate {
+    Compression::type compression;
+    int compression_level;
+  };
+
+  /// \brief Codecs and compression levels to choose from
+  ///
+  /// Candidates whose codec support wasn't built, or which don't support
+  /// one-shot compression, are ignored.
+  std::vector<Candidate> candidates = {
+      {Compression::LZ4_FRAME, kUseDefaultCompressionLevel},
+      {Compression::ZSTD, 1},
+      {Compression::ZSTD, 3},
+      {Compression::ZSTD, 9}};
+
+  /// \brief Minimum single-threaded compression speed, in bytes per second
+  double min_compression_speed = 100e6;
+
+  /// \brief Minimum compression ratio for compressing to be worthwhile
+  double min_ratio = 1.1;
+
+  /// \brief Number of bytes to sample from the data
+  ///
+  /// Larger data is sampled in several evenly spaced chunks.
+  int64_t sample_size = 256 * 1024;
+
+  static CodecSelectionOptions Defaults();
+};
+
+/// \brief The outcome of SelectCodec()
+struct ARROW_EXPORT CodecSelection {
+  /// UNCOMPRESSED if no candidate meets the requirements
+  Compression::type compression = Compression::UNCOMPRESSED;
+  int compression_level = kUseDefaultCompressionLevel;
+  /// Compression ratio measured on the sample
+  double ratio = 1.0;
+  /// Compression speed measured on the sample, in bytes per second
+  double compression_speed = 0.0;
+};
+
+/// \brief Choose a codec and compression level for some data
+///
+/// A sample of the data is compressed with each candidate.  The candidate
+/// achieving the best compression ratio among those compressing at least as
+/// fast as requested is chosen, unless its ratio is below the minimum.
+///
+/// As speeds are measured on the calling machine, the selection is not
+/// deterministic.
+ARROW_EXPORT
+Result<CodecSelection> SelectCodec(
+    const uint8_t* data, int64_t size,
+    const CodecSelectionOptions& options = CodecSelectionOptions::Defaults());
+
 }  // namespace util
 }  // namespace arrow
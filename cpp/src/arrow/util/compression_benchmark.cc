@@ -18,6 +18,7 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -33,37 +34,6 @@
 namespace arrow {
 namespace util {
 
-#ifdef ARROW_WITH_BENCHMARKS_REFERENCE
-
-std::vector<uint8_t> MakeCompressibleData(int data_size) {
-  // XXX This isn't a real-world corpus so doesn't really represent the
-  // comparative qualities of the algorithms
-
-  // First make highly compressible data
-  std::string base_data =
-      "Apache Arrow is a cross-language development platform for in-memory data";
-  int nrepeats = static_cast<int>(1 + data_size / base_data.size());
-
-  std::vector<uint8_t> data(base_data.size() * nrepeats);
-  for (int i = 0; i < nrepeats; ++i) {
-    std::memcpy(data.data() + i * base_data.size(), base_data.data(), base_data.size());
-  }
-  data.resize(data_size);
-
-  // Then randomly mutate some bytes so as to make things harder
-  std::mt19937 engine(42);
-  std::exponential_distribution<> offsets(0.05);
-  std::uniform_int_distribution<> values(0, 255);
-
-  int64_t pos = 0;
-  while (pos < data_size) {
-    data[pos] = static_cast<uint8_t>(values(engine));
-    pos += static_cast<int64_t>(offsets(engine));
-  }
-
-  return data;
-}
-
 int64_t StreamingCompress(Codec* codec, const std::vector<uint8_t>& data,
                           std::vector<uint8_t>* compressed_data = nullptr) {
   if (compressed_data != nullptr) {
@@ -112,6 +82,282 @@ int64_t StreamingCompress(Codec* codec, const std::vector<uint8_t>& data,
   return compressed_size;
 }
 
+int64_t StreamingDecompress(Codec* codec, const std::vector<uint8_t>& compressed_data,
+                            std::vector<uint8_t>* output_buffer) {
+  auto decompressor = *codec->MakeDecompressor();
+
+  const uint8_t* input = compressed_data.data();
+  int64_t input_len = compressed_data.size();
+  int64_t decompressed_size = 0;
+
+  while (!decompressor->IsFinished()) {
+    auto result = *decompressor->Decompress(input_len, input, output_buffer->size(),
+                                            output_buffer->data());
+    input += result.bytes_read;
+    input_len -= result.bytes_read;
+    decompressed_size += result.bytes_written;
+    if (result.need_more_output) {
+      // Enlarge output buffer
+      output_buffer->resize(output_buffer->size() * 2);
+    }
+  }
+  return decompressed_size;
+}
+
+// ----------------------------------------------------------------------
+// Compression of typical Arrow buffers
+
+enum BufferKind { kValidityBitmap, kOffsets, kDoubles, kStrings };
+
+// Make `size` bytes looking like an Arrow buffer of the given kind
+static std::vector<uint8_t> MakeArrowBuffer(BufferKind kind, int64_t size) {
+  std::mt19937 engine(42);
+  std::vector<uint8_t> data;
+  data.reserve(size);
+  auto append = [&](const void* value, size_t length) {
+    const auto bytes = reinterpret_cast<const uint8_t*>(value);
+    data.insert(data.end(), bytes, bytes + length);
+  };
+
+  switch (kind) {
+    case kValidityBitmap: {
+      // 95% valid
+      std::bernoulli_distribution valid(0.95);
+      while (static_cast<int64_t>(data.size()) < size) {
+        uint8_t byte = 0;
+        for (int i = 0; i < 8; ++i) {
+          byte |= static_cast<uint8_t>(valid(engine)) << i;
+        }
+        data.push_back(byte);
+      }
+      break;
+    }
+    case kOffsets: {
+      // Offsets of strings of 0 to 20 characters
+      std::uniform_int_distribution<int32_t> lengths(0, 20);
+      int32_t offset = 0;
+      while (static_cast<int64_t>(data.size()) < size) {
+        append(&offset, sizeof(offset));
+        offset += lengths(engine);
+      }
+      break;
+    }
+    case kDoubles: {
+      // A random walk, rounded to cents
+      std::normal_distribution<double> steps(0, 1);
+      double value = 100;
+      while (static_cast<int64_t>(data.size()) < size) {
+        value += steps(engine);
+        double rounded = std::round(value * 100) / 100;
+        append(&rounded, sizeof(rounded));
+      }
+      break;
+    }
+    case kStrings: {
+      // Words drawn from a small vocabulary, with a skewed distribution
+      const std::vector<std::string> words = {
+          "arrow",  "columnar", "memory", "format", "buffer", "array",  "batch",
+          "schema", "field",    "null",   "value",  "offset", "stream", "file"};
+      std::geometric_distribution<size_t> indices(0.3);
+      while (static_cast<int64_t>(data.size()) < size) {
+        const auto& word = words[std::min(indices(engine), words.size() - 1)];
+        append(word.data(), word.size());
+      }
+      break;
+    }
+  }
+  data.resize(size);
+  return data;
+}
+
+constexpr int64_t kArrowBufferSize = 1 << 20;  // 1 MB
+
+// Arguments: buffer kind, compression level, whether to use the streaming API
+template <Compression::type COMPRESSION>
+static void CompressArrowBuffer(benchmark::State& state) {  // NOLINT non-const reference
+  const auto data =
+      MakeArrowBuffer(static_cast<BufferKind>(state.range(0)), kArrowBufferSize);
+  auto codec = *Codec::Create(COMPRESSION, static_cast<int>(state.range(1)));
+  const bool streaming = state.range(2) != 0;
+
+  std::vector<uint8_t> compressed(codec->MaxCompressedLen(data.size(), data.data()));
+  int64_t compressed_size = 0;
+  for (auto _ : state) {
+    if (streaming) {
+      compressed_size = StreamingCompress(codec.get(), data);
+    } else {
+      compressed_size = *codec->Compress(data.size(), data.data(), compressed.size(),
+                                         compressed.data());
+    }
+  }
+  state.counters["ratio"] =
+      static_cast<double>(data.size()) / static_cast<double>(compressed_size);
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+// Arguments: buffer kind, compression level, whether to use the streaming API
+template <Compression::type COMPRESSION>
+static void DecompressArrowBuffer(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto data =
+      MakeArrowBuffer(static_cast<BufferKind>(state.range(0)), kArrowBufferSize);
+  auto codec = *Codec::Create(COMPRESSION, static_cast<int>(state.range(1)));
+  const bool streaming = state.range(2) != 0;
+
+  std::vector<uint8_t> compressed;
+  if (streaming) {
+    StreamingCompress(codec.get(), data, &compressed);
+  } else {
+    compressed.resize(codec->MaxCompressedLen(data.size(), data.data()));
+    compressed.resize(*codec->Compress(data.size(), data.data(), compressed.size(),
+                                       compressed.data()));
+  }
+
+  std::vector<uint8_t> decompressed(data.size());
+  for (auto _ : state) {
+    int64_t decompressed_size;
+    if (streaming) {
+      decompressed_size = StreamingDecompress(codec.get(), compressed, &decompressed);
+    } else {
+      decompressed_size = *codec->Decompress(compressed.size(), compressed.data(),
+                                             decompressed.size(), decompressed.data());
+    }
+    ARROW_CHECK(decompressed_size == static_cast<int64_t>(data.size()));
+  }
+  state.counters["ratio"] =
+      static_cast<double>(data.size()) / static_cast<double>(compressed.size());
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+// Arguments: buffer kind
+static void SelectArrowBufferCodec(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto data =
+      MakeArrowBuffer(static_cast<BufferKind>(state.range(0)), kArrowBufferSize);
+
+  CodecSelection selection;
+  for (auto _ : state) {
+    selection = *SelectCodec(data.data(), data.size());
+  }
+  state.counters["ratio"] = selection.ratio;
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void SetArrowBufferArgs(benchmark::internal::Benchmark* bench,
+                        const std::vector<int>& levels, bool one_shot = true,
+                        bool streaming = true) {
+  bench->ArgNames({"kind", "level", "streaming"});
+  for (int kind : {kValidityBitmap, kOffsets, kDoubles, kStrings}) {
+    for (int level : levels) {
+      if (one_shot) {
+        bench->Args({kind, level, 0});
+      }
+      if (streaming) {
+        bench->Args({kind, level, 1});
+      }
+    }
+  }
+}
+
+static void SetBufferKindArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"kind"});
+  for (int kind : {kValidityBitmap, kOffsets, kDoubles, kStrings}) {
+    bench->Args({kind});
+  }
+}
+
+static void SetDefaultLevelArgs(benchmark::internal::Benchmark* bench) {
+  SetArrowBufferArgs(bench, {kUseDefaultCompressionLevel});
+}
+
+static void SetSnappyArgs(benchmark::internal::Benchmark* bench) {
+  // No streaming API
+  SetArrowBufferArgs(bench, {kUseDefaultCompressionLevel}, /*one_shot=*/true,
+                     /*streaming=*/false);
+}
+
+static void SetLevelArgs(benchmark::internal::Benchmark* bench) {
+  // Fast, default and high compression levels (same for zlib and Brotli)
+  SetArrowBufferArgs(bench, {1, 6, 9});
+}
+
+static void SetZSTDArgs(benchmark::internal::Benchmark* bench) {
+  SetArrowBufferArgs(bench, {1, 3, 9});
+}
+
+static void SetBZ2Args(benchmark::internal::Benchmark* bench) {
+  // No one-shot compression
+  SetArrowBufferArgs(bench, {1, 9}, /*one_shot=*/false, /*streaming=*/true);
+}
+
+BENCHMARK(SelectArrowBufferCodec)->Apply(SetBufferKindArgs);
+
+#ifdef ARROW_WITH_LZ4
+BENCHMARK_TEMPLATE(CompressArrowBuffer, Compression::LZ4_FRAME)
+    ->Apply(SetDefaultLevelArgs);
+BENCHMARK_TEMPLATE(DecompressArrowBuffer, Compression::LZ4_FRAME)
+    ->Apply(SetDefaultLevelArgs);
+#endif
+
+#ifdef ARROW_WITH_ZSTD
+BENCHMARK_TEMPLATE(CompressArrowBuffer, Compression::ZSTD)->Apply(SetZSTDArgs);
+BENCHMARK_TEMPLATE(DecompressArrowBuffer, Compression::ZSTD)->Apply(SetZSTDArgs);
+#endif
+
+#ifdef ARROW_WITH_SNAPPY
+BENCHMARK_TEMPLATE(CompressArrowBuffer, Compression::SNAPPY)->Apply(SetSnappyArgs);
+BENCHMARK_TEMPLATE(DecompressArrowBuffer, Compression::SNAPPY)->Apply(SetSnappyArgs);
+#endif
+
+#ifdef ARROW_WITH_ZLIB
+BENCHMARK_TEMPLATE(CompressArrowBuffer, Compression::GZIP)->Apply(SetLevelArgs);
+BENCHMARK_TEMPLATE(DecompressArrowBuffer, Compression::GZIP)->Apply(SetLevelArgs);
+#endif
+
+#ifdef ARROW_WITH_BROTLI
+BENCHMARK_TEMPLATE(CompressArrowBuffer, Compression::BROTLI)->Apply(SetLevelArgs);
+BENCHMARK_TEMPLATE(DecompressArrowBuffer, Compression::BROTLI)->Apply(SetLevelArgs);
+#endif
+
+#ifdef ARROW_WITH_BZ2
+BENCHMARK_TEMPLATE(CompressArrowBuffer, Compression::BZ2)->Apply(SetBZ2Args);
+BENCHMARK_TEMPLATE(DecompressArrowBuffer, Compression::BZ2)->Apply(SetBZ2Args);
+#endif
+
+// ----------------------------------------------------------------------
+// Reference benchmarks
+
+#ifdef ARROW_WITH_BENCHMARKS_REFERENCE
+
+std::vector<uint8_t> MakeCompressibleData(int data_size) {
+  // XXX This isn't a real-world corpus so doesn't really represent the
+  // comparative qualities of the algorithms
+
+  // First make highly compressible data
+  std::string base_data =
+      "Apache Arrow is a cross-language development platform for in-memory data";
+  int nrepeats = static_cast<int>(1 + data_size / base_data.size());
+
+  std::vector<uint8_t> data(base_data.size() * nrepeats);
+  for (int i = 0; i < nrepeats; ++i) {
+    std::memcpy(data.data() + i * base_data.size(), base_data.data(), base_data.size());
+  }
+  data.resize(data_size);
+
+  // Then randomly mutate some bytes so as to make things harder
+  std::mt19937 engine(42);
+  std::exponential_distribution<> offsets(0.05);
+  std::uniform_int_distribution<> values(0, 255);
+
+  int64_t pos = 0;
+  while (pos < data_size) {
+    data[pos] = static_cast<uint8_t>(values(engine));
+    pos += static_cast<int64_t>(offsets(engine));
+  }
+
+  return data;
+}
+
 static void StreamingCompression(Compression::type compression,
                                  const std::vector<uint8_t>& data,
                                  benchmark::State& state) {  // NOLINT non-const reference
@@ -143,25 +389,10 @@ static void StreamingDecompression(
   state.counters["ratio"] =
       static_cast<double>(data.size()) / static_cast<double>(compressed_data.size());
 
+  std::vector<uint8_t> output_buffer(1 << 20);  // 1 MB
   while (state.KeepRunning()) {
-    auto decompressor = *codec->MakeDecompressor();
-
-    const uint8_t* input = compressed_data.data();
-    int64_t input_len = compressed_data.size();
-    int64_t decompressed_size = 0;
-
-    std::vector<uint8_t> output_buffer(1 << 20);  // 1 MB
-    while (!decompressor->IsFinished()) {
-      auto result = *decompressor->Decompress(input_len, input, output_buffer.size(),
-                                              output_buffer.data());
-      input += result.bytes_read;
-      input_len -= result.bytes_read;
-      decompressed_size += result.bytes_written;
-      if (result.need_more_output) {
-        // Enlarge output buffer
-        output_buffer.resize(output_buffer.size() * 2);
-      }
-    }
+    int64_t decompressed_size =
+        StreamingDecompress(codec.get(), compressed_data, &output_buffer);
     ARROW_CHECK(decompressed_size == static_cast<int64_t>(data.size()));
   }
   state.SetBytesProcessed(state.iterations() * data.size());
@@ -400,6 +400,54 @@ TEST(TestCodecMisc, SpecifyCompressionLevel) {
   }
 }
 
+TEST(TestCodecMisc, SelectCodec) {
+  auto options = CodecSelectionOptions::Defaults();
+  options.min_compression_speed = 0;
+  options.candidates = {{Compression::LZ4_FRAME, kUseDefaultCompressionLevel},
+                        {Compression::ZSTD, 1},
+                        {Compression::GZIP, 9},
+                        {Compression::BZ2, 9}};
+  bool any_available = false;
+  for (const auto& candidate : options.candidates) {
+    // BZ2 doesn't support one-shot compression
+    if (candidate.compression != Compression::BZ2 &&
+        Codec::IsAvailable(candidate.compression)) {
+      any_available = true;
+    }
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto selection, SelectCodec(nullptr, 0, options));
+  ASSERT_EQ(Compression::UNCOMPRESSED, selection.compression);
+
+  // Random data isn't worth compressing
+  std::vector<uint8_t> data = MakeRandomData(1 << 20);
+  ASSERT_OK_AND_ASSIGN(selection, SelectCodec(data.data(), data.size(), options));
+  ASSERT_EQ(Compression::UNCOMPRESSED, selection.compression);
+
+  data = MakeCompressibleData(1 << 20);
+  ASSERT_OK_AND_ASSIGN(selection, SelectCodec(data.data(), data.size(), options));
+  if (any_available) {
+    ASSERT_TRUE(Codec::IsAvailable(selection.compression));
+    ASSERT_NE(Compression::UNCOMPRESSED, selection.compression);
+    ASSERT_NE(Compression::BZ2, selection.compression);
+    ASSERT_GE(selection.ratio, options.min_ratio);
+    ASSERT_GT(selection.compression_speed, 0);
+  } else {
+    ASSERT_EQ(Compression::UNCOMPRESSED, selection.compression);
+  }
+
+  // No candidate is fast enough
+  options.min_compression_speed = 1e18;
+  ASSERT_OK_AND_ASSIGN(selection, SelectCodec(data.data(), data.size(), options));
+  ASSERT_EQ(Compression::UNCOMPRESSED, selection.compression);
+
+  if (Codec::IsAvailable(Compression::GZIP)) {
+    // Invalid compression levels are reported
+    options.candidates = {{Compression::GZIP, -992}};
+    ASSERT_FALSE(SelectCodec(data.data(), data.size(), options).ok());
+  }
+}
+
 TEST_P(CodecTest, OutputBufferIsSmall) {
   auto type = GetCompression();
   if (type != Compression::SNAPPY) {
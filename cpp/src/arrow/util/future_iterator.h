@@ -18,13 +18,17 @@
 #pragma once
 
 #include <cassert>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -72,4 +76,173 @@ Iterator<T> MakeAsCompletedIterator(std::vector<Future<T>> futures) {
   return Iterator<T>(AsCompletedIterator<T>(std::move(futures)));
 }
 
+/// \brief A function returning a Future for the next item of a sequence each
+/// time it is called.
+///
+/// The end of the sequence is signalled by an item equal to
+/// IterationTraits<T>::End(). Unless stated otherwise, a generator must not be
+/// called concurrently.
+template <typename T>
+using AsyncGenerator = std::function<Future<T>()>;
+
+template <typename T>
+class GeneratorIterator {
+ public:
+  explicit GeneratorIterator(AsyncGenerator<T> generator)
+      : generator_(std::move(generator)) {}
+
+  /// Wait for the next item of the generator.
+  Result<T> Next() {
+    auto fut = generator_();
+    return std::move(fut).result();
+  }
+
+ private:
+  AsyncGenerator<T> generator_;
+};
+
+/// \brief Consume an AsyncGenerator synchronously, waiting for each item in turn
+template <typename T>
+Iterator<T> MakeGeneratorIterator(AsyncGenerator<T> generator) {
+  return Iterator<T>(GeneratorIterator<T>(std::move(generator)));
+}
+
+/// \brief An AsyncGenerator pulling the items of an Iterator on an Executor
+///
+/// Up to `readahead` items are requested ahead of the consumer. A single task
+/// pulls the items, in order, so the underlying Iterator needn't be thread-safe,
+/// and the task re-spawns itself after each item rather than occupying a worker
+/// of the executor for as long as items are requested.
+template <typename T>
+class BackgroundGenerator {
+ public:
+  BackgroundGenerator(Iterator<T> it, internal::Executor* executor, int readahead)
+      : state_(std::make_shared<State>(std::move(it), executor, readahead)) {}
+
+  Future<T> operator()() {
+    auto& state = *state_;
+    // Waiting on tasks queued behind the caller could deadlock the executor,
+    // so a worker of the executor pulls the items itself instead.
+    const bool read_inline = state.executor->OwnsThisThread();
+
+    bool start_reader = false;
+    {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      while (state.in_flight.empty() ||
+             (!read_inline &&
+              static_cast<int>(state.in_flight.size()) < state.readahead)) {
+        auto fut = Future<T>::Make();
+        state.pending.push_back(fut);
+        state.in_flight.push_back(std::move(fut));
+        if (read_inline) break;
+      }
+      if (!state.reading) {
+        state.reading = start_reader = true;
+      }
+    }
+
+    auto next = std::move(state.in_flight.front());
+    state.in_flight.pop_front();
+
+    if (start_reader) {
+      if (read_inline) {
+        while (state.ReadOne()) {
+        }
+      } else {
+        State::Spawn(state_);
+      }
+    }
+    return next;
+  }
+
+ private:
+  struct State {
+    State(Iterator<T> it, internal::Executor* executor, int readahead)
+        : executor(executor), readahead(readahead), it(std::move(it)) {}
+
+    // Pull the next item into the oldest pending Future, returning whether more
+    // items are pending. Only the (single) reader calls this, so the Iterator is
+    // not accessed concurrently and is pulled without holding the lock.
+    bool ReadOne() {
+      Future<T> fut;
+      bool was_done;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        fut = std::move(pending.front());
+        pending.pop_front();
+        was_done = done;
+      }
+
+      Result<T> next = was_done ? Result<T>(IterationTraits<T>::End()) : it.Next();
+
+      bool more;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = was_done || !next.ok() || *next == IterationTraits<T>::End();
+        more = !pending.empty();
+        reading = more;
+      }
+      fut.MarkFinished(std::move(next));
+      return more;
+    }
+
+    // Pull one item on the executor, then re-spawn to pull the next one if any
+    static void Spawn(std::shared_ptr<State> state) {
+      auto executor = state->executor;
+      Status st = executor->Spawn([state] {
+        if (state->ReadOne()) {
+          Spawn(state);
+        }
+      });
+      if (!st.ok()) {
+        state->Fail(std::move(st));
+      }
+    }
+
+    // Fulfill all pending requests with an error
+    void Fail(Status st) {
+      std::deque<Future<T>> failed;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        failed.swap(pending);
+        reading = false;
+      }
+      for (auto& fut : failed) {
+        fut.MarkFinished(st);
+      }
+    }
+
+    internal::Executor* executor;
+    const int readahead;
+    // Only accessed from the consumer
+    std::deque<Future<T>> in_flight;
+
+    // Only accessed from the reader
+    Iterator<T> it;
+
+    std::mutex mutex;
+    // Whether a reader is pulling items or scheduled to
+    bool reading = false;
+    bool done = false;
+    std::deque<Future<T>> pending;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+/// \brief Make an AsyncGenerator pulling the items of `it` on `executor`
+///
+/// This is an alternative to MakeReadaheadIterator() which, instead of
+/// dedicating a thread to each iterator, shares the threads of an Executor
+/// (such as the I/O thread pool) between all background iterators.
+template <typename T>
+Result<AsyncGenerator<T>> MakeBackgroundGenerator(Iterator<T> it,
+                                                  internal::Executor* executor,
+                                                  int readahead) {
+  if (readahead <= 0) {
+    return Status::Invalid("readahead must be greater than 0, got ", readahead);
+  }
+  return AsyncGenerator<T>(BackgroundGenerator<T>(std::move(it), executor, readahead));
+}
+
 }  // namespace arrow
@@ -711,4 +711,78 @@ TYPED_TEST(FutureIteratorTest, ErrorsAsCompleted) { this->TestErrorsAsCompleted(
 
 TYPED_TEST(FutureIteratorTest, StressAsCompleted) { this->TestStressAsCompleted(); }
 
+TEST(FutureIteratorTest, GeneratorIterator) {
+  int counter = 0;
+  AsyncGenerator<Foo> generator = [&counter]() {
+    if (counter == 3) {
+      return Future<Foo>::MakeFinished(IterationTraits<Foo>::End());
+    }
+    return Future<Foo>::MakeFinished(Foo(counter++));
+  };
+
+  auto it = MakeGeneratorIterator(std::move(generator));
+  ASSERT_OK_AND_ASSIGN(auto values, it.ToVector());
+  ASSERT_EQ(values, std::vector<Foo>({Foo(0), Foo(1), Foo(2)}));
+
+  AsyncGenerator<Foo> failing = []() {
+    return Future<Foo>::MakeFinished(Status::IOError("xxx"));
+  };
+  ASSERT_RAISES(IOError, MakeGeneratorIterator(std::move(failing)).Next());
+}
+
+TEST(FutureIteratorTest, BackgroundGenerator) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(4));
+  std::vector<Foo> expected;
+  for (int i = 0; i < 100; ++i) {
+    expected.emplace_back(i);
+  }
+
+  for (int readahead : {1, 3, 16}) {
+    ASSERT_OK_AND_ASSIGN(
+        auto generator,
+        MakeBackgroundGenerator(MakeVectorIterator(expected), pool.get(), readahead));
+    ASSERT_OK_AND_ASSIGN(auto values,
+                         MakeGeneratorIterator(std::move(generator)).ToVector());
+    ASSERT_EQ(values, expected);
+  }
+
+  // From a worker of the executor, items are pulled inline
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&]() -> Result<std::vector<Foo>> {
+    ARROW_ASSIGN_OR_RAISE(
+        auto generator,
+        MakeBackgroundGenerator(MakeVectorIterator(expected), pool.get(), 4));
+    return MakeGeneratorIterator(std::move(generator)).ToVector();
+  }));
+  ASSERT_OK_AND_ASSIGN(auto values, fut.result());
+  ASSERT_EQ(values, expected);
+
+  ASSERT_RAISES(Invalid, MakeBackgroundGenerator(MakeVectorIterator(expected),
+                                                 pool.get(), /*readahead=*/0));
+}
+
+TEST(FutureIteratorTest, BackgroundGeneratorSingleReader) {
+  // A reader blocked in Next() occupies a single worker of the executor
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(2));
+  auto gate = Future<void>::Make();
+  int next_value = 0;
+  auto it = MakeFunctionIterator([&]() -> Result<Foo> {
+    RETURN_NOT_OK(gate.status());
+    if (next_value == 10) {
+      return IterationTraits<Foo>::End();
+    }
+    return Foo(next_value++);
+  });
+  ASSERT_OK_AND_ASSIGN(auto generator,
+                       MakeBackgroundGenerator(std::move(it), pool.get(), 8));
+  auto first = generator();
+
+  ASSERT_OK_AND_ASSIGN(auto opened, pool->Submit([&] { gate.MarkFinished(); }));
+  ASSERT_OK(opened.status());
+  ASSERT_OK_AND_ASSIGN(auto value, first.result());
+  ASSERT_EQ(value, Foo(0));
+
+  ASSERT_OK_AND_ASSIGN(auto rest, MakeGeneratorIterator(std::move(generator)).ToVector());
+  ASSERT_EQ(rest.size(), 9u);
+}
+
 }  // namespace arrow
@@ -56,10 +56,14 @@ struct ThreadPool::State {
   bool quick_shutdown_;
 };
 
+// The state of the pool owning the current thread, if any
+static thread_local const ThreadPool::State* current_thread_pool_state = nullptr;
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
                        std::list<std::thread>::iterator it) {
+  current_thread_pool_state = state.get();
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
@@ -184,6 +188,8 @@ int ThreadPool::GetCapacity() {
   return state_->desired_capacity_;
 }
 
+bool ThreadPool::OwnsThisThread() { return current_thread_pool_state == state_; }
+
 int ThreadPool::GetActualCapacity() {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -289,6 +289,17 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_F(TestThreadPool, OwnsThisThread) {
+  auto pool = this->MakeThreadPool(3);
+  auto other_pool = this->MakeThreadPool(3);
+  ASSERT_FALSE(pool->OwnsThisThread());
+
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&] {
+    return pool->OwnsThisThread() && !other_pool->OwnsThisThread();
+  }));
+  ASSERT_OK_AND_EQ(true, fut.result());
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
@@ -40,6 +40,7 @@
 #include "parquet/exception.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
 
@@ -110,6 +111,11 @@ class ColumnReaderImpl : public ColumnReader {
 
   virtual ::arrow::Status LoadBatch(int64_t num_records) = 0;
 
+  // Load the given rows of the current row group, skipping the other ones
+  virtual ::arrow::Status LoadRows(const RowRanges& rows) {
+    return Status::NotImplemented("Reading selected rows of ", field()->ToString());
+  }
+
   virtual ::arrow::Status BuildArray(int64_t length_upper_bound,
                                      std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
   virtual bool IsOrHasRepeatedChild() const = 0;
@@ -302,6 +308,9 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                      const RowRanges& rows, std::shared_ptr<Table>* out) override;
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
                               std::unique_ptr<RecordBatchReader>* out) override;
@@ -437,15 +446,22 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->Reset();
     // Pre-allocation gives much better performance for flat columns
     record_reader_->Reserve(records_to_read);
-    while (records_to_read > 0) {
-      if (!record_reader_->HasMoreData()) {
-        break;
-      }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
-      records_to_read -= records_read;
-      if (records_read == 0) {
-        NextRowGroup();
-      }
+    ReadRecords(records_to_read);
+    RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
+                                     ctx_->pool, &out_));
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  Status LoadRows(const RowRanges& rows) final {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    out_ = nullptr;
+    record_reader_->Reset();
+    record_reader_->Reserve(rows.num_rows());
+    int64_t position = 0;
+    for (const RowRanges::Range& range : rows.ranges()) {
+      position += SkipRecords(range.first - position);
+      position += ReadRecords(range.last - range.first + 1);
     }
     RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
                                      ctx_->pool, &out_));
@@ -468,6 +484,33 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Read records, continuing into the next row groups as needed. Returns the
+  // number of records read.
+  int64_t ReadRecords(int64_t num_records) {
+    int64_t records_read = 0;
+    while (records_read < num_records && record_reader_->HasMoreData()) {
+      const int64_t batch_read = record_reader_->ReadRecords(num_records - records_read);
+      records_read += batch_read;
+      if (batch_read == 0) {
+        NextRowGroup();
+      }
+    }
+    return records_read;
+  }
+
+  int64_t SkipRecords(int64_t num_records) {
+    int64_t records_skipped = 0;
+    while (records_skipped < num_records && record_reader_->HasMoreData()) {
+      const int64_t batch_skipped =
+          record_reader_->SkipRecords(num_records - records_skipped);
+      records_skipped += batch_skipped;
+      if (batch_skipped == 0) {
+        NextRowGroup();
+      }
+    }
+    return records_skipped;
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
@@ -494,6 +537,8 @@ class ExtensionReader : public ColumnReaderImpl {
     return storage_reader_->LoadBatch(number_of_records);
   }
 
+  Status LoadRows(const RowRanges& rows) final { return storage_reader_->LoadRows(rows); }
+
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override {
     std::shared_ptr<ChunkedArray> storage;
@@ -634,6 +679,12 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
     }
     return Status::OK();
   }
+  Status LoadRows(const RowRanges& rows) override {
+    for (const std::unique_ptr<ColumnReaderImpl>& reader : children_) {
+      RETURN_NOT_OK(reader->LoadRows(rows));
+    }
+    return Status::OK();
+  }
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override;
   Status GetDefLevels(const int16_t** data, int64_t* length) override;
@@ -951,6 +1002,34 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   return (*out)->Validate();
 }
 
+Status FileReaderImpl::ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                    const RowRanges& rows, std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheck({i}, column_indices));
+
+  if (reader_properties_.pre_buffer()) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    parquet_reader()->PreBuffer({i}, column_indices, reader_properties_.async_context(),
+                                reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, {i}, &readers, &result_schema));
+
+  const int64_t num_rows = rows.num_rows();
+  ::arrow::ChunkedArrayVector columns(readers.size());
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      reader_properties_.use_threads(), static_cast<int>(readers.size()), [&](int j) {
+        RETURN_NOT_OK(readers[j]->LoadRows(rows));
+        return readers[j]->BuildArray(num_rows, &columns[j]);
+      }));
+
+  const int64_t num_rows_read = columns.empty() ? num_rows : columns[0]->length();
+  *out = Table::Make(std::move(result_schema), std::move(columns), num_rows_read);
+  return (*out)->Validate();
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
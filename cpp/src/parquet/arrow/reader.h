@@ -193,6 +193,17 @@ class PARQUET_EXPORT FileReader {
 
   virtual ::arrow::Status ReadRowGroup(int i, std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read the given rows of the given columns of a row group into a Table
+  ///
+  /// Rows are positions among those the row group yields, i.e. relative to
+  /// the row group unless ParquetFileReader::SelectRows restricted it to some
+  /// of its pages. Values of the other rows are skipped rather than
+  /// converted, and data pages holding none of the rows are not decoded.
+  /// Columns with repeated values are not supported.
+  virtual ::arrow::Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                                       const RowRanges& rows,
+                                       std::shared_ptr<::arrow::Table>* out) = 0;
+
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         const std::vector<int>& column_indices,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
@@ -750,8 +750,11 @@ class ColumnReaderImplBase {
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
         }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -759,11 +762,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -1174,6 +1172,83 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->max_rep_level_ > 0) {
+      throw ParquetException("Skipping records of repeated columns is not supported");
+    }
+    // Levels decoded by ReadRecords but not consumed yet belong to the
+    // current page; skip them first
+    int64_t records_skipped = SkipBufferedRecords(num_records);
+
+    while (records_skipped < num_records && this->HasNextInternal()) {
+      const int64_t available = available_values_current_page();
+      const int64_t records_left = num_records - records_skipped;
+      if (available <= records_left) {
+        // Skip the rest of the page without decoding it
+        this->ConsumeBufferedValues(available);
+        records_skipped += available;
+        continue;
+      }
+
+      const int64_t batch_size = std::min(kMinLevelBatchSize, records_left);
+      int64_t values_to_skip = batch_size;
+      if (this->max_def_level_ > 0) {
+        ReserveSkipScratch(batch_size * sizeof(int16_t));
+        auto def_levels = reinterpret_cast<int16_t*>(skip_scratch_->mutable_data());
+        if (this->ReadDefinitionLevels(batch_size, def_levels) != batch_size) {
+          throw ParquetException("Could not read definition levels of skipped records");
+        }
+        values_to_skip = std::count(def_levels, def_levels + batch_size,
+                                    static_cast<int16_t>(this->max_def_level_));
+      }
+      SkipValues(values_to_skip);
+      this->ConsumeBufferedValues(batch_size);
+      records_skipped += batch_size;
+    }
+    return records_skipped;
+  }
+
+  // Skip records whose definition levels are buffered past levels_position_,
+  // dropping those levels from the buffer
+  int64_t SkipBufferedRecords(int64_t num_records) {
+    const int64_t records_skipped =
+        std::min(levels_written_ - levels_position_, num_records);
+    if (records_skipped == 0) {
+      return 0;
+    }
+    int16_t* def_levels = this->def_levels() + levels_position_;
+    SkipValues(std::count(def_levels, def_levels + records_skipped,
+                          static_cast<int16_t>(this->max_def_level_)));
+    this->ConsumeBufferedValues(records_skipped);
+    std::copy(def_levels + records_skipped, this->def_levels() + levels_written_,
+              def_levels);
+    levels_written_ -= records_skipped;
+    return records_skipped;
+  }
+
+  // Decode values into scratch space and discard them
+  void SkipValues(int64_t num_values) {
+    const int64_t batch_size = std::min(kMinLevelBatchSize, num_values);
+    ReserveSkipScratch(batch_size * static_cast<int64_t>(sizeof(T)));
+    T* values = reinterpret_cast<T*>(skip_scratch_->mutable_data());
+    while (num_values > 0) {
+      const int batch = static_cast<int>(std::min(batch_size, num_values));
+      if (this->current_decoder_->Decode(values, batch) != batch) {
+        throw ParquetException("Could not decode values of skipped records");
+      }
+      num_values -= batch;
+    }
+  }
+
+  void ReserveSkipScratch(int64_t nbytes) {
+    if (skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_);
+    }
+    if (skip_scratch_->size() < nbytes) {
+      PARQUET_THROW_NOT_OK(skip_scratch_->Resize(nbytes, false));
+    }
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1471,6 +1546,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
   LevelInfo leaf_info_;
+  // Holds the levels and values decoded by SkipRecords
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -319,6 +319,57 @@ TEST_F(TestPrimitiveReader, TestInt32FlatRequiredSkip) {
   reader_.reset();
 }
 
+TEST_F(TestPrimitiveReader, TestRecordReaderSkipRecords) {
+  int levels_per_page = 100;
+  int num_pages = 5;
+  max_def_level_ = 1;
+  max_rep_level_ = 0;
+  NodePtr type = schema::Int32("b", Repetition::OPTIONAL);
+  const ColumnDescriptor descr(type, max_def_level_, max_rep_level_);
+  MakePages<Int32Type>(&descr, num_pages, levels_per_page, def_levels_, rep_levels_,
+                       values_, data_buffer_, pages_, Encoding::PLAIN);
+
+  internal::LevelInfo leaf_info(/*null_slots=*/1, /*definition_level=*/1,
+                                /*repetition_level=*/0,
+                                /*repeated_ancestor_definition_level=*/0);
+  auto record_reader = internal::RecordReader::Make(&descr, leaf_info);
+  record_reader->SetPageReader(
+      std::unique_ptr<PageReader>(new test::MockPageReader(pages_)));
+
+  // Skip within a page, skip the levels buffered by the previous read, skip
+  // whole pages and read across pages
+  const std::vector<std::pair<int64_t, int64_t>> skips_and_reads = {
+      {10, 5}, {30, 20}, {250, 60}, {0, 15}, {40, 1}};
+  std::vector<int64_t> expected_rows;
+  int64_t row = 0;
+  for (const auto& skip_and_read : skips_and_reads) {
+    ASSERT_EQ(skip_and_read.first, record_reader->SkipRecords(skip_and_read.first));
+    ASSERT_EQ(skip_and_read.second, record_reader->ReadRecords(skip_and_read.second));
+    row += skip_and_read.first;
+    for (int64_t i = 0; i < skip_and_read.second; ++i) {
+      expected_rows.push_back(row++);
+    }
+  }
+  const int64_t num_rows = num_pages * levels_per_page;
+  ASSERT_EQ(num_rows - row, record_reader->SkipRecords(num_rows));
+  ASSERT_EQ(0, record_reader->SkipRecords(1));
+
+  ASSERT_EQ(static_cast<int64_t>(expected_rows.size()), record_reader->values_written());
+  auto values = reinterpret_cast<const int32_t*>(record_reader->values());
+  auto valid_bits = record_reader->ReleaseIsValid();
+  for (size_t i = 0; i < expected_rows.size(); ++i) {
+    const int64_t expected_row = expected_rows[i];
+    const bool valid = def_levels_[expected_row] == max_def_level_;
+    ASSERT_EQ(valid, ::arrow::BitUtil::GetBit(valid_bits->data(), i));
+    if (valid) {
+      const auto value_index = std::count(def_levels_.begin(),
+                                          def_levels_.begin() + expected_row,
+                                          max_def_level_);
+      ASSERT_EQ(values_[value_index], values[i]);
+    }
+  }
+}
+
 TEST_F(TestPrimitiveReader, TestDictionaryEncodedPages) {
   max_def_level_ = 0;
   max_rep_level_ = 0;
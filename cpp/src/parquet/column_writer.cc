@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -33,16 +34,20 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bitmap_reader.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/level_conversion.h"
 #include "parquet/metadata.h"
+#include "parquet/murmur3.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -174,13 +179,15 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = ::arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       PageIndexBuilder* page_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         pool_(pool),
         num_values_(0),
         dictionary_page_offset_(0),
         data_page_offset_(0),
+        bloom_filter_offset_(-1),
         total_uncompressed_size_(0),
         total_compressed_size_(0),
         page_ordinal_(0),
@@ -188,6 +195,7 @@ class SerializedPageWriter : public PageWriter {
         column_ordinal_(column_chunk_ordinal),
         meta_encryptor_(std::move(meta_encryptor)),
         data_encryptor_(std::move(data_encryptor)),
+        page_index_builder_(page_index_builder),
         encryption_buffer_(AllocateBuffer(pool, 0)) {
     if (data_encryptor_ != nullptr || meta_encryptor_ != nullptr) {
       InitEncryption();
@@ -253,10 +261,18 @@ class SerializedPageWriter : public PageWriter {
     return final_pos - start_pos;
   }
 
+  void WriteBloomFilter(const BloomFilter& bloom_filter) override {
+    PARQUET_ASSIGN_OR_THROW(bloom_filter_offset_, sink_->Tell());
+    bloom_filter.WriteTo(sink_.get());
+  }
+
   void Close(bool has_dictionary, bool fallback) override {
     if (meta_encryptor_ != nullptr) {
       UpdateEncryption(encryption::kColumnMetaData);
     }
+    if (bloom_filter_offset_ >= 0) {
+      metadata_->SetBloomFilterOffset(bloom_filter_offset_);
+    }
     // index_page_offset = -1 since they are not supported
     metadata_->Finish(num_values_, dictionary_page_offset_, -1, data_page_offset_,
                       total_compressed_size_, total_uncompressed_size_, has_dictionary,
@@ -329,6 +345,12 @@ class SerializedPageWriter : public PageWriter {
         thrift_serializer_->Serialize(&page_header, sink_.get(), meta_encryptor_);
     PARQUET_THROW_NOT_OK(sink_->Write(output_data_buffer, output_data_len));
 
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->AddPage(start_pos,
+                                   static_cast<int32_t>(output_data_len + header_size),
+                                   page.num_values(), page.statistics());
+    }
+
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
     num_values_ += page.num_values();
@@ -379,6 +401,8 @@ class SerializedPageWriter : public PageWriter {
 
   int64_t data_page_offset() { return data_page_offset_; }
 
+  int64_t bloom_filter_offset() { return bloom_filter_offset_; }
+
   int64_t total_compressed_size() { return total_compressed_size_; }
 
   int64_t total_uncompressed_size() { return total_uncompressed_size_; }
@@ -442,6 +466,7 @@ class SerializedPageWriter : public PageWriter {
   int64_t num_values_;
   int64_t dictionary_page_offset_;
   int64_t data_page_offset_;
+  int64_t bloom_filter_offset_;
   int64_t total_uncompressed_size_;
   int64_t total_compressed_size_;
   int16_t page_ordinal_;
@@ -459,6 +484,8 @@ class SerializedPageWriter : public PageWriter {
   std::shared_ptr<Encryptor> meta_encryptor_;
   std::shared_ptr<Encryptor> data_encryptor_;
 
+  PageIndexBuilder* page_index_builder_;
+
   std::shared_ptr<ResizableBuffer> encryption_buffer_;
 
   std::map<Encoding::type, int32_t> dict_encoding_stats_;
@@ -473,13 +500,17 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = ::arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
-      : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     PageIndexBuilder* page_index_builder = nullptr)
+      : final_sink_(std::move(sink)),
+        metadata_(metadata),
+        page_index_builder_(page_index_builder),
+        has_dictionary_pages_(false) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), page_index_builder));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -487,12 +518,22 @@ class BufferedPageWriter : public PageWriter {
     return pager_->WriteDictionaryPage(page);
   }
 
+  void WriteBloomFilter(const BloomFilter& bloom_filter) override {
+    pager_->WriteBloomFilter(bloom_filter);
+  }
+
   void Close(bool has_dictionary, bool fallback) override {
     if (pager_->meta_encryptor_ != nullptr) {
       pager_->UpdateEncryption(encryption::kColumnMetaData);
     }
     // index_page_offset = -1 since they are not supported
     PARQUET_ASSIGN_OR_THROW(int64_t final_position, final_sink_->Tell());
+    if (pager_->bloom_filter_offset() >= 0) {
+      metadata_->SetBloomFilterOffset(pager_->bloom_filter_offset() + final_position);
+    }
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->AddOffset(final_position);
+    }
     // dictionary page offset should be 0 iff there are no dictionary pages
     auto dictionary_page_offset =
         has_dictionary_pages_ ? pager_->dictionary_page_offset() + final_position : 0;
@@ -525,6 +566,7 @@ class BufferedPageWriter : public PageWriter {
   ColumnChunkMetaDataBuilder* metadata_;
   std::shared_ptr<::arrow::io::BufferOutputStream> in_memory_sink_;
   std::unique_ptr<SerializedPageWriter> pager_;
+  PageIndexBuilder* page_index_builder_;
   bool has_dictionary_pages_;
 };
 
@@ -533,17 +575,17 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor, PageIndexBuilder* page_index_builder) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder));
   }
 }
 
@@ -589,6 +631,23 @@ class ColumnWriterImpl {
       compressor_temp_buffer_ =
           std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(allocator_, 0));
     }
+
+    // Bloom filters are stored in plaintext, so they would leak the values of
+    // encrypted columns
+    auto encryption =
+        properties->column_encryption_properties(descr_->path()->ToDotString());
+    if (properties->bloom_filter_enabled(descr_->path()) &&
+        descr_->physical_type() != Type::BOOLEAN &&
+        (encryption == nullptr || !encryption->is_encrypted())) {
+      const auto ndv = static_cast<uint32_t>(
+          std::min<int64_t>(properties->bloom_filter_ndv(descr_->path()),
+                            std::numeric_limits<uint32_t>::max()));
+      const uint32_t num_bits = BlockSplitBloomFilter::OptimalNumOfBits(
+          ndv, properties->bloom_filter_fpp(descr_->path()));
+      bloom_filter_.reset(new BlockSplitBloomFilter());
+      bloom_filter_->Init(num_bits / 8);
+      bloom_filter_hasher_.reset(new MurmurHash3());
+    }
   }
 
   virtual ~ColumnWriterImpl() = default;
@@ -647,6 +706,12 @@ class ColumnWriterImpl {
   // Serialize the buffered Data Pages
   void FlushBufferedDataPages();
 
+  // Serialize the bloom filter of the column chunk if enabled
+  void WriteBloomFilter();
+
+  // Record the hashes of the non-null values of a BinaryArray for the bloom filter
+  void UpdateBloomFilter(const ::arrow::Array& values);
+
   ColumnChunkMetaDataBuilder* metadata_;
   const ColumnDescriptor* descr_;
   // scratch buffer if validity bits need to be recalculated.
@@ -699,6 +764,11 @@ class ColumnWriterImpl {
   std::shared_ptr<ResizableBuffer> uncompressed_data_;
   std::shared_ptr<ResizableBuffer> compressor_temp_buffer_;
 
+  // Null unless a bloom filter is written for this column. The filter is sized
+  // up front for the configured number of distinct values.
+  std::unique_ptr<BlockSplitBloomFilter> bloom_filter_;
+  std::unique_ptr<Hasher> bloom_filter_hasher_;
+
   std::vector<std::unique_ptr<DataPage>> data_pages_;
 
  private:
@@ -895,6 +965,7 @@ int64_t ColumnWriterImpl::Close() {
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
       metadata_->SetStatistics(chunk_statistics);
     }
+    WriteBloomFilter();
     pager_->Close(has_dictionary_, fallback_);
   }
 
@@ -913,6 +984,26 @@ void ColumnWriterImpl::FlushBufferedDataPages() {
   total_compressed_bytes_ = 0;
 }
 
+void ColumnWriterImpl::WriteBloomFilter() {
+  if (bloom_filter_ == nullptr) return;
+
+  pager_->WriteBloomFilter(*bloom_filter_);
+  bloom_filter_.reset();
+}
+
+void ColumnWriterImpl::UpdateBloomFilter(const ::arrow::Array& values) {
+  if (bloom_filter_ == nullptr) return;
+
+  const auto& binary = checked_cast<const ::arrow::BinaryArray&>(values);
+  for (int64_t i = 0; i < binary.length(); ++i) {
+    if (binary.IsNull(i)) continue;
+    auto view = binary.GetView(i);
+    ByteArray value(static_cast<uint32_t>(view.size()),
+                    reinterpret_cast<const uint8_t*>(view.data()));
+    bloom_filter_->InsertHash(bloom_filter_hasher_->Hash(&value));
+  }
+}
+
 // ----------------------------------------------------------------------
 // TypedColumnWriter
 
@@ -960,6 +1051,41 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Hash a value by its plain encoding, as BloomFilter::Hash does
+static inline uint64_t BloomFilterHash(const Hasher& hasher, bool value, int) {
+  return hasher.Hash(static_cast<int32_t>(value));
+}
+
+static inline uint64_t BloomFilterHash(const Hasher& hasher, int32_t value, int) {
+  return hasher.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const Hasher& hasher, int64_t value, int) {
+  return hasher.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const Hasher& hasher, float value, int) {
+  return hasher.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const Hasher& hasher, double value, int) {
+  return hasher.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const Hasher& hasher, const Int96& value, int) {
+  return hasher.Hash(&value);
+}
+
+static inline uint64_t BloomFilterHash(const Hasher& hasher, const ByteArray& value,
+                                       int) {
+  return hasher.Hash(&value);
+}
+
+static inline uint64_t BloomFilterHash(const Hasher& hasher, const FLBA& value,
+                                       int type_length) {
+  return hasher.Hash(&value, static_cast<uint32_t>(type_length));
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -1305,6 +1431,12 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_values; ++i) {
+        bloom_filter_->InsertHash(
+            BloomFilterHash(*bloom_filter_hasher_, values[i], descr_->type_length()));
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1322,6 +1454,17 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      ::arrow::internal::BitmapReader valid_reader(valid_bits, valid_bits_offset,
+                                                   num_spaced_values);
+      for (int64_t i = 0; i < num_spaced_values; ++i) {
+        if (valid_reader.IsSet()) {
+          bloom_filter_->InsertHash(
+              BloomFilterHash(*bloom_filter_hasher_, values[i], descr_->type_length()));
+        }
+        valid_reader.Next();
+      }
+    }
   }
 };
 
@@ -1398,6 +1541,9 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     if (page_statistics_ != nullptr) {
       PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
     }
+    // Likewise the bloom filter may contain unobserved values, which is
+    // harmless since it only guarantees the absence of values
+    UpdateBloomFilter(*dictionary);
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
@@ -1807,6 +1953,7 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    UpdateBloomFilter(*data_slice);
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -22,6 +22,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -890,6 +891,377 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   Put(data, num_valid_values);
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+/// The deltas between consecutive values are buffered in blocks of kBlockSize
+/// and each block is written as kMiniBlocksPerBlock miniblocks bit packed with
+/// their own width. The header holds the total number of values, which is only
+/// known once the page is complete, so FlushValues writes it ahead of the blocks.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  static constexpr uint32_t kBlockSize = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kBlockSize / kMiniBlocksPerBlock;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool), sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderLength + sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* buffer, int num_values) override;
+  void Put(const ::arrow::Array& values) override;
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  using BitReader = ::arrow::BitUtil::BitReader;
+
+  // Block size, number of miniblocks, number of values and first value
+  static constexpr int kMaxHeaderLength =
+      3 * BitReader::kMaxVlqByteLength + BitReader::kMaxVlqByteLengthForInt64;
+  // Min delta, bit widths and the miniblocks packed with up to 64 bits a value
+  static constexpr int kMaxBlockLength = BitReader::kMaxVlqByteLengthForInt64 +
+                                         kMiniBlocksPerBlock + kBlockSize * sizeof(UT);
+
+  void FlushBlock();
+
+  template <typename ArrayType>
+  void PutArrowArray(const ::arrow::Array& values);
+
+  uint32_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  uint32_t values_current_block_ = 0;
+  UT deltas_[kBlockSize];
+  uint8_t block_buffer_[kMaxBlockLength];
+  ::arrow::BufferBuilder sink_;
+};
+
+// BitWriter::PutValue takes at most 32 bits at a time
+static inline void PutPackedValue(::arrow::BitUtil::BitWriter* writer, uint64_t value,
+                                  int num_bits) {
+  if (num_bits > 32) {
+    writer->PutValue(value & 0xFFFFFFFFULL, 32);
+    writer->PutValue(value >> 32, num_bits - 32);
+  } else {
+    writer->PutValue(value, num_bits);
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+  for (; idx < num_values; ++idx) {
+    // Deltas wrap around on overflow, which the decoder undoes
+    deltas_[values_current_block_++] =
+        static_cast<UT>(src[idx]) - static_cast<UT>(current_value_);
+    current_value_ = src[idx];
+    if (values_current_block_ == kBlockSize) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (values_current_block_ == 0) {
+    return;
+  }
+  // Deltas are stored relative to the smallest one so that they are all
+  // non-negative
+  T min_delta = ::arrow::util::SafeCopy<T>(deltas_[0]);
+  for (uint32_t i = 1; i < values_current_block_; ++i) {
+    min_delta = std::min(min_delta, ::arrow::util::SafeCopy<T>(deltas_[i]));
+  }
+
+  ::arrow::BitUtil::BitWriter writer(block_buffer_, kMaxBlockLength);
+  writer.PutZigZagVlqInt(static_cast<int64_t>(min_delta));
+  uint8_t* bit_widths = writer.GetNextBytePtr(kMiniBlocksPerBlock);
+
+  for (uint32_t mini_block = 0; mini_block < kMiniBlocksPerBlock; ++mini_block) {
+    const uint32_t start = mini_block * kValuesPerMiniBlock;
+    if (start >= values_current_block_) {
+      // Unused miniblocks of the last block take no space besides their width
+      bit_widths[mini_block] = 0;
+      continue;
+    }
+    const uint32_t end = std::min(start + kValuesPerMiniBlock, values_current_block_);
+    UT max_delta = 0;
+    for (uint32_t i = start; i < end; ++i) {
+      deltas_[i] -= static_cast<UT>(min_delta);
+      max_delta = std::max(max_delta, deltas_[i]);
+    }
+    // A partially filled miniblock is padded to its full size
+    std::fill(deltas_ + end, deltas_ + start + kValuesPerMiniBlock, UT(0));
+
+    const int bit_width = ::arrow::BitUtil::NumRequiredBits(max_delta);
+    bit_widths[mini_block] = static_cast<uint8_t>(bit_width);
+    if (bit_width > 0) {
+      for (uint32_t i = start; i < start + kValuesPerMiniBlock; ++i) {
+        PutPackedValue(&writer, deltas_[i], bit_width);
+      }
+    }
+  }
+  writer.Flush();
+  PARQUET_THROW_NOT_OK(sink_.Append(block_buffer_, writer.bytes_written()));
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header[kMaxHeaderLength];
+  ::arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderLength);
+  header_writer.PutVlqInt(kBlockSize);
+  header_writer.PutVlqInt(kMiniBlocksPerBlock);
+  header_writer.PutVlqInt(total_value_count_);
+  header_writer.PutZigZagVlqInt(static_cast<int64_t>(first_value_));
+  header_writer.Flush();
+
+  const int64_t header_length = header_writer.bytes_written();
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_length + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_length);
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_length, sink_.data(), sink_.length());
+  }
+
+  sink_.Reset();
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return std::move(buffer);
+}
+
+template <typename DType>
+template <typename ArrayType>
+void DeltaBitPackEncoder<DType>::PutArrowArray(const ::arrow::Array& values) {
+  if (values.type_id() != ArrayType::TypeClass::type_id) {
+    std::string type_name = ArrayType::TypeClass::type_name();
+    throw ParquetException("direct put to " + type_name + " from " +
+                           values.type()->ToString() + " not supported");
+  }
+  const auto& data = checked_cast<const ArrayType&>(values);
+  if (data.null_count() == 0) {
+    Put(data.raw_values(), static_cast<int>(data.length()));
+  } else {
+    PutSpaced(data.raw_values(), static_cast<int>(data.length()),
+              data.null_bitmap_data(), data.offset());
+  }
+}
+
+template <>
+void DeltaBitPackEncoder<Int32Type>::Put(const ::arrow::Array& values) {
+  PutArrowArray<::arrow::Int32Array>(values);
+}
+
+template <>
+void DeltaBitPackEncoder<Int64Type>::Put(const ::arrow::Array& values) {
+  PutArrowArray<::arrow::Int64Array>(values);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::PutSpaced(const T* src, int num_values,
+                                           const uint8_t* valid_bits,
+                                           int64_t valid_bits_offset) {
+  PARQUET_ASSIGN_OR_THROW(
+      auto buffer, arrow::AllocateBuffer(num_values * sizeof(T), this->memory_pool()));
+  T* data = reinterpret_cast<T*>(buffer->mutable_data());
+  int num_valid_values = arrow::util::internal::SpacedCompress<T>(
+      src, num_values, valid_bits, valid_bits_offset, data);
+  Put(data, num_valid_values);
+}
+
+// Calls `visit` with each non-null value of a BinaryArray or StringArray
+template <typename Visitor>
+void VisitBinaryValues(const ::arrow::Array& values, Visitor&& visit) {
+  AssertBinary(values);
+  const auto& data = checked_cast<const ::arrow::BinaryArray&>(values);
+  for (int64_t i = 0; i < data.length(); i++) {
+    if (data.IsValid(i)) {
+      auto view = data.GetView(i);
+      visit(ByteArray(static_cast<uint32_t>(view.size()),
+                      reinterpret_cast<const uint8_t*>(view.data())));
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+/// The lengths of the values are DELTA_BINARY_PACKED, followed by the
+/// concatenated value bytes.
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), lengths->size() + sink_.length());
+    memcpy(buffer->mutable_data(), lengths->data(), lengths->size());
+    if (sink_.length() > 0) {
+      memcpy(buffer->mutable_data() + lengths->size(), sink_.data(), sink_.length());
+    }
+    sink_.Reset();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray& value) {
+    const int32_t length = static_cast<int32_t>(value.len);
+    length_encoder_.Put(&length, 1);
+    PARQUET_THROW_NOT_OK(sink_.Append(value.ptr, value.len));
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    constexpr int kBatchSize = 256;
+    int32_t lengths[kBatchSize];
+    for (int i = 0; i < num_values; i += kBatchSize) {
+      const int batch_size = std::min(kBatchSize, num_values - i);
+      int64_t total_length = 0;
+      for (int j = 0; j < batch_size; ++j) {
+        lengths[j] = static_cast<int32_t>(src[i + j].len);
+        total_length += lengths[j];
+      }
+      length_encoder_.Put(lengths, batch_size);
+      PARQUET_THROW_NOT_OK(sink_.Reserve(total_length));
+      for (int j = 0; j < batch_size; ++j) {
+        sink_.UnsafeAppend(src[i + j].ptr, lengths[j]);
+      }
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    VisitBinaryValues(values, [this](const ByteArray& value) { Put(value); });
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                                  this->memory_pool()));
+    ByteArray* data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+    int num_valid_values = arrow::util::internal::SpacedCompress<ByteArray>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  }
+
+ private:
+  ::arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+/// Each value is stored as the length of the prefix it shares with the
+/// previous value, DELTA_BINARY_PACKED, followed by the remaining suffixes
+/// encoded as DELTA_LENGTH_BYTE_ARRAY.
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer = AllocateBuffer(
+        this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    // Each page starts over without a previous value
+    last_value_.clear();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray& value) {
+    const uint32_t max_prefix_length =
+        std::min(value.len, static_cast<uint32_t>(last_value_.size()));
+    uint32_t prefix_length = 0;
+    while (prefix_length < max_prefix_length &&
+           value.ptr[prefix_length] ==
+               static_cast<uint8_t>(last_value_[prefix_length])) {
+      ++prefix_length;
+    }
+    const int32_t encoded_prefix_length = static_cast<int32_t>(prefix_length);
+    prefix_length_encoder_.Put(&encoded_prefix_length, 1);
+    suffix_encoder_.Put(ByteArray(value.len - prefix_length, value.ptr + prefix_length));
+    last_value_.assign(reinterpret_cast<const char*>(value.ptr), value.len);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(src[i]);
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    VisitBinaryValues(values, [this](const ByteArray& value) { Put(value); });
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                                  this->memory_pool()));
+    ByteArray* data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+    int num_valid_values = arrow::util::internal::SpacedCompress<ByteArray>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -2000,6 +2372,7 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -2010,113 +2383,229 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   }
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    this->num_values_ = num_values;
+    this->len_ = len;
     decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    if (len == 0) {
+      this->num_values_ = 0;
+      return;
+    }
+    InitHeader();
   }
 
   int Decode(T* buffer, int max_values) override {
     return GetInternal(buffer, max_values);
   }
 
+  /// \brief The number of bytes of the page read so far. Once all values are
+  /// decoded, this is where data following the encoded values starts.
+  int bytes_consumed() { return this->len_ - decoder_.bytes_left(); }
+
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int num_valid_values = GetInternal(values.data(), num_values - null_count);
+    if (num_valid_values != num_values - null_count) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    int value_idx = 0;
+    PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() {
+          out->UnsafeAppend(values[value_idx++]);
+          return Status::OK();
+        },
+        [&]() {
+          out->UnsafeAppendNull();
+          return Status::OK();
+        }));
+    return num_valid_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int num_valid_values = GetInternal(values.data(), num_values - null_count);
+    if (num_valid_values != num_values - null_count) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
+    int value_idx = 0;
+    PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { return out->Append(values[value_idx++]); },
+        [&]() { return out->AppendNull(); }));
+    return num_valid_values;
   }
 
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  void InitHeader() {
+    uint32_t values_per_block;
+    uint32_t total_value_count;
+    int64_t first_value;
+    if (!decoder_.GetVlqInt(&values_per_block) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_value_count) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    if (values_per_block == 0 || values_per_block % 128 != 0 ||
+        mini_blocks_per_block_ == 0 || values_per_block % mini_blocks_per_block_ != 0 ||
+        (values_per_block / mini_blocks_per_block_) % 32 != 0 ||
+        total_value_count > static_cast<uint32_t>(INT32_MAX)) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED header");
+    }
+    values_per_mini_block_ = values_per_block / mini_blocks_per_block_;
+    this->num_values_ = static_cast<int>(total_value_count);
+
+    delta_bit_widths_ = AllocateBuffer(pool_, mini_blocks_per_block_);
+    mini_block_values_ = AllocateBuffer(pool_, values_per_mini_block_ * sizeof(UT));
+    last_value_ = static_cast<UT>(first_value);
+    first_value_pending_ = true;
+    // The first block is only read once its deltas are needed
+    mini_block_idx_ = mini_blocks_per_block_;
+    values_current_mini_block_ = 0;
+  }
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+  void InitBlock() {
+    int64_t min_delta;
+    if (!decoder_.GetZigZagVlqInt(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<UT>(min_delta);
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
+  }
+
+  // Unpack all deltas of the next miniblock at once, padding included
+  void InitMiniBlock() {
+    if (mini_block_idx_ == mini_blocks_per_block_) {
+      InitBlock();
+    }
+    const int bit_width = delta_bit_widths_->data()[mini_block_idx_++];
+    if (bit_width > static_cast<int>(sizeof(T) * 8)) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED bit width");
+    }
+    UT* deltas = reinterpret_cast<UT*>(mini_block_values_->mutable_data());
+    const int num_deltas = static_cast<int>(values_per_mini_block_);
+    if (bit_width == 0) {
+      std::fill(deltas, deltas + num_deltas, UT(0));
+    } else if (bit_width <= 32) {
+      if (decoder_.GetBatch(bit_width, deltas, num_deltas) != num_deltas) {
+        ParquetException::EofException();
+      }
+    } else {
+      // BitReader::GetValue reads at most 32 bits at a time
+      for (int i = 0; i < num_deltas; ++i) {
+        uint64_t low, high;
+        if (!decoder_.GetValue(32, &low) || !decoder_.GetValue(bit_width - 32, &high)) {
+          ParquetException::EofException();
+        }
+        deltas[i] = static_cast<UT>(low | (high << 32));
+      }
+    }
     values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
     max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
-          InitBlock();
-          buffer[i] = last_value_;
-          continue;
-        }
+    int i = 0;
+    if (max_values > 0 && first_value_pending_) {
+      buffer[i++] = static_cast<T>(last_value_);
+      first_value_pending_ = false;
+    }
+    // Additions wrap around like the subtractions of the encoder
+    UT value = last_value_;
+    while (i < max_values) {
+      if (values_current_mini_block_ == 0) {
+        InitMiniBlock();
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int batch_size = static_cast<int>(
+          std::min<uint32_t>(values_current_mini_block_, max_values - i));
+      const UT* deltas = reinterpret_cast<const UT*>(mini_block_values_->data()) +
+                         (values_per_mini_block_ - values_current_mini_block_);
+      for (int j = 0; j < batch_size; ++j) {
+        value += min_delta_ + deltas[j];
+        buffer[i + j] = static_cast<T>(value);
+      }
+      i += batch_size;
+      values_current_mini_block_ -= batch_size;
     }
+    last_value_ = value;
     this->num_values_ -= max_values;
     return max_values;
   }
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
+  uint32_t mini_blocks_per_block_;
+  uint32_t values_per_mini_block_;
+  uint32_t values_current_mini_block_;
+  uint32_t mini_block_idx_;
 
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  UT min_delta_;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
+  std::shared_ptr<ResizableBuffer> mini_block_values_;
 
-  int32_t last_value_;
+  UT last_value_;
+  bool first_value_pending_;
 };
 
+// Decode values of a DELTA_LENGTH_BYTE_ARRAY or DELTA_BYTE_ARRAY decoder and
+// append them to a binary builder
+static int DecodeByteArraysArrow(TypedDecoder<ByteArrayType>* decoder, int num_values,
+                                 int null_count, const uint8_t* valid_bits,
+                                 int64_t valid_bits_offset,
+                                 EncodingTraits<ByteArrayType>::Accumulator* out) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int num_valid_values = decoder->Decode(values.data(), num_values - null_count);
+  if (num_valid_values != num_values - null_count) {
+    ParquetException::EofException();
+  }
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  int value_idx = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = values[value_idx++];
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(value.len))) {
+          // This element would exceed the capacity of a chunk
+          RETURN_NOT_OK(helper.PushChunk());
+        }
+        return helper.Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() { return helper.AppendNull(); }));
+  return num_valid_values;
+}
+
+static int DecodeByteArraysArrow(TypedDecoder<ByteArrayType>* decoder, int num_values,
+                                 int null_count, const uint8_t* valid_bits,
+                                 int64_t valid_bits_offset,
+                                 EncodingTraits<ByteArrayType>::DictAccumulator* out) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int num_valid_values = decoder->Decode(values.data(), num_values - null_count);
+  if (num_valid_values != num_values - null_count) {
+    ParquetException::EofException();
+  }
+  PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+  int value_idx = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = values[value_idx++];
+        return out->Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() { return out->AppendNull(); }));
+  return num_valid_values;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2127,28 +2616,34 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        lengths_(AllocateBuffer(pool, 0)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // The value bytes only start after all lengths, so these are decoded upfront
+    len_decoder_.SetData(num_values, data, len);
+    const int num_lengths = len_decoder_.values_left();
+    PARQUET_THROW_NOT_OK(lengths_->Resize(num_lengths * sizeof(int32_t), false));
+    if (len_decoder_.Decode(reinterpret_cast<int32_t*>(lengths_->mutable_data()),
+                            num_lengths) != num_lengths) {
+      ParquetException::EofException();
+    }
+    const int lengths_size = len_decoder_.bytes_consumed();
+    DecoderImpl::SetData(num_lengths, data + lengths_size, len - lengths_size);
+    length_idx_ = 0;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
     max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    const int32_t* lengths = reinterpret_cast<const int32_t*>(lengths_->data());
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths[length_idx_++];
+      if (ARROW_PREDICT_FALSE(length < 0 || length > len_)) {
+        throw ParquetException("Invalid or corrupted DELTA_LENGTH_BYTE_ARRAY length");
+      }
+      buffer[i].len = static_cast<uint32_t>(length);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      this->data_ += length;
+      this->len_ -= length;
     }
     this->num_values_ -= max_values;
     return max_values;
@@ -2157,18 +2652,21 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  std::shared_ptr<ResizableBuffer> lengths_;
+  int length_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2182,46 +2680,98 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        pool_(pool),
+        prefix_lengths_(AllocateBuffer(pool, 0)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    // The suffixes only start after all prefix lengths, so these are decoded
+    // upfront
+    prefix_len_decoder_.SetData(num_values, data, len);
+    const int num_prefixes = prefix_len_decoder_.values_left();
+    PARQUET_THROW_NOT_OK(prefix_lengths_->Resize(num_prefixes * sizeof(int32_t), false));
+    if (prefix_len_decoder_.Decode(
+            reinterpret_cast<int32_t*>(prefix_lengths_->mutable_data()),
+            num_prefixes) != num_prefixes) {
+      ParquetException::EofException();
+    }
+    const int prefix_lengths_size = prefix_len_decoder_.bytes_consumed();
+    suffix_decoder_.SetData(num_values, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+    if (suffix_decoder_.values_left() != num_prefixes) {
+      throw ParquetException(
+          "DELTA_BYTE_ARRAY has different numbers of prefixes and suffixes");
+    }
+    num_values_ = num_prefixes;
+    prefix_idx_ = 0;
+    last_value_ = ByteArray();
+    page_data_.clear();
+  }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+  /// Decoded values point into buffers owned by the decoder, which like the
+  /// page data of other decoders remain valid until the next page.
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
+    const int32_t* prefix_lengths =
+        reinterpret_cast<const int32_t*>(prefix_lengths_->data()) + prefix_idx_;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(prefix_lengths[i] < 0)) {
+        throw ParquetException("Invalid or corrupted DELTA_BYTE_ARRAY prefix length");
+      }
+      data_size += prefix_lengths[i] + buffer[i].len;
+    }
+    std::shared_ptr<ResizableBuffer> data = AllocateBuffer(pool_, data_size);
+    page_data_.push_back(data);
 
-      buffer[i].ptr = result;
+    uint8_t* out = data->mutable_data();
+    for (int i = 0; i < max_values; ++i) {
+      const uint32_t prefix_len = static_cast<uint32_t>(prefix_lengths[i]);
+      if (ARROW_PREDICT_FALSE(prefix_len > last_value_.len)) {
+        throw ParquetException("Invalid or corrupted DELTA_BYTE_ARRAY prefix length");
+      }
+      if (prefix_len > 0) {
+        memcpy(out, last_value_.ptr, prefix_len);
+      }
+      if (buffer[i].len > 0) {
+        memcpy(out + prefix_len, buffer[i].ptr, buffer[i].len);
+      }
+      buffer[i].ptr = out;
+      buffer[i].len += prefix_len;
       last_value_ = buffer[i];
+      out += buffer[i].len;
     }
+    prefix_idx_ += max_values;
     this->num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
+  MemoryPool* pool_;
+  std::shared_ptr<ResizableBuffer> prefix_lengths_;
+  int prefix_idx_ = 0;
+  // The previous value, which the prefix of the next one refers to
   ByteArray last_value_;
+  // The decoded values of the current page
+  std::vector<std::shared_ptr<ResizableBuffer>> page_data_;
 };
 
 // ----------------------------------------------------------------------
@@ -2407,6 +2957,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2447,6 +3017,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
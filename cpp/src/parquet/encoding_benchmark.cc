@@ -517,6 +517,71 @@ static void BM_DictDecodingInt64_literals(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecodingInt64_literals)->Range(MIN_RANGE, MAX_RANGE);
 
+// Increasing values with small random gaps, e.g. timestamps or row ids, for
+// which DELTA_BINARY_PACKED needs only a few bits a value
+template <typename T>
+static std::vector<T> MakeDeltaBitPackValues(int64_t num_values) {
+  std::vector<T> values(num_values);
+  std::default_random_engine gen(1923);
+  std::uniform_int_distribution<int> gap(0, 100);
+  T value = 1000000;
+  for (auto& v : values) {
+    value += static_cast<T>(gap(gen));
+    v = value;
+  }
+  return values;
+}
+
+template <typename DType>
+static void BM_DeltaBitPackEncoding(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values = MakeDeltaBitPackValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename DType>
+static void BM_DeltaBitPackDecoding(benchmark::State& state) {
+  using T = typename DType::c_type;
+  std::vector<T> values = MakeDeltaBitPackValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<DType>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_DeltaBitPackEncodingInt32(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int32Type>(state);
+}
+
+static void BM_DeltaBitPackEncodingInt64(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int64Type>(state);
+}
+
+static void BM_DeltaBitPackDecodingInt32(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int32Type>(state);
+}
+
+static void BM_DeltaBitPackDecodingInt64(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int64Type>(state);
+}
+
+BENCHMARK(BM_DeltaBitPackEncodingInt32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackEncodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Shared benchmarks for decoding using arrow builders
 
@@ -798,4 +863,74 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryDict, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryDict, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY Encoding
+class BenchmarkDeltaByteArray : public BenchmarkDecodeArrow {
+ public:
+  virtual Encoding::type encoding() const = 0;
+
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding());
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding());
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding());
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+class BM_ArrowBinaryDeltaLength : public BenchmarkDeltaByteArray {
+ public:
+  Encoding::type encoding() const override { return Encoding::DELTA_LENGTH_BYTE_ARRAY; }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)
+    ->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dict)
+(benchmark::State& state) { DecodeArrowDictBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dict)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+class BM_ArrowBinaryDelta : public BenchmarkDeltaByteArray {
+ public:
+  Encoding::type encoding() const override { return Encoding::DELTA_BYTE_ARRAY; }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, EncodeLowLevel)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, DecodeArrow_Dense)->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, DecodeArrow_Dict)
+(benchmark::State& state) { DecodeArrowDictBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, DecodeArrow_Dict)->Range(MIN_RANGE, MAX_RANGE);
+
 }  // namespace parquet
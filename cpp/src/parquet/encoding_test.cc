@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -1235,5 +1236,254 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encoding tests
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    int values_decoded = decoder->Decode(decode_buf_, num_values_);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+
+    // Decode again with a step that does not line up with the miniblocks
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    const int step = 47;
+    int remaining = num_values_;
+    for (int i = 0; i < num_values_; i += step) {
+      int num_decoded = decoder->Decode(decode_buf_, step);
+      ASSERT_EQ(num_decoded, std::min(step, remaining));
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, &draws_[i], num_decoded));
+      remaining -= num_decoded;
+    }
+    ASSERT_EQ(0, decoder->Decode(decode_buf_, step));
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_ - null_count, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<T>(decode_buf_, draws_, num_values_,
+                                                   valid_bits, valid_bits_offset));
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Cover partial miniblocks and blocks of 128 values
+  for (int values = 0; values < 300; ++values) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1000, 10));
+
+  for (auto null_prob : {0.001, 0.1, 0.5, 0.9, 0.999}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 0, null_prob));
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 33, null_prob));
+  }
+}
+
+template <typename DType>
+void CheckDeltaBitPackRoundtrip(const std::vector<typename DType::c_type>& values) {
+  auto encoder = MakeTypedEncoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(static_cast<int>(values.size()), buffer->data(),
+                   static_cast<int>(buffer->size()));
+  std::vector<typename DType::c_type> decoded(values.size());
+  ASSERT_EQ(static_cast<int>(values.size()),
+            decoder->Decode(decoded.data(), static_cast<int>(values.size())));
+  ASSERT_EQ(values, decoded);
+}
+
+TEST(DeltaBitPackEncodeDecode, ExtremeValues) {
+  // Deltas that overflow the value type wrap around
+  std::vector<int32_t> int32_values;
+  std::vector<int64_t> int64_values;
+  for (int i = 0; i < 200; ++i) {
+    int32_values.push_back(i % 3 == 0 ? std::numeric_limits<int32_t>::min()
+                                      : std::numeric_limits<int32_t>::max());
+    int64_values.push_back(i % 3 == 0 ? std::numeric_limits<int64_t>::min()
+                                      : std::numeric_limits<int64_t>::max());
+  }
+  ASSERT_NO_FATAL_FAILURE(CheckDeltaBitPackRoundtrip<Int32Type>(int32_values));
+  ASSERT_NO_FATAL_FAILURE(CheckDeltaBitPackRoundtrip<Int64Type>(int64_values));
+
+  // Deltas needing more than 32 bits
+  int64_values.clear();
+  for (int i = 0; i < 200; ++i) {
+    int64_values.push_back((i % 2) * (int64_t(1) << 40) - i);
+  }
+  ASSERT_NO_FATAL_FAILURE(CheckDeltaBitPackRoundtrip<Int64Type>(int64_values));
+}
+
+TEST(DeltaBitPackEncodeDecode, SpecExample) {
+  // The examples of the Parquet format specification
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  const std::vector<int32_t> increasing = {1, 2, 3, 4, 5};
+  encoder->Put(increasing.data(), static_cast<int>(increasing.size()));
+  auto buffer = encoder->FlushValues();
+  ASSERT_EQ(std::vector<uint8_t>({0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0, 0, 0, 0}),
+            std::vector<uint8_t>(buffer->data(), buffer->data() + buffer->size()));
+
+  const std::vector<int32_t> values = {7, 5, 3, 1, 2, 3, 4, 5};
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  buffer = encoder->FlushValues();
+  // Header, min delta -2, bit widths and a miniblock of 2 bit deltas
+  std::vector<uint8_t> expected = {0x80, 0x01, 0x04, 0x08, 0x0e, 0x03, 0x02,
+                                   0x00, 0x00, 0x00, 0xc0, 0x3f};
+  expected.resize(expected.size() + 6, 0);
+  ASSERT_EQ(expected,
+            std::vector<uint8_t>(buffer->data(), buffer->data() + buffer->size()));
+}
+
+TEST(DeltaEncodeDecode, InvalidDataTypes) {
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<FLBAType>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+
+  ASSERT_THROW(MakeTypedDecoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int64Type>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encoding tests
+
+class DeltaByteArrayEncodingBase : public TestArrowBuilderDecoding {
+ public:
+  explicit DeltaByteArrayEncodingBase(Encoding::type encoding) : encoding_(encoding) {}
+
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(encoding_);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(encoding_);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+
+  void CheckDecodeInSteps() {
+    InitTestCase(0.0);
+    std::vector<ByteArray> decoded(37);
+    int offset = 0;
+    while (offset < num_values_) {
+      int num_decoded = decoder_->Decode(decoded.data(), 37);
+      ASSERT_GT(num_decoded, 0);
+      for (int i = 0; i < num_decoded; ++i) {
+        ASSERT_EQ(input_data_[offset + i], decoded[i]);
+      }
+      offset += num_decoded;
+    }
+    ASSERT_EQ(num_values_, offset);
+  }
+
+ protected:
+  Encoding::type encoding_;
+};
+
+class DeltaLengthByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaLengthByteArrayEncoding()
+      : DeltaByteArrayEncodingBase(Encoding::DELTA_LENGTH_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeInSteps) { this->CheckDecodeInSteps(); }
+
+class DeltaByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaByteArrayEncoding() : DeltaByteArrayEncodingBase(Encoding::DELTA_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeInSteps) { this->CheckDecodeInSteps(); }
+
+TEST(DeltaByteArrayEncodeDecode, SharedPrefixes) {
+  const std::vector<std::string> values = {"",       "apple", "applesauce", "apply",
+                                           "banana", "band",  "band",       ""};
+  std::vector<ByteArray> input;
+  for (const auto& value : values) {
+    input.emplace_back(static_cast<uint32_t>(value.size()),
+                       reinterpret_cast<const uint8_t*>(value.data()));
+  }
+  auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  // Each page decodes on its own
+  for (int page = 0; page < 2; ++page) {
+    encoder->Put(input.data(), static_cast<int>(input.size()));
+    auto buffer = encoder->FlushValues();
+    decoder->SetData(static_cast<int>(input.size()), buffer->data(),
+                     static_cast<int>(buffer->size()));
+    std::vector<ByteArray> decoded(input.size());
+    ASSERT_EQ(static_cast<int>(input.size()),
+              decoder->Decode(decoded.data(), static_cast<int>(input.size())));
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(values[i], std::string(reinterpret_cast<const char*>(decoded[i].ptr),
+                                       decoded[i].len));
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
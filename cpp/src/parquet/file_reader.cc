@@ -23,10 +23,14 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
@@ -38,6 +42,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -83,6 +88,36 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnBloomFilter(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetOffsetIndex(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -116,6 +151,45 @@ arrow::io::ReadRange ComputeColumnChunkRange(FileMetaData* file_metadata,
   return {col_start, col_length};
 }
 
+// The data pages of a row group selected by ParquetFileReader::SelectRows
+struct RowGroupPageSelection {
+  RowRanges rows;
+  // The offset index of every column chunk of the row group
+  std::vector<std::unique_ptr<OffsetIndex>> offset_indexes;
+};
+
+/// Compute the sections of the file holding the dictionary page, if any, and
+/// the data pages of a column chunk which hold selected rows. Adjacent pages
+/// are coalesced.
+std::vector<arrow::io::ReadRange> ComputeSelectedPageRanges(
+    const ColumnChunkMetaData& column_metadata, const OffsetIndex& offset_index,
+    const RowRanges& rows, int64_t num_rows, int64_t* num_values) {
+  std::vector<arrow::io::ReadRange> ranges;
+  *num_values = 0;
+  const auto& locations = offset_index.page_locations();
+  if (locations.empty()) {
+    return ranges;
+  }
+  const int64_t dictionary_page_offset = column_metadata.dictionary_page_offset();
+  if (column_metadata.has_dictionary_page() && dictionary_page_offset > 0 &&
+      dictionary_page_offset < locations[0].offset) {
+    ranges.push_back(
+        {dictionary_page_offset, locations[0].offset - dictionary_page_offset});
+  }
+  for (int page : offset_index.SelectPages(rows, num_rows)) {
+    const PageLocation& location = locations[page];
+    if (!ranges.empty() &&
+        ranges.back().offset + ranges.back().length == location.offset) {
+      ranges.back().length += location.compressed_page_size;
+    } else {
+      ranges.push_back({location.offset, location.compressed_page_size});
+    }
+    *num_values += offset_index.page_last_row(page, num_rows) -
+                   location.first_row_index + 1;
+  }
+  return ranges;
+}
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
@@ -123,14 +197,16 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                      std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source,
                      int64_t source_size, FileMetaData* file_metadata,
                      int row_group_number, const ReaderProperties& props,
-                     std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr)
+                     std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr,
+                     std::shared_ptr<const RowGroupPageSelection> selection = nullptr)
       : source_(std::move(source)),
         cached_source_(std::move(cached_source)),
         source_size_(source_size),
         file_metadata_(file_metadata),
         properties_(props),
         row_group_ordinal_(row_group_number),
-        file_decryptor_(file_decryptor) {
+        file_decryptor_(file_decryptor),
+        selection_(std::move(selection)) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -142,6 +218,10 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
 
+    if (selection_ != nullptr) {
+      return GetSelectedPageReader(*col, i);
+    }
+
     arrow::io::ReadRange col_range =
         ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
     std::shared_ptr<ArrowInputStream> stream;
@@ -199,7 +279,98 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+
+    // The bitset is preceded by its length, hash strategy and algorithm
+    constexpr int64_t kBloomFilterHeaderSize = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    if (offset < 0 || offset + kBloomFilterHeaderSize > source_size_) {
+      throw ParquetException("Invalid bloom filter offset in column chunk metadata");
+    }
+
+    PARQUET_ASSIGN_OR_THROW(auto header, source_->ReadAt(offset, kBloomFilterHeaderSize));
+    if (header->size() != kBloomFilterHeaderSize) {
+      throw ParquetException("Failed reading the bloom filter of a column chunk");
+    }
+    const auto num_bytes = ::arrow::util::SafeLoadAs<uint32_t>(header->data());
+    if (num_bytes > BloomFilter::kMaximumBloomFilterBytes ||
+        offset + kBloomFilterHeaderSize + num_bytes > source_size_) {
+      throw ParquetException("Invalid bloom filter size in column chunk");
+    }
+
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            source_->ReadAt(offset, kBloomFilterHeaderSize + num_bytes));
+    ::arrow::io::BufferReader stream(buffer);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
+  }
+
+  // The page index of encrypted columns is not supported
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index() || col->crypto_metadata()) {
+      return nullptr;
+    }
+    auto buffer = ReadPageIndex(col->column_index_offset(), col->column_index_length());
+    return ColumnIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index() || col->crypto_metadata()) {
+      return nullptr;
+    }
+    auto buffer = ReadPageIndex(col->offset_index_offset(), col->offset_index_length());
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
  private:
+  std::shared_ptr<Buffer> ReadPageIndex(int64_t offset, int32_t length) {
+    if (offset < 0 || length <= 0 || offset + length > source_size_) {
+      throw ParquetException("Invalid page index location in column chunk metadata");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(offset, length));
+    if (buffer->size() != length) {
+      throw ParquetException("Failed reading the page index of a column chunk");
+    }
+    return buffer;
+  }
+
+  // A PageReader over the dictionary page and the selected data pages only
+  std::unique_ptr<PageReader> GetSelectedPageReader(const ColumnChunkMetaData& col,
+                                                    int i) {
+    int64_t num_values = 0;
+    auto ranges = ComputeSelectedPageRanges(col, *selection_->offset_indexes[i],
+                                            selection_->rows,
+                                            row_group_metadata_->num_rows(), &num_values);
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    for (const auto& range : ranges) {
+      std::shared_ptr<Buffer> buffer;
+      if (cached_source_) {
+        PARQUET_ASSIGN_OR_THROW(buffer, cached_source_->Read(range));
+      } else {
+        PARQUET_ASSIGN_OR_THROW(buffer, source_->ReadAt(range.offset, range.length));
+      }
+      if (buffer->size() != range.length) {
+        throw ParquetException("Failed reading the selected pages of a column chunk");
+      }
+      buffers.push_back(std::move(buffer));
+    }
+    std::shared_ptr<Buffer> pages;
+    if (buffers.size() == 1) {
+      pages = std::move(buffers[0]);
+    } else {
+      PARQUET_ASSIGN_OR_THROW(
+          pages, ::arrow::ConcatenateBuffers(buffers, properties_.memory_pool()));
+    }
+    return PageReader::Open(std::make_shared<::arrow::io::BufferReader>(pages),
+                            num_values, col.compression(), properties_.memory_pool());
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
   std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
@@ -209,6 +380,8 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   ReaderProperties properties_;
   int row_group_ordinal_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  // Null unless ParquetFileReader::SelectRows was called for this row group
+  std::shared_ptr<const RowGroupPageSelection> selection_;
 };
 
 // ----------------------------------------------------------------------
@@ -237,9 +410,10 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, cached_source_, source_size_,
-                               file_metadata_.get(), i, properties_, file_decryptor_));
+    auto it = row_group_selections_.find(i);
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, cached_source_, source_size_, file_metadata_.get(), i, properties_,
+        file_decryptor_, it == row_group_selections_.end() ? nullptr : it->second));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
@@ -257,14 +431,68 @@ class SerializedFile : public ParquetFileReader::Contents {
         std::make_shared<arrow::io::internal::ReadRangeCache>(source_, ctx, options);
     std::vector<arrow::io::ReadRange> ranges;
     for (int row : row_groups) {
+      auto it = row_group_selections_.find(row);
       for (int col : column_indices) {
-        ranges.push_back(
-            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+        if (it == row_group_selections_.end()) {
+          ranges.push_back(
+              ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+          continue;
+        }
+        auto row_group_metadata = file_metadata_->RowGroup(row);
+        int64_t num_values = 0;
+        auto page_ranges = ComputeSelectedPageRanges(
+            *row_group_metadata->ColumnChunk(col), *it->second->offset_indexes[col],
+            it->second->rows, row_group_metadata->num_rows(), &num_values);
+        ranges.insert(ranges.end(), page_ranges.begin(), page_ranges.end());
       }
     }
     PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
   }
 
+  RowRanges SelectRows(int i, const RowRanges& rows) {
+    row_group_selections_.erase(i);
+    auto row_group_metadata = file_metadata_->RowGroup(i);
+    const int64_t num_rows = row_group_metadata->num_rows();
+    const RowRanges all_rows = RowRanges::All(num_rows);
+
+    auto selection = std::make_shared<RowGroupPageSelection>();
+    SerializedRowGroup row_group(source_, nullptr, source_size_, file_metadata_.get(), i,
+                                 properties_, file_decryptor_);
+    for (int col = 0; col < row_group_metadata->num_columns(); ++col) {
+      auto column_metadata = row_group_metadata->ColumnChunk(col);
+      if (column_metadata->crypto_metadata() ||
+          row_group_metadata->schema()->Column(col)->max_repetition_level() > 0) {
+        return all_rows;
+      }
+      auto offset_index = row_group.GetOffsetIndex(col);
+      if (offset_index == nullptr) {
+        return all_rows;
+      }
+      selection->offset_indexes.push_back(std::move(offset_index));
+    }
+
+    // Widen the selection to whole pages until every column agrees on it
+    RowRanges selected = rows.Intersect(all_rows);
+    bool widened = true;
+    while (widened) {
+      widened = false;
+      for (const auto& offset_index : selection->offset_indexes) {
+        RowRanges page_rows = offset_index->PageRows(
+            offset_index->SelectPages(selected, num_rows), num_rows);
+        if (page_rows.num_rows() > selected.num_rows()) {
+          selected = std::move(page_rows);
+          widened = true;
+        }
+      }
+    }
+    if (selected.num_rows() == num_rows) {
+      return all_rows;
+    }
+    selection->rows = selected;
+    row_group_selections_[i] = std::move(selection);
+    return selected;
+  }
+
   void ParseMetaData() {
     if (source_size_ == 0) {
       throw ParquetInvalidOrCorruptedFileException("Parquet file size is 0 bytes");
@@ -320,6 +548,8 @@ class SerializedFile : public ParquetFileReader::Contents {
   int64_t source_size_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
+  std::unordered_map<int, std::shared_ptr<const RowGroupPageSelection>>
+      row_group_selections_;
 
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
 
@@ -602,6 +832,19 @@ void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
   file->PreBuffer(row_groups, column_indices, ctx, options);
 }
 
+RowRanges ParquetFileReader::SelectRows(int row_group, const RowRanges& rows) {
+  if (row_group >= metadata()->num_row_groups()) {
+    std::stringstream ss;
+    ss << "Trying to select rows of row group " << row_group << " but file only has "
+       << metadata()->num_row_groups() << " row groups";
+    throw ParquetException(ss.str());
+  }
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  return file->SelectRows(row_group, rows);
+}
+
 // ----------------------------------------------------------------------
 // File metadata helpers
 
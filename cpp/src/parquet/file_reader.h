@@ -23,7 +23,9 @@
 #include <vector>
 
 #include "arrow/io/caching.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/metadata.h"  // IWYU pragma: keep
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
@@ -45,6 +47,9 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) { return NULLPTR; }
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i) { return NULLPTR; }
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) { return NULLPTR; }
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +63,15 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the bloom filter of the indicated row group-relative column. Returns
+  // null if the column chunk has no bloom filter.
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  // Read the page index of the indicated row group-relative column. Each
+  // returns null if the column chunk has no such index.
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -141,6 +155,22 @@ class PARQUET_EXPORT ParquetFileReader {
                  const ::arrow::io::AsyncContext& ctx,
                  const ::arrow::io::CacheOptions& options);
 
+  /// Restrict the reads of a row group to the data pages holding the given
+  /// row group-relative rows.
+  ///
+  /// Column readers of the row group then skip the other pages without
+  /// reading or decoding them. Since pages of different columns do not
+  /// share boundaries, the selection is widened to whole pages of every
+  /// column so that all columns yield the same rows; the widened selection
+  /// is returned. Rows outside of it are omitted from the values read.
+  ///
+  /// The selection is ignored, and all rows are returned, unless every
+  /// column chunk of the row group has an offset index and neither is
+  /// encrypted nor has repeated values. Readers created before the call
+  /// are unaffected. Call this before \a PreBuffer() so that only the
+  /// selected pages get buffered.
+  RowRanges SelectRows(int row_group, const RowRanges& rows);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -24,7 +24,9 @@
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
+#include "parquet/statistics.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
 
@@ -411,6 +413,188 @@ TEST(TestBufferedRowGroupWriter, MultiPageDisabledDictionary) {
   }
 }
 
+void CheckBloomFilterRoundtrip(bool buffered_row_group) {
+  constexpr int kValueCount = 1000;
+  auto sink = CreateOutputStream();
+  auto writer_props = WriterProperties::Builder().enable_bloom_filter("id")->build();
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("id", Repetition::OPTIONAL, Type::INT64));
+  fields.push_back(PrimitiveNode::Make("name", Repetition::REQUIRED, Type::BYTE_ARRAY));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = ParquetFileWriter::Open(sink, schema, writer_props);
+
+  std::vector<int64_t> ids;
+  std::vector<int16_t> def_levels;
+  std::vector<ByteArray> names;
+  for (int i = 0; i < kValueCount; ++i) {
+    ids.push_back(i * 2);
+    def_levels.push_back(i % 10 == 0 ? 0 : 1);
+    names.push_back(ByteArray("name"));
+  }
+
+  RowGroupWriter* rg_writer = buffered_row_group ? file_writer->AppendBufferedRowGroup()
+                                                 : file_writer->AppendRowGroup();
+  auto id_writer = static_cast<Int64Writer*>(
+      buffered_row_group ? rg_writer->column(0) : rg_writer->NextColumn());
+  id_writer->WriteBatch(kValueCount, def_levels.data(), nullptr, ids.data());
+  auto name_writer = static_cast<ByteArrayWriter*>(
+      buffered_row_group ? rg_writer->column(1) : rg_writer->NextColumn());
+  name_writer->WriteBatch(kValueCount, nullptr, nullptr, names.data());
+  rg_writer->Close();
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+  auto file_reader = ParquetFileReader::Open(source);
+  auto rg_reader = file_reader->RowGroup(0);
+  ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+  ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_bloom_filter());
+  ASSERT_EQ(nullptr, rg_reader->GetColumnBloomFilter(1));
+
+  std::unique_ptr<BloomFilter> bloom_filter = rg_reader->GetColumnBloomFilter(0);
+  ASSERT_NE(nullptr, bloom_filter);
+  int false_positives = 0;
+  for (int i = 0; i < kValueCount; ++i) {
+    // Null slots don't reach the filter; odd values were never written
+    if (def_levels[i] == 1) {
+      ASSERT_TRUE(bloom_filter->FindHash(bloom_filter->Hash(ids[i])));
+    }
+    if (bloom_filter->FindHash(bloom_filter->Hash(ids[i] + 1))) {
+      ++false_positives;
+    }
+  }
+  ASSERT_LT(false_positives, kValueCount / 10);
+
+  // The column chunk is still readable past its bloom filter
+  auto id_reader = std::static_pointer_cast<Int64Reader>(rg_reader->Column(0));
+  std::vector<int64_t> ids_out(kValueCount);
+  std::vector<int16_t> def_levels_out(kValueCount);
+  int64_t values_read;
+  ASSERT_EQ(kValueCount, id_reader->ReadBatch(kValueCount, def_levels_out.data(),
+                                              nullptr, ids_out.data(), &values_read));
+  ASSERT_EQ(def_levels, def_levels_out);
+}
+
+TEST(ParquetRoundtrip, BloomFilter) { CheckBloomFilterRoundtrip(false); }
+
+TEST(ParquetRoundtrip, BufferedBloomFilter) { CheckBloomFilterRoundtrip(true); }
+
+void CheckPageIndexRoundtrip(bool buffered_row_group) {
+  constexpr int kValueCount = 1000;
+  auto sink = CreateOutputStream();
+  auto writer_props = WriterProperties::Builder()
+                          .enable_page_index()
+                          ->disable_dictionary("id")
+                          ->data_pagesize(512)
+                          ->write_batch_size(50)
+                          ->build();
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("id", Repetition::REQUIRED, Type::INT64));
+  fields.push_back(PrimitiveNode::Make("value", Repetition::OPTIONAL, Type::INT32));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = ParquetFileWriter::Open(sink, schema, writer_props);
+
+  std::vector<int64_t> ids;
+  std::vector<int32_t> values;
+  std::vector<int16_t> def_levels;
+  for (int i = 0; i < kValueCount; ++i) {
+    ids.push_back(i);
+    def_levels.push_back(i % 10 == 0 ? 0 : 1);
+    if (def_levels.back() == 1) {
+      values.push_back(i % 7);
+    }
+  }
+
+  RowGroupWriter* rg_writer = buffered_row_group ? file_writer->AppendBufferedRowGroup()
+                                                 : file_writer->AppendRowGroup();
+  auto id_writer = static_cast<Int64Writer*>(
+      buffered_row_group ? rg_writer->column(0) : rg_writer->NextColumn());
+  id_writer->WriteBatch(kValueCount, nullptr, nullptr, ids.data());
+  auto value_writer = static_cast<Int32Writer*>(
+      buffered_row_group ? rg_writer->column(1) : rg_writer->NextColumn());
+  value_writer->WriteBatch(kValueCount, def_levels.data(), nullptr, values.data());
+  rg_writer->Close();
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+  auto file_reader = ParquetFileReader::Open(source);
+  auto rg_reader = file_reader->RowGroup(0);
+  auto id_metadata = rg_reader->metadata()->ColumnChunk(0);
+  ASSERT_TRUE(id_metadata->has_column_index());
+  ASSERT_TRUE(id_metadata->has_offset_index());
+
+  // The id of the first row of each page is the minimum of the page
+  std::unique_ptr<OffsetIndex> offset_index = rg_reader->GetOffsetIndex(0);
+  std::unique_ptr<ColumnIndex> column_index = rg_reader->GetColumnIndex(0);
+  ASSERT_NE(nullptr, offset_index);
+  ASSERT_NE(nullptr, column_index);
+  const auto& locations = offset_index->page_locations();
+  ASSERT_GT(locations.size(), 2);
+  ASSERT_EQ(static_cast<int>(locations.size()), column_index->num_pages());
+  ASSERT_EQ(id_metadata->data_page_offset(), locations[0].offset);
+  for (int page = 0; page < column_index->num_pages(); ++page) {
+    ASSERT_FALSE(column_index->null_pages()[page]);
+    auto stats = std::static_pointer_cast<Int64Statistics>(Statistics::Make(
+        rg_reader->metadata()->schema()->Column(0),
+        column_index->encoded_min_values()[page],
+        column_index->encoded_max_values()[page], 0, 0, 0, true));
+    ASSERT_EQ(locations[page].first_row_index, stats->min());
+    ASSERT_EQ(offset_index->page_last_row(page, kValueCount), stats->max());
+  }
+  ASSERT_NE(nullptr, rg_reader->GetOffsetIndex(1));
+
+  // Only the pages holding the selected rows are read
+  RowRanges selected =
+      file_reader->SelectRows(0, RowRanges(std::vector<RowRanges::Range>{{400, 420}}));
+  ASSERT_EQ(1, selected.ranges().size());
+  const int64_t first = selected.ranges()[0].first;
+  const int64_t num_rows = selected.num_rows();
+  ASSERT_LE(first, 400);
+  ASSERT_GE(first + num_rows - 1, 420);
+  ASSERT_LT(num_rows, kValueCount);
+
+  rg_reader = file_reader->RowGroup(0);
+  auto id_reader = std::static_pointer_cast<Int64Reader>(rg_reader->Column(0));
+  std::vector<int64_t> ids_out(kValueCount);
+  int64_t rows_read = 0, values_read;
+  while (id_reader->HasNext()) {
+    rows_read += id_reader->ReadBatch(kValueCount - rows_read, nullptr, nullptr,
+                                      ids_out.data() + rows_read, &values_read);
+  }
+  ASSERT_EQ(num_rows, rows_read);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ASSERT_EQ(first + i, ids_out[i]);
+  }
+
+  auto value_reader = std::static_pointer_cast<Int32Reader>(rg_reader->Column(1));
+  std::vector<int32_t> values_out(kValueCount);
+  std::vector<int16_t> def_levels_out(kValueCount);
+  int64_t num_values = 0;
+  rows_read = 0;
+  while (value_reader->HasNext()) {
+    rows_read += value_reader->ReadBatch(
+        kValueCount - rows_read, def_levels_out.data() + rows_read, nullptr,
+        values_out.data() + num_values, &values_read);
+    num_values += values_read;
+  }
+  ASSERT_EQ(num_rows, rows_read);
+  int64_t value_index = 0;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    const int64_t id = first + i;
+    ASSERT_EQ(def_levels[id], def_levels_out[i]);
+    if (def_levels_out[i] == 1) {
+      ASSERT_EQ(id % 7, values_out[value_index++]);
+    }
+  }
+}
+
+TEST(ParquetRoundtrip, PageIndex) { CheckPageIndexRoundtrip(false); }
+
+TEST(ParquetRoundtrip, BufferedPageIndex) { CheckPageIndexRoundtrip(true); }
+
 TEST(ParquetRoundtrip, AllNulls) {
   auto primitive_node =
       PrimitiveNode::Make("nulls", Repetition::OPTIONAL, nullptr, Type::INT32);
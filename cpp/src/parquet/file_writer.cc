@@ -28,6 +28,7 @@
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -83,7 +84,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     std::vector<std::unique_ptr<PageIndexBuilder>>*
+                         page_index_builders = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -93,7 +96,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_index_builders_(page_index_builders) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -138,7 +142,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        NextPageIndexBuilder(col_meta->descr()));
     column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
     return column_writers_[0].get();
   }
@@ -208,6 +213,18 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  // One entry per column chunk of this row group, null for columns without a
+  // page index. Null if no page index is written.
+  std::vector<std::unique_ptr<PageIndexBuilder>>* page_index_builders_;
+
+  PageIndexBuilder* NextPageIndexBuilder(const ColumnDescriptor* descr) {
+    if (page_index_builders_ == nullptr) {
+      return nullptr;
+    }
+    page_index_builders_->emplace_back(
+        descr->max_repetition_level() == 0 ? new PageIndexBuilder() : nullptr);
+    return page_index_builders_->back().get();
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -245,7 +262,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
           static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          buffered_row_group_, meta_encryptor, data_encryptor,
+          NextPageIndexBuilder(col_meta->descr()));
       column_writers_.push_back(
           ColumnWriter::Make(col_meta, std::move(pager), properties_));
     }
@@ -288,6 +306,7 @@ class FileSerializer : public ParquetFileWriter::Contents {
       auto file_encryption_properties = properties_->file_encryption_properties();
 
       if (file_encryption_properties == nullptr) {  // Non encrypted file.
+        WritePageIndex();
         file_metadata_ = metadata_->Finish();
         WriteFileMetaData(*file_metadata_, sink_.get());
       } else {  // Encrypted file
@@ -312,9 +331,14 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
+    std::vector<std::unique_ptr<PageIndexBuilder>>* page_index_builders = nullptr;
+    if (properties_->page_index_enabled() && file_encryptor_ == nullptr) {
+      page_index_builders_.emplace_back();
+      page_index_builders = &page_index_builders_.back();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), page_index_builders));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -378,6 +402,34 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
   }
 
+  // Write the ColumnIndex of every column chunk, followed by their
+  // OffsetIndex, between the last row group and the footer
+  void WritePageIndex() {
+    for (size_t rg = 0; rg < page_index_builders_.size(); ++rg) {
+      for (size_t col = 0; col < page_index_builders_[rg].size(); ++col) {
+        const auto& builder = page_index_builders_[rg][col];
+        if (builder && builder->has_column_index()) {
+          PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+          int64_t length = builder->WriteColumnIndex(sink_.get());
+          metadata_->SetColumnIndexLocation(static_cast<int>(rg), static_cast<int>(col),
+                                            offset, static_cast<int32_t>(length));
+        }
+      }
+    }
+    for (size_t rg = 0; rg < page_index_builders_.size(); ++rg) {
+      for (size_t col = 0; col < page_index_builders_[rg].size(); ++col) {
+        const auto& builder = page_index_builders_[rg][col];
+        if (builder) {
+          PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+          int64_t length = builder->WriteOffsetIndex(sink_.get());
+          metadata_->SetOffsetIndexLocation(static_cast<int>(rg), static_cast<int>(col),
+                                            offset, static_cast<int32_t>(length));
+        }
+      }
+    }
+    page_index_builders_.clear();
+  }
+
   std::shared_ptr<ArrowOutputStream> sink_;
   bool is_open_;
   const std::shared_ptr<WriterProperties> properties_;
@@ -386,6 +438,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
   std::unique_ptr<FileMetaDataBuilder> metadata_;
   // Only one of the row group writers is active at a time
   std::unique_ptr<RowGroupWriter> row_group_writer_;
+  // The page index of the column chunks of every row group, written on Close
+  std::vector<std::vector<std::unique_ptr<PageIndexBuilder>>> page_index_builders_;
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
 
@@ -0,0 +1,235 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// RowRanges
+
+RowRanges::RowRanges(std::vector<Range> ranges) {
+  std::sort(ranges.begin(), ranges.end(),
+            [](const Range& l, const Range& r) { return l.first < r.first; });
+  for (const Range& range : ranges) {
+    if (range.first > range.last) {
+      continue;
+    }
+    if (!ranges_.empty() && range.first <= ranges_.back().last + 1) {
+      ranges_.back().last = std::max(ranges_.back().last, range.last);
+    } else {
+      ranges_.push_back(range);
+    }
+  }
+}
+
+RowRanges RowRanges::All(int64_t num_rows) {
+  return RowRanges(std::vector<Range>{{0, num_rows - 1}});
+}
+
+int64_t RowRanges::num_rows() const {
+  int64_t num_rows = 0;
+  for (const Range& range : ranges_) {
+    num_rows += range.last - range.first + 1;
+  }
+  return num_rows;
+}
+
+bool RowRanges::Overlaps(int64_t first, int64_t last) const {
+  // The first range ending at or after `first`
+  auto it = std::lower_bound(
+      ranges_.begin(), ranges_.end(), first,
+      [](const Range& range, int64_t row) { return range.last < row; });
+  return it != ranges_.end() && it->first <= last;
+}
+
+RowRanges RowRanges::Union(const RowRanges& other) const {
+  std::vector<Range> ranges = ranges_;
+  ranges.insert(ranges.end(), other.ranges_.begin(), other.ranges_.end());
+  return RowRanges(std::move(ranges));
+}
+
+RowRanges RowRanges::Intersect(const RowRanges& other) const {
+  RowRanges result;
+  size_t i = 0, j = 0;
+  while (i < ranges_.size() && j < other.ranges_.size()) {
+    const Range& l = ranges_[i];
+    const Range& r = other.ranges_[j];
+    const int64_t first = std::max(l.first, r.first);
+    const int64_t last = std::min(l.last, r.last);
+    if (first <= last) {
+      result.ranges_.push_back({first, last});
+    }
+    if (l.last < r.last) {
+      ++i;
+    } else {
+      ++j;
+    }
+  }
+  return result;
+}
+
+// ----------------------------------------------------------------------
+// OffsetIndex
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+  std::vector<PageLocation> locations;
+  locations.reserve(offset_index.page_locations.size());
+  int64_t previous_first_row = -1;
+  for (const auto& location : offset_index.page_locations) {
+    if (location.offset < 0 || location.compressed_page_size <= 0 ||
+        location.first_row_index <= previous_first_row ||
+        (previous_first_row == -1 && location.first_row_index != 0)) {
+      throw ParquetException("Invalid page location in offset index");
+    }
+    previous_first_row = location.first_row_index;
+    locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(std::move(locations)));
+}
+
+int64_t OffsetIndex::page_last_row(int page, int64_t num_rows) const {
+  if (page + 1 < static_cast<int>(page_locations_.size())) {
+    return page_locations_[page + 1].first_row_index - 1;
+  }
+  return num_rows - 1;
+}
+
+std::vector<int> OffsetIndex::SelectPages(const RowRanges& rows,
+                                          int64_t num_rows) const {
+  std::vector<int> pages;
+  for (int page = 0; page < static_cast<int>(page_locations_.size()); ++page) {
+    if (rows.Overlaps(page_locations_[page].first_row_index,
+                      page_last_row(page, num_rows))) {
+      pages.push_back(page);
+    }
+  }
+  return pages;
+}
+
+RowRanges OffsetIndex::PageRows(const std::vector<int>& pages, int64_t num_rows) const {
+  std::vector<RowRanges::Range> ranges;
+  ranges.reserve(pages.size());
+  for (int page : pages) {
+    ranges.push_back(
+        {page_locations_[page].first_row_index, page_last_row(page, num_rows)});
+  }
+  return RowRanges(std::move(ranges));
+}
+
+// ----------------------------------------------------------------------
+// ColumnIndex
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+  const size_t num_pages = column_index.null_pages.size();
+  if (column_index.min_values.size() != num_pages ||
+      column_index.max_values.size() != num_pages ||
+      (column_index.__isset.null_counts &&
+       column_index.null_counts.size() != num_pages)) {
+    throw ParquetException("Inconsistent number of pages in column index");
+  }
+  std::vector<int64_t> null_counts;
+  if (column_index.__isset.null_counts) {
+    null_counts = std::move(column_index.null_counts);
+  }
+  return std::unique_ptr<ColumnIndex>(new ColumnIndex(
+      std::move(column_index.null_pages), std::move(column_index.min_values),
+      std::move(column_index.max_values), std::move(null_counts)));
+}
+
+ColumnIndex::ColumnIndex(std::vector<bool> null_pages,
+                         std::vector<std::string> encoded_min_values,
+                         std::vector<std::string> encoded_max_values,
+                         std::vector<int64_t> null_counts)
+    : null_pages_(std::move(null_pages)),
+      min_values_(std::move(encoded_min_values)),
+      max_values_(std::move(encoded_max_values)),
+      null_counts_(std::move(null_counts)) {}
+
+// ----------------------------------------------------------------------
+// PageIndexBuilder
+
+void PageIndexBuilder::AddPage(int64_t offset, int32_t compressed_page_size,
+                               int64_t num_rows, const EncodedStatistics& stats) {
+  locations_.push_back({offset, compressed_page_size, num_rows_});
+  num_rows_ += num_rows;
+
+  has_null_counts_ = has_null_counts_ && stats.has_null_count;
+  null_counts_.push_back(stats.null_count);
+  if (stats.has_null_count && stats.null_count == num_rows) {
+    null_pages_.push_back(true);
+    min_values_.emplace_back();
+    max_values_.emplace_back();
+  } else if (stats.has_min && stats.has_max) {
+    null_pages_.push_back(false);
+    min_values_.push_back(stats.min());
+    max_values_.push_back(stats.max());
+  } else {
+    has_column_index_ = false;
+  }
+}
+
+void PageIndexBuilder::AddOffset(int64_t base_offset) {
+  for (PageLocation& location : locations_) {
+    location.offset += base_offset;
+  }
+}
+
+int64_t PageIndexBuilder::WriteColumnIndex(ArrowOutputStream* sink) const {
+  DCHECK(has_column_index());
+  format::ColumnIndex column_index;
+  column_index.__set_null_pages(null_pages_);
+  column_index.__set_min_values(min_values_);
+  column_index.__set_max_values(max_values_);
+  column_index.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+  if (has_null_counts_) {
+    column_index.__set_null_counts(null_counts_);
+  }
+  ThriftSerializer serializer;
+  return serializer.Serialize(&column_index, sink);
+}
+
+int64_t PageIndexBuilder::WriteOffsetIndex(ArrowOutputStream* sink) const {
+  format::OffsetIndex offset_index;
+  for (const PageLocation& location : locations_) {
+    format::PageLocation thrift_location;
+    thrift_location.__set_offset(location.offset);
+    thrift_location.__set_compressed_page_size(location.compressed_page_size);
+    thrift_location.__set_first_row_index(location.first_row_index);
+    offset_index.page_locations.push_back(thrift_location);
+  }
+  ThriftSerializer serializer;
+  return serializer.Serialize(&offset_index, sink);
+}
+
+}  // namespace parquet
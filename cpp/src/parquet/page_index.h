@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class EncodedStatistics;
+
+/// \brief The location of a data page within a file
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index of the first row of the page within its row group
+  int64_t first_row_index;
+};
+
+/// \brief A sorted set of disjoint row ranges within a row group
+class PARQUET_EXPORT RowRanges {
+ public:
+  /// \brief An inclusive range of row indices
+  struct Range {
+    int64_t first;
+    int64_t last;
+  };
+
+  RowRanges() = default;
+
+  /// \brief Construct from possibly unsorted and overlapping ranges
+  explicit RowRanges(std::vector<Range> ranges);
+
+  /// \brief All rows of a row group with the given number of rows
+  static RowRanges All(int64_t num_rows);
+
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  bool empty() const { return ranges_.empty(); }
+
+  /// \brief The number of rows in the set
+  int64_t num_rows() const;
+
+  /// \brief Whether any row in [first, last] is in the set
+  bool Overlaps(int64_t first, int64_t last) const;
+
+  RowRanges Union(const RowRanges& other) const;
+  RowRanges Intersect(const RowRanges& other) const;
+
+ private:
+  std::vector<Range> ranges_;
+};
+
+/// \brief The page locations of a column chunk (the OffsetIndex of the
+/// Parquet format)
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize a Thrift encoded OffsetIndex. Throws on error.
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  explicit OffsetIndex(std::vector<PageLocation> page_locations)
+      : page_locations_(std::move(page_locations)) {}
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  /// \brief The index of the last row of a page, given the number of rows in
+  /// the row group
+  int64_t page_last_row(int page, int64_t num_rows) const;
+
+  /// \brief The indices of the pages holding any of the given rows
+  std::vector<int> SelectPages(const RowRanges& rows, int64_t num_rows) const;
+
+  /// \brief The rows held by the given pages
+  RowRanges PageRows(const std::vector<int>& pages, int64_t num_rows) const;
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+/// \brief The per-page min/max statistics of a column chunk (the ColumnIndex
+/// of the Parquet format)
+///
+/// Min and max values are encoded as in EncodedStatistics and are meaningless
+/// for pages where null_pages() is true.
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a Thrift encoded ColumnIndex. Throws on error.
+  static std::unique_ptr<ColumnIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  ColumnIndex(std::vector<bool> null_pages, std::vector<std::string> encoded_min_values,
+              std::vector<std::string> encoded_max_values,
+              std::vector<int64_t> null_counts);
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  /// \brief Whether each page only holds null values
+  const std::vector<bool>& null_pages() const { return null_pages_; }
+  const std::vector<std::string>& encoded_min_values() const { return min_values_; }
+  const std::vector<std::string>& encoded_max_values() const { return max_values_; }
+
+  bool has_null_counts() const { return !null_counts_.empty(); }
+  const std::vector<int64_t>& null_counts() const { return null_counts_; }
+
+ private:
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  std::vector<int64_t> null_counts_;
+};
+
+/// \brief Collects the page index of a column chunk while its pages are
+/// written.
+///
+/// Only columns without repetition get a page index, since the number of
+/// values of a page is then its number of rows. The ColumnIndex is omitted
+/// when a page holding non-null values lacks min/max statistics.
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  PageIndexBuilder() = default;
+
+  /// \brief Record a data page written at the given offset
+  void AddPage(int64_t offset, int32_t compressed_page_size, int64_t num_rows,
+               const EncodedStatistics& stats);
+
+  /// \brief Shift the offsets of the recorded pages, e.g. once a column chunk
+  /// buffered in memory is written to the file
+  void AddOffset(int64_t base_offset);
+
+  bool has_column_index() const { return has_column_index_ && !locations_.empty(); }
+
+  /// \brief Write the Thrift encoded ColumnIndex. Returns the number of
+  /// bytes written.
+  int64_t WriteColumnIndex(ArrowOutputStream* sink) const;
+
+  /// \brief Write the Thrift encoded OffsetIndex. Returns the number of
+  /// bytes written.
+  int64_t WriteOffsetIndex(ArrowOutputStream* sink) const;
+
+ private:
+  std::vector<PageLocation> locations_;
+  int64_t num_rows_ = 0;
+  bool has_column_index_ = true;
+  bool has_null_counts_ = true;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  std::vector<int64_t> null_counts_;
+};
+
+}  // namespace parquet
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
+
+#include "parquet/page_index.h"
+#include "parquet/platform.h"
+#include "parquet/statistics.h"
+
+namespace parquet {
+namespace test {
+
+using Range = RowRanges::Range;
+
+void AssertRangesEqual(const std::vector<Range>& expected, const RowRanges& actual) {
+  ASSERT_EQ(expected.size(), actual.ranges().size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].first, actual.ranges()[i].first);
+    ASSERT_EQ(expected[i].last, actual.ranges()[i].last);
+  }
+}
+
+TEST(RowRanges, Normalize) {
+  RowRanges ranges({{10, 19}, {0, 4}, {5, 7}, {15, 25}, {40, 30}});
+  AssertRangesEqual({{0, 7}, {10, 25}}, ranges);
+  ASSERT_EQ(24, ranges.num_rows());
+  ASSERT_FALSE(ranges.empty());
+  ASSERT_TRUE(RowRanges().empty());
+  AssertRangesEqual({{0, 99}}, RowRanges::All(100));
+}
+
+TEST(RowRanges, Overlaps) {
+  RowRanges ranges({{0, 7}, {10, 25}});
+  ASSERT_TRUE(ranges.Overlaps(7, 9));
+  ASSERT_FALSE(ranges.Overlaps(8, 9));
+  ASSERT_TRUE(ranges.Overlaps(9, 10));
+  ASSERT_TRUE(ranges.Overlaps(0, 100));
+  ASSERT_FALSE(ranges.Overlaps(26, 100));
+}
+
+TEST(RowRanges, UnionIntersect) {
+  RowRanges left({{0, 9}, {20, 29}, {40, 49}});
+  RowRanges right({{5, 24}, {45, 60}});
+  AssertRangesEqual({{0, 29}, {40, 60}}, left.Union(right));
+  AssertRangesEqual({{5, 9}, {20, 24}, {45, 49}}, left.Intersect(right));
+  ASSERT_TRUE(left.Intersect(RowRanges({{10, 19}})).empty());
+}
+
+TEST(OffsetIndex, SelectPages) {
+  OffsetIndex offset_index({{4, 100, 0}, {104, 100, 10}, {204, 100, 20}, {304, 50, 30}});
+  ASSERT_EQ(9, offset_index.page_last_row(0, 35));
+  ASSERT_EQ(34, offset_index.page_last_row(3, 35));
+
+  auto pages = offset_index.SelectPages(RowRanges({{12, 15}, {31, 31}}), 35);
+  ASSERT_EQ(std::vector<int>({1, 3}), pages);
+  AssertRangesEqual({{10, 19}, {30, 34}}, offset_index.PageRows(pages, 35));
+  ASSERT_TRUE(offset_index.SelectPages(RowRanges(), 35).empty());
+}
+
+TEST(PageIndexBuilder, Roundtrip) {
+  EncodedStatistics stats;
+  stats.set_min("a").set_max("c").set_null_count(1);
+  EncodedStatistics null_stats;
+  null_stats.set_null_count(5);
+
+  PageIndexBuilder builder;
+  builder.AddPage(4, 100, 10, stats);
+  builder.AddPage(104, 50, 5, null_stats);
+  builder.AddOffset(1000);
+  ASSERT_TRUE(builder.has_column_index());
+
+  auto sink = CreateOutputStream();
+  const int64_t column_index_length = builder.WriteColumnIndex(sink.get());
+  const int64_t offset_index_length = builder.WriteOffsetIndex(sink.get());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_EQ(column_index_length + offset_index_length, buffer->size());
+
+  auto column_index =
+      ColumnIndex::Make(buffer->data(), static_cast<uint32_t>(column_index_length));
+  ASSERT_EQ(2, column_index->num_pages());
+  ASSERT_EQ(std::vector<bool>({false, true}), column_index->null_pages());
+  ASSERT_EQ("a", column_index->encoded_min_values()[0]);
+  ASSERT_EQ("c", column_index->encoded_max_values()[0]);
+  ASSERT_TRUE(column_index->has_null_counts());
+  ASSERT_EQ(std::vector<int64_t>({1, 5}), column_index->null_counts());
+
+  auto offset_index = OffsetIndex::Make(buffer->data() + column_index_length,
+                                        static_cast<uint32_t>(offset_index_length));
+  const auto& locations = offset_index->page_locations();
+  ASSERT_EQ(2, locations.size());
+  ASSERT_EQ(1004, locations[0].offset);
+  ASSERT_EQ(100, locations[0].compressed_page_size);
+  ASSERT_EQ(0, locations[0].first_row_index);
+  ASSERT_EQ(1104, locations[1].offset);
+  ASSERT_EQ(10, locations[1].first_row_index);
+
+  // A page with values but without min/max leaves out the column index
+  builder.AddPage(154, 50, 5, EncodedStatistics());
+  ASSERT_FALSE(builder.has_column_index());
+}
+
+}  // namespace test
+}  // namespace parquet
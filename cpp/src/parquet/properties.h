@@ -110,6 +110,10 @@ static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.01;
+static constexpr int64_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
@@ -126,7 +130,10 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP),
+        bloom_filter_ndv_(DEFAULT_BLOOM_FILTER_NDV) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -148,6 +155,14 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_fpp(double fpp) { bloom_filter_fpp_ = fpp; }
+
+  void set_bloom_filter_ndv(int64_t ndv) { bloom_filter_ndv_ = ndv; }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -160,6 +175,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
+  int64_t bloom_filter_ndv() const { return bloom_filter_ndv_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -167,6 +188,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  double bloom_filter_fpp_;
+  int64_t bloom_filter_ndv_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -181,7 +205,8 @@ class PARQUET_EXPORT WriterProperties {
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_1_0),
           data_page_version_(ParquetDataPageVersion::V1),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -398,6 +423,84 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// \brief Write a bloom filter for every column chunk of every column.
+    ///
+    /// Bloom filters let readers skip column chunks which cannot contain a
+    /// value tested for equality, which min/max statistics cannot do for
+    /// high cardinality columns. They are not written for BOOLEAN or
+    /// encrypted columns.
+    Builder* enable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(true);
+      return this;
+    }
+
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(false);
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_bloom_filter(path->ToDotString());
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// \brief Specify the false positive probability of the bloom filters.
+    ///
+    /// The probability holds for column chunks with at most bloom_filter_ndv
+    /// distinct values. Lower probabilities cost more space per value.
+    Builder* bloom_filter_fpp(double fpp) {
+      if (!(fpp > 0.0 && fpp < 1.0)) {
+        throw ParquetException(
+            "Bloom filter false positive probability must be in (0, 1)");
+      }
+      default_column_properties_.set_bloom_filter_fpp(fpp);
+      return this;
+    }
+
+    /// \brief Specify the number of distinct values per column chunk the bloom
+    /// filters are sized for.
+    ///
+    /// Bloom filters are allocated up front with this capacity, so that writing
+    /// them takes bounded memory. Column chunks with more distinct values get
+    /// a higher false positive probability.
+    Builder* bloom_filter_ndv(int64_t ndv) {
+      if (ndv <= 0) {
+        throw ParquetException("Bloom filter number of distinct values must be positive");
+      }
+      default_column_properties_.set_bloom_filter_ndv(ndv);
+      return this;
+    }
+
+    /// \brief Write the page index (ColumnIndex and OffsetIndex) of every
+    /// column chunk before the file footer.
+    ///
+    /// The page index holds the location and min/max statistics of every
+    /// data page, so that readers can skip the pages which cannot match a
+    /// predicate. It is only written for unencrypted files and for columns
+    /// without repetition.
+    Builder* enable_page_index() {
+      page_index_enabled_ = true;
+      return this;
+    }
+
+    Builder* disable_page_index() {
+      page_index_enabled_ = false;
+      return this;
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -416,11 +519,14 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
           pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_));
+          default_column_properties_, column_properties, data_page_version_,
+          page_index_enabled_));
     }
 
    private:
@@ -432,6 +538,7 @@ class PARQUET_EXPORT WriterProperties {
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
     std::string created_by_;
+    bool page_index_enabled_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -442,6 +549,7 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -462,6 +570,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool page_index_enabled() const { return page_index_enabled_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -509,6 +619,18 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  double bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_fpp();
+  }
+
+  int64_t bloom_filter_ndv(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_ndv();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -530,7 +652,7 @@ class PARQUET_EXPORT WriterProperties {
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
-      ParquetDataPageVersion data_page_version)
+      ParquetDataPageVersion data_page_version, bool page_index_enabled)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
@@ -539,6 +661,7 @@ class PARQUET_EXPORT WriterProperties {
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        page_index_enabled_(page_index_enabled),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
@@ -551,6 +674,7 @@ class PARQUET_EXPORT WriterProperties {
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool page_index_enabled_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
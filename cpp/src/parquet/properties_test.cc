@@ -68,6 +68,33 @@ TEST(TestWriterProperties, AdvancedHandling) {
   ASSERT_EQ(ParquetDataPageVersion::V2, props->data_page_version());
 }
 
+TEST(TestWriterProperties, BloomFilter) {
+  WriterProperties::Builder builder;
+  builder.enable_bloom_filter("id");
+  builder.bloom_filter_fpp(0.05);
+  builder.bloom_filter_ndv(1000);
+  std::shared_ptr<WriterProperties> props = builder.build();
+
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("id")));
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("other")));
+  ASSERT_EQ(0.05, props->bloom_filter_fpp(ColumnPath::FromDotString("id")));
+  ASSERT_EQ(1000, props->bloom_filter_ndv(ColumnPath::FromDotString("id")));
+
+  props = WriterProperties::Builder()
+              .enable_bloom_filter()
+              ->disable_bloom_filter("other")
+              ->build();
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("id")));
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("other")));
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_FPP,
+            props->bloom_filter_fpp(ColumnPath::FromDotString("id")));
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_NDV,
+            props->bloom_filter_ndv(ColumnPath::FromDotString("id")));
+
+  ASSERT_THROW(builder.bloom_filter_fpp(1.0), ParquetException);
+  ASSERT_THROW(builder.bloom_filter_ndv(0), ParquetException);
+}
+
 TEST(TestReaderProperties, GetStreamInsufficientData) {
   // ARROW-6058
   std::string data = "shorter than expected";
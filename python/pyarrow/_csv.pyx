@@ -721,7 +721,8 @@ def open_csv(input_file, read_options=None, parse_options=None,
     """
     Open a streaming reader of CSV data.
 
-    Reading using this function is always single-threaded.
+    If `read_options.use_threads` is true, several blocks are parsed and
+    converted in parallel; batches are still yielded in file order.
 
     Parameters
     ----------